@@ -47,8 +47,9 @@ struct Options
     int low;
     int high;
     seqan::CharString config;
+    unsigned tileSize;
 
-    Options() : gop(0), gex(0), msc(0), mmsc(0), low(INVALID_DIAGONAL), high(INVALID_DIAGONAL)
+    Options() : gop(0), gex(0), msc(0), mmsc(0), low(INVALID_DIAGONAL), high(INVALID_DIAGONAL), tileSize(512)
     {}
 };
 
@@ -96,6 +97,7 @@ pairwise_align(TScore const& sc,
                TDiag low,
                TDiag high,
                bool banded,
+               unsigned tileSize,
                TOutputFormat outputFormat,
                TOutfile& outfile) 
 {
@@ -119,6 +121,7 @@ pairwise_align(TScore const& sc,
         else if (method == 1) aliScore = globalAlignment(gAlign, sc, TAlignConfig(), Gotoh());
         else if (method == 2) aliScore = localAlignment(gAlign, sc);
         else if (method == 3) aliScore = globalAlignment(gAlign, Lcs());
+        else if (method == 4) aliScore = globalAlignment(gAlign, sc, TAlignConfig(), TiledWavefront(tileSize));
     } else {
         if (method == 0) aliScore = globalAlignment(gAlign, sc, TAlignConfig(), low, high, NeedlemanWunsch());
         else if (method == 1) aliScore = globalAlignment(gAlign, sc, TAlignConfig(), low, high, Gotoh());
@@ -190,6 +193,7 @@ _initAlignParams(Options const & options, TScore& sc) {
     else if (meth == "gotoh") method = 1;
     else if (meth == "sw") method = 2;
     else if (meth == "lcs") method = 3;
+    else if (meth == "wf") method = 4;
     int low = 0;
     int high = 0;
     bool banded = false;
@@ -212,41 +216,41 @@ _initAlignParams(Options const & options, TScore& sc) {
     if (!empty(config))
     {
         if (config == "tttt")
-            pairwise_align<TAlphabet, AlignConfig<true, true, true, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, true, true, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "tttf")
-            pairwise_align<TAlphabet, AlignConfig<true, true, true, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, true, true, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "ttft")
-            pairwise_align<TAlphabet, AlignConfig<true, true, false, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, true, false, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "ttff")
-            pairwise_align<TAlphabet, AlignConfig<true, true, false, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, true, false, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "tftt")
-            pairwise_align<TAlphabet, AlignConfig<true, false, true, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, false, true, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "tftf")
-            pairwise_align<TAlphabet, AlignConfig<true, false, true, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, false, true, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "tfft")
-            pairwise_align<TAlphabet, AlignConfig<true, false, false, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, false, false, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "tfff")
-            pairwise_align<TAlphabet, AlignConfig<true, false, false, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<true, false, false, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "fttt")
-            pairwise_align<TAlphabet, AlignConfig<false, true, true, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, true, true, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "fttf")
-            pairwise_align<TAlphabet, AlignConfig<false, true, true, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, true, true, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "ftft")
-            pairwise_align<TAlphabet, AlignConfig<false, true, false, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, true, false, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "ftff")
-            pairwise_align<TAlphabet, AlignConfig<false, true, false, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, true, false, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "fftt")
-            pairwise_align<TAlphabet, AlignConfig<false, false, true, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, false, true, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "fftf")
-            pairwise_align<TAlphabet, AlignConfig<false, false, true, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, false, true, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "ffft")
-            pairwise_align<TAlphabet, AlignConfig<false, false, false, true> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, false, false, true> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
         else if (config == "ffff")
-            pairwise_align<TAlphabet, AlignConfig<false, false, false, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+            pairwise_align<TAlphabet, AlignConfig<false, false, false, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
     }
     else
     {
-        pairwise_align<TAlphabet, AlignConfig<false, false, false, false> >(sc, seqfile, method, low, high, banded, options.outputFormat, outfile);
+        pairwise_align<TAlphabet, AlignConfig<false, false, false, false> >(sc, seqfile, method, low, high, banded, options.tileSize, options.outputFormat, outfile);
     }
 }
 
@@ -352,9 +356,9 @@ parseCommandLine(Options & options, int argc, char const ** argv)
     setDefaultValue(parser, "alphabet", "protein");
     addOption(parser, seqan::ArgParseOption("m", "method",
                                             "DP alignment method: Needleman-Wunsch, Gotoh, Smith-Waterman, "
-                                            "Longest Common Subsequence",
+                                            "Longest Common Subsequence, parallel tiled wavefront (global)",
                                             seqan::ArgParseOption::STRING, "METHOD"));
-    setValidValues(parser, "method", "nw gotoh sw lcs");
+    setValidValues(parser, "method", "nw gotoh sw lcs wf");
     setDefaultValue(parser, "method", "gotoh");
     addOption(parser, seqan::ArgParseOption("o", "outfile", "Output filename.", seqan::ArgParseOption::OUTPUTFILE, "OUT"));
     setDefaultValue(parser, "outfile", "out.fasta");
@@ -379,6 +383,12 @@ parseCommandLine(Options & options, int argc, char const ** argv)
     addOption(parser, seqan::ArgParseOption("lo", "low", "Lower diagonal.", seqan::ArgParseOption::INTEGER, "INT"));
     addOption(parser, seqan::ArgParseOption("hi", "high", "Upper diagonal.", seqan::ArgParseOption::INTEGER, "INT"));
 
+    addSection(parser, "Tiled Wavefront Options");
+    addOption(parser, seqan::ArgParseOption("ts", "tile-size", "Number of rows and columns of one DP tile.",
+                                            seqan::ArgParseOption::INTEGER, "INT"));
+    setMinValue(parser, "tile-size", "1");
+    setDefaultValue(parser, "tile-size", "512");
+
     addSection(parser, "DP Matrix Configuration Options");
     addOption(parser, seqan::ArgParseOption("c", "config", "Alignment configuration.", seqan::ArgParseOption::STRING, "CONF"));
     setValidValues(parser, "config", "ffff ffft fftf fftt ftff ftft fttf fttt tfff tfft tftf tftt ttff ttft tttf tttt");
@@ -420,6 +430,7 @@ parseCommandLine(Options & options, int argc, char const ** argv)
     getOptionValue(options.low, parser, "low");
     getOptionValue(options.high, parser, "high");
     getOptionValue(options.config, parser, "config");
+    getOptionValue(options.tileSize, parser, "tile-size");
 
     return seqan::ArgumentParser::PARSE_OK;
 }
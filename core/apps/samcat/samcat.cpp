@@ -38,6 +38,7 @@
 #include <seqan/misc/misc_name_store_cache.h>
 
 #include <seqan/arg_parse.h>
+#include <seqan/parallel.h>
 
 #include <iostream>
 #include <fstream>
@@ -62,12 +63,219 @@ struct AppOptions
 {
     std::vector<std::string> inFiles;
     std::string outFile;
+
+    // Merge coordinate-sorted inputs instead of concatenating them.
+    bool merge;
+    // Number of threads for reading inputs and compressing BAM output.
+    unsigned numThreads;
+    // Number of records that are read ahead per input when merging.
+    unsigned prefetchSize;
+
+    AppOptions() : merge(false), numThreads(1), prefetchSize(1024)
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Class ParallelBgzfWriter
+// --------------------------------------------------------------------------
+
+// Writes a BGZF file and compresses up to numThreads blocks concurrently.  The uncompressed data is cut into blocks of
+// the same size as Stream<Bgzf> uses, so the output matches the one of the sequential writer.
+
+struct ParallelBgzfWriter
+{
+    std::ofstream file;
+    int compressLevel;
+    unsigned numThreads;
+
+    // Uncompressed data that was not written yet and the compressed blocks of the current batch.
+    CharString buffer;
+    String<CharString> compressedBlocks;
+    String<int> status;
+
+    ParallelBgzfWriter() : compressLevel(Z_DEFAULT_COMPRESSION), numThreads(1)
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Class MergeInput
+// --------------------------------------------------------------------------
+
+// One coordinate-sorted input of the merge.  Records are read ahead into two buffers: the merge consumes the front
+// buffer while the back buffer holds the next records.  The back buffers of all inputs that need one are filled in
+// parallel.
+
+struct MergeInput
+{
+    BamStream stream;
+
+    // Translates the file-local reference ids into the ids of the merged header.
+    String<__int32> rIdMap;
+
+    String<BamAlignmentRecord> front;
+    String<BamAlignmentRecord> back;
+    unsigned frontPos;
+    unsigned frontLength;
+    unsigned backLength;
+    bool backFilled;
+
+    // Reading failed or a record referred to a reference that is not in the header.
+    bool failed;
+
+    MergeInput() : frontPos(0), frontLength(0), backLength(0), backFilled(false), failed(false)
+    {}
+};
+
+// --------------------------------------------------------------------------
+// Class MergeTree
+// --------------------------------------------------------------------------
+
+// Tournament (loser) tree over the current records of k inputs.  losers[0] is the overall winner, losers[1..k-1] are
+// the losers of the matches at the inner nodes.  After the winner advances, only the matches on the path from its leaf
+// to the root are replayed, i.e. there are ceil(log2(k)) comparisons per record.
+
+struct MergeTree
+{
+    String<unsigned> losers;
+    String<__uint64> keys;
+    String<bool> exhausted;
 };
 
 // ==========================================================================
 // Functions
 // ==========================================================================
 
+// --------------------------------------------------------------------------
+// Function open()                                       [ParallelBgzfWriter]
+// --------------------------------------------------------------------------
+
+inline bool
+open(ParallelBgzfWriter & writer, char const * fileName)
+{
+    writer.file.open(fileName, std::ios::binary | std::ios::out);
+    clear(writer.buffer);
+    return writer.file.is_open();
+}
+
+// --------------------------------------------------------------------------
+// Function _compressBgzfBlocks()
+// --------------------------------------------------------------------------
+
+// Compress up to one block worth of data into target.  In the rare case that the data does not compress enough for
+// one block, it is split into several blocks like in Stream<Bgzf>.  Empty input results in the empty EOF block.
+
+inline int
+_compressBgzfBlocks(CharString & target, char const * source, int sourceLength, int compressLevel)
+{
+    int const MAX_BLOCK_SIZE = 64 * 1024;
+
+    clear(target);
+    do
+    {
+        size_t targetPos = length(target);
+        resize(target, targetPos + MAX_BLOCK_SIZE);
+
+        int inputLength = sourceLength;
+        int blockLength;
+        while ((blockLength = _bgzfCompressBlock(&target[targetPos], MAX_BLOCK_SIZE, source, inputLength,
+                                                 compressLevel)) < 0)
+        {
+            inputLength -= 1024;
+            if (inputLength <= 0)
+                return -1;
+        }
+
+        resize(target, targetPos + blockLength);
+        source += inputLength;
+        sourceLength -= inputLength;
+    }
+    while (sourceLength > 0);
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------
+// Function _flushParallelBgzf()
+// --------------------------------------------------------------------------
+
+// Compress and write all complete blocks of the buffer, and the incomplete last block if final is true.
+
+inline int
+_flushParallelBgzf(ParallelBgzfWriter & writer, bool final)
+{
+    int const BLOCK_SIZE = 64 * 1024;
+
+    int numBlocks = length(writer.buffer) / BLOCK_SIZE;
+    if (final && length(writer.buffer) % BLOCK_SIZE != 0)
+        ++numBlocks;
+
+    resize(writer.compressedBlocks, numBlocks);
+    resize(writer.status, numBlocks);
+
+    SEQAN_OMP_PRAGMA(parallel for num_threads(writer.numThreads) schedule(dynamic))
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        size_t blockBegin = (size_t)i * BLOCK_SIZE;
+        int blockLength = _min(BLOCK_SIZE, (int)(length(writer.buffer) - blockBegin));
+        writer.status[i] = _compressBgzfBlocks(writer.compressedBlocks[i], &writer.buffer[blockBegin], blockLength,
+                                               writer.compressLevel);
+    }
+
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        if (writer.status[i] != 0)
+            return -1;
+        writer.file.write(&writer.compressedBlocks[i][0], length(writer.compressedBlocks[i]));
+    }
+
+    erase(writer.buffer, 0, _min(length(writer.buffer), (size_t)numBlocks * BLOCK_SIZE));
+    return writer.file.good() ? 0 : -1;
+}
+
+// --------------------------------------------------------------------------
+// Function streamWriteBlock()                           [ParallelBgzfWriter]
+// --------------------------------------------------------------------------
+
+// Only buffers the data, the blocks are compressed once there is one block per thread.
+
+inline size_t
+streamWriteBlock(ParallelBgzfWriter & writer, char const * source, size_t count)
+{
+    size_t oldLength = length(writer.buffer);
+    resize(writer.buffer, oldLength + count);
+    if (count != 0)
+        memcpy(&writer.buffer[oldLength], source, count);
+
+    if (length(writer.buffer) >= (size_t)writer.numThreads * 64 * 1024 && _flushParallelBgzf(writer, false) != 0)
+        return 0;
+    return count;
+}
+
+// --------------------------------------------------------------------------
+// Function close()                                      [ParallelBgzfWriter]
+// --------------------------------------------------------------------------
+
+// Write out the remaining data and the empty EOF block.
+
+inline int
+close(ParallelBgzfWriter & writer)
+{
+    if (!writer.file.is_open())
+        return 0;
+
+    int res = _flushParallelBgzf(writer, true);
+    if (res == 0)
+    {
+        CharString & eofBlock = writer.buffer;
+        res = _compressBgzfBlocks(eofBlock, "", 0, writer.compressLevel);
+        if (res == 0)
+            writer.file.write(&eofBlock[0], length(eofBlock));
+        clear(eofBlock);
+    }
+    writer.file.close();
+    return (res == 0 && !writer.file.fail()) ? 0 : -1;
+}
+
 // --------------------------------------------------------------------------
 // Function mergeBamFiles()
 // --------------------------------------------------------------------------
@@ -205,6 +413,311 @@ int mergeBamFiles(TWriter &writer, Tag<TFormat> writeFormat, std::vector<std::st
 }
 
 
+// --------------------------------------------------------------------------
+// Function _mergeKey()
+// --------------------------------------------------------------------------
+
+// Sort key of the coordinate order.  Unmapped records with rID -1 are mapped to the largest keys and sort last.
+
+inline __uint64
+_mergeKey(BamAlignmentRecord const & record)
+{
+    return ((__uint64)(__uint32)record.rID << 32) | (__uint32)record.beginPos;
+}
+
+// --------------------------------------------------------------------------
+// Function _fillMergeInput()
+// --------------------------------------------------------------------------
+
+// Read the next records of an input into its back buffer and translate their reference ids.  Inputs do not share any
+// state, so this can run for several inputs concurrently.
+
+inline void
+_fillMergeInput(MergeInput & input, unsigned prefetchSize)
+{
+    resize(input.back, prefetchSize);
+
+    unsigned count = 0;
+    while (!input.failed && count < prefetchSize && !atEnd(input.stream))
+    {
+        BamAlignmentRecord & record = input.back[count];
+        if (readRecord(record, input.stream) != 0 ||
+            record.rID >= (__int32)length(input.rIdMap) || record.rNextId >= (__int32)length(input.rIdMap))
+        {
+            input.failed = true;
+            break;
+        }
+
+        if (record.rID >= 0)
+            record.rID = input.rIdMap[record.rID];
+        if (record.rNextId >= 0)
+            record.rNextId = input.rIdMap[record.rNextId];
+        ++count;
+    }
+
+    input.backLength = count;
+    input.backFilled = true;
+}
+
+// --------------------------------------------------------------------------
+// Function _nextMergeBuffer()
+// --------------------------------------------------------------------------
+
+// Switch an input to its back buffer.  If the back buffer was not filled yet then the back buffers of all inputs
+// that wait for records are filled in parallel first.
+
+inline void
+_nextMergeBuffer(String<MergeInput *> & inputs, unsigned idx, AppOptions const & options)
+{
+    if (!inputs[idx]->backFilled)
+    {
+        SEQAN_OMP_PRAGMA(parallel for num_threads(options.numThreads) schedule(dynamic))
+        for (int i = 0; i < (int)length(inputs); ++i)
+            if (!inputs[i]->backFilled)
+                _fillMergeInput(*inputs[i], options.prefetchSize);
+    }
+
+    MergeInput & input = *inputs[idx];
+    swap(input.front, input.back);
+    input.frontPos = 0;
+    input.frontLength = input.backLength;
+    input.backLength = 0;
+    input.backFilled = (input.frontLength == 0);  // There is nothing left to read ahead.
+}
+
+// --------------------------------------------------------------------------
+// Function _mergeLess()
+// --------------------------------------------------------------------------
+
+// Compare the current records of two inputs.  Exhausted inputs lose against all others and ties are broken by the
+// input order, so records with the same position keep the order of the input files.
+
+inline bool
+_mergeLess(MergeTree const & tree, unsigned a, unsigned b)
+{
+    if (tree.exhausted[a] != tree.exhausted[b])
+        return tree.exhausted[b];
+    if (tree.keys[a] != tree.keys[b])
+        return tree.keys[a] < tree.keys[b];
+    return a < b;
+}
+
+// --------------------------------------------------------------------------
+// Function _buildMergeTree()
+// --------------------------------------------------------------------------
+
+// Play the matches of the subtree below node and return its winner.  Inner nodes are 1..k-1, leaves are k..2k-1.
+
+inline unsigned
+_buildMergeTree(MergeTree & tree, unsigned node)
+{
+    unsigned k = length(tree.keys);
+    if (node >= k)
+        return node - k;
+
+    unsigned left = _buildMergeTree(tree, 2 * node);
+    unsigned right = _buildMergeTree(tree, 2 * node + 1);
+    if (_mergeLess(tree, left, right))
+    {
+        tree.losers[node] = right;
+        return left;
+    }
+    tree.losers[node] = left;
+    return right;
+}
+
+inline void
+_buildMergeTree(MergeTree & tree)
+{
+    resize(tree.losers, length(tree.keys));
+    tree.losers[0] = _buildMergeTree(tree, 1);
+}
+
+// --------------------------------------------------------------------------
+// Function _replayMergeTree()
+// --------------------------------------------------------------------------
+
+// Replay the matches of the previous winner leaf after its key changed.
+
+inline void
+_replayMergeTree(MergeTree & tree, unsigned leaf)
+{
+    unsigned winner = leaf;
+    for (unsigned node = (leaf + length(tree.keys)) / 2; node > 0; node /= 2)
+        if (_mergeLess(tree, tree.losers[node], winner))
+            std::swap(tree.losers[node], winner);
+    tree.losers[0] = winner;
+}
+
+// --------------------------------------------------------------------------
+// Function _updateMergeKey()
+// --------------------------------------------------------------------------
+
+// Set the key of an input to its current record.  Returns false if the input is not sorted by coordinate.
+
+inline bool
+_updateMergeKey(MergeTree & tree, MergeInput const & input, unsigned idx)
+{
+    if (input.frontPos == input.frontLength)
+    {
+        tree.exhausted[idx] = true;
+        return true;
+    }
+
+    __uint64 key = _mergeKey(input.front[input.frontPos]);
+    if (key < tree.keys[idx])
+        return false;
+    tree.keys[idx] = key;
+    return true;
+}
+
+// --------------------------------------------------------------------------
+// Function mergeSortedBamFiles()
+// --------------------------------------------------------------------------
+
+// Merge coordinate-sorted inputs into a coordinate-sorted output with a tournament tree.
+
+template <typename TWriter, typename TFormat>
+int _mergeSortedBamFiles(TWriter &writer, Tag<TFormat> writeFormat, AppOptions &options,
+                         String<MergeInput *> &inputs)
+{
+    typedef StringSet<CharString>       TNameStore;
+    typedef NameStoreCache<TNameStore>  TNameStoreCache;
+
+    TNameStore contigNameStore;
+    TNameStoreCache contigNameStoreCache(contigNameStore);
+
+    BamIOContext<TNameStore> bamIOContext(contigNameStore, contigNameStoreCache);
+    int returnedError = 0;
+
+
+    // Step 1: Open all inputs, merge their headers, and map their reference ids to the ones of the merged header.
+    BamHeader header;
+    for (unsigned i = 0; i < length(inputs); ++i)
+    {
+        MergeInput & input = *inputs[i];
+        if (open(input.stream, options.inFiles[i].c_str()) != 0 || !isGood(input.stream))
+        {
+            std::cerr << "ERROR: Couldn't open " << options.inFiles[i] << " for reading." << std::endl;
+            input.failed = true;
+            returnedError = -1;
+            continue;
+        }
+
+        BamHeader const & fileHeader = input.stream.header;
+        append(header.records, fileHeader.records);
+
+        resize(input.rIdMap, length(fileHeader.sequenceInfos));
+        for (unsigned j = 0; j < length(fileHeader.sequenceInfos); ++j)
+        {
+            unsigned globalRId = 0;
+            if (!getIdByName(contigNameStore, fileHeader.sequenceInfos[j].i1, globalRId, contigNameStoreCache))
+            {
+                globalRId = length(contigNameStore);
+                appendName(contigNameStore, fileHeader.sequenceInfos[j].i1, contigNameStoreCache);
+                appendValue(header.sequenceInfos, fileHeader.sequenceInfos[j]);
+            }
+            else if (header.sequenceInfos[globalRId].i2 != fileHeader.sequenceInfos[j].i2)
+            {
+                std::cerr << "ERROR: Reference sequence " << fileHeader.sequenceInfos[j].i1 << " has different "
+                          << "lengths in the input files." << std::endl;
+                return -1;
+            }
+
+            // The merged order must be compatible with the order each input is sorted by.
+            if (j > 0 && globalRId < (unsigned)input.rIdMap[j - 1])
+            {
+                std::cerr << "ERROR: The reference sequences of " << options.inFiles[i] << " are in a different "
+                          << "order than in the files before." << std::endl;
+                return -1;
+            }
+            input.rIdMap[j] = globalRId;
+        }
+    }
+
+
+    // Step 2: Remove duplicate header entries and write merged header
+    removeDuplicates(header);
+    setSortOrder(header, BAM_SORT_COORDINATE);
+    write2(writer, header, bamIOContext, writeFormat);
+
+
+    // Step 3: Read ahead two buffers per input and set up the tournament tree.
+    MergeTree tree;
+    resize(tree.keys, length(inputs), 0);
+    resize(tree.exhausted, length(inputs), false);
+    for (unsigned i = 0; i < length(inputs); ++i)
+    {
+        _nextMergeBuffer(inputs, i, options);
+        _updateMergeKey(tree, *inputs[i], i);
+    }
+    if (!empty(inputs))
+        _buildMergeTree(tree);
+
+
+    // Step 4: Write out the smallest record and advance its input until all inputs are exhausted.
+    while (!empty(tree.losers) && !tree.exhausted[tree.losers[0]])
+    {
+        unsigned idx = tree.losers[0];
+        MergeInput & input = *inputs[idx];
+
+        if (write2(writer, input.front[input.frontPos], bamIOContext, writeFormat) != 0)
+        {
+            std::cerr << "ERROR: Problem writing record to output file." << std::endl;
+            return -1;
+        }
+
+        if (++input.frontPos == input.frontLength)
+            _nextMergeBuffer(inputs, idx, options);
+
+        if (!_updateMergeKey(tree, input, idx))
+        {
+            std::cerr << "ERROR: File " << options.inFiles[idx] << " is not sorted by coordinate." << std::endl;
+            return -1;
+        }
+        if (tree.exhausted[idx] && input.failed && isGood(input.stream))
+        {
+            std::cerr << "ERROR: Record in file " << options.inFiles[idx] << " refers to a reference sequence "
+                      << "that is not in its header." << std::endl;
+            returnedError = -1;
+        }
+        else if (tree.exhausted[idx] && input.failed)
+        {
+            std::cerr << "ERROR: Problem reading record from file " << options.inFiles[idx] << std::endl;
+            returnedError = -1;
+        }
+        _replayMergeTree(tree, idx);
+    }
+    return returnedError;
+}
+
+template <typename TWriter, typename TFormat>
+int mergeSortedBamFiles(TWriter &writer, Tag<TFormat> writeFormat, AppOptions &options)
+{
+    // Inputs hold open streams and cannot be copied, so they are allocated individually.
+    String<MergeInput *> inputs;
+    for (unsigned i = 0; i < length(options.inFiles); ++i)
+        appendValue(inputs, new MergeInput());
+
+    int res = _mergeSortedBamFiles(writer, writeFormat, options, inputs);
+
+    for (unsigned i = 0; i < length(inputs); ++i)
+        delete inputs[i];
+    return res;
+}
+
+// --------------------------------------------------------------------------
+// Function catBamFiles()
+// --------------------------------------------------------------------------
+
+template <typename TWriter, typename TFormat>
+int catBamFiles(TWriter &writer, Tag<TFormat> writeFormat, AppOptions &options)
+{
+    if (options.merge)
+        return mergeSortedBamFiles(writer, writeFormat, options);
+    return mergeBamFiles(writer, writeFormat, options.inFiles);
+}
+
 // --------------------------------------------------------------------------
 // Function parseCommandLine()
 // --------------------------------------------------------------------------
@@ -225,6 +738,10 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
     addDescription(parser, "This tool reads a set of input files in SAM or BAM format and outputs the concatenation of them. "
                            "If the output file name is ommitted the result is written to standard output in SAM format.");
 
+    addDescription(parser, "With \\fB-m\\fP the input files must be sorted by coordinate and are merged into one "
+                           "sorted output.  Their headers are merged and the reference ids of the records are "
+                           "translated to the merged list of reference sequences.");
+
     addDescription(parser, "(c) Copyright 2014 by David Weese.");
 
     // We require one argument.
@@ -235,12 +752,22 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
     addOption(parser, ArgParseOption("o", "output", "Output file name", ArgParseOption::OUTPUTFILE));
     setValidValues(parser, "output", ".sam .bam");
 
+    addOption(parser, ArgParseOption("m", "merge", "Merge coordinate-sorted input files into a coordinate-sorted "
+                                     "output instead of concatenating them."));
+
+    addOption(parser, ArgParseOption("t", "threads", "Number of threads for reading the inputs when merging and for "
+                                     "compressing BAM output.", ArgParseOption::INTEGER));
+    setMinValue(parser, "threads", "1");
+    setDefaultValue(parser, "threads", options.numThreads);
+
     // Add Examples Section.
     addTextSection(parser, "Examples");
     addListItem(parser, "\\fBsamcat\\fP \\fBmapped1.sam\\fP \\fBmapped2.sam\\fP \\fB-o\\fP \\fBmerged.sam\\fP",
                 "Merge two SAM files.");
     addListItem(parser, "\\fBsamcat\\fP \\fBinput.sam\\fP \\fB-o\\fP \\fBouput.bam\\fP",
                 "Convert a SAM file into BAM format.");
+    addListItem(parser, "\\fBsamcat\\fP \\fB-m\\fP \\fB-t\\fP \\fB8\\fP \\fBchunk*.bam\\fP \\fB-o\\fP \\fBsorted.bam\\fP",
+                "Merge sorted BAM files using 8 threads.");
 
     // Parse command line.
     ArgumentParser::ParseResult res = parse(parser, argc, argv);
@@ -251,6 +778,8 @@ parseCommandLine(AppOptions & options, int argc, char const ** argv)
 
     options.inFiles = getArgumentValues(parser, 0);
     getOptionValue(options.outFile, parser, "output");
+    options.merge = isSet(parser, "merge");
+    getOptionValue(options.numThreads, parser, "threads");
 
     return ArgumentParser::PARSE_OK;
 }
@@ -276,13 +805,20 @@ int main(int argc, char const ** argv)
 
     if (guessFormatFromFilename(options.outFile, Bam()))
     {
-        Stream<Bgzf> writer;
-        if (!open(writer, options.outFile.c_str(), "w"))
+        ParallelBgzfWriter writer;
+        writer.numThreads = options.numThreads;
+        if (!open(writer, options.outFile.c_str()))
         {
             std::cerr << "ERROR: Couldn't open " << options.outFile << " for writing." << std::endl;
             return -1;
         }
-        return mergeBamFiles(writer, Bam(), options.inFiles);
+        int res = catBamFiles(writer, Bam(), options);
+        if (close(writer) != 0)
+        {
+            std::cerr << "ERROR: Problem writing " << options.outFile << std::endl;
+            return -1;
+        }
+        return res;
     }
     else if (!options.outFile.empty())
     {
@@ -292,11 +828,11 @@ int main(int argc, char const ** argv)
             std::cerr << "ERROR: Couldn't open " << options.outFile << " for writing." << std::endl;
             return -1;
         }
-        return mergeBamFiles(writer, Sam(), options.inFiles);
+        return catBamFiles(writer, Sam(), options);
     }
     else
     {
         // dump to standard out stream
-        return mergeBamFiles(std::cout, Sam(), options.inFiles);
+        return catBamFiles(std::cout, Sam(), options);
     }
 }
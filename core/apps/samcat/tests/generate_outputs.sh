@@ -12,3 +12,13 @@ ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -o ex1_merged.sam
 echo ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -o ex1_merged.bam
 ${SAMCAT} ex1_a1.sam ex1_a2.sam ex1_a3.sam -o ex1_merged.bam
 
+
+# ============================================================
+# Merge sorted SAM and BAM files.
+# ============================================================
+
+echo ${SAMCAT} -m -t 2 ex1_b1.sam ex1_b2.bam ex1_b3.sam -o ex1_sorted_merged.sam
+${SAMCAT} -m -t 2 ex1_b1.sam ex1_b2.bam ex1_b3.sam -o ex1_sorted_merged.sam
+
+echo ${SAMCAT} -m -t 2 ex1_b1.sam ex1_b2.bam ex1_b3.sam -o ex1_sorted_merged.bam
+${SAMCAT} -m -t 2 ex1_b1.sam ex1_b2.bam ex1_b3.sam -o ex1_sorted_merged.bam
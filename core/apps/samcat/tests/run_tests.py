@@ -70,6 +70,32 @@ def main(source_base, binary_base):
                   ph.outFile('ex1_merged.bam'))])
     conf_list.append(conf)
 
+    # ============================================================
+    # Merge sorted SAM and BAM files.
+    # ============================================================
+
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        args=['-m', '-t', '2',
+              ph.inFile('ex1_b1.sam'),
+              ph.inFile('ex1_b2.bam'),
+              ph.inFile('ex1_b3.sam'),
+              '-o', ph.outFile('ex1_sorted_merged.sam')],
+        to_diff=[(ph.inFile('ex1_sorted_merged.sam'),
+                  ph.outFile('ex1_sorted_merged.sam'))])
+    conf_list.append(conf)
+
+    conf = app_tests.TestConf(
+        program=path_to_program,
+        args=['-m', '-t', '2',
+              ph.inFile('ex1_b1.sam'),
+              ph.inFile('ex1_b2.bam'),
+              ph.inFile('ex1_b3.sam'),
+              '-o', ph.outFile('ex1_sorted_merged.bam')],
+        to_diff=[(ph.inFile('ex1_sorted_merged.bam'),
+                  ph.outFile('ex1_sorted_merged.bam'))])
+    conf_list.append(conf)
+
     # Execute the tests.
     failures = 0
     for conf in conf_list:
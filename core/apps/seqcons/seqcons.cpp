@@ -260,8 +260,8 @@ int main(int argc, const char *argv[]) {
             std::cerr << "contig " << (currentContig + 1) << "/" << numberOfContigs << std::endl;
 			if (consOpt.method == 0) {
 				Score<int, WeightedConsensusScore<Score<int, FractionalScore>, Score<int, ConsensusScore> > > combinedScore;
-				reAlign(fragStore, combinedScore, currentContig, consOpt.rmethod, consOpt.bandwidth, consOpt.include);
-				if (consOpt.include) reAlign(fragStore, combinedScore, currentContig, consOpt.rmethod, consOpt.bandwidth, false);
+				reAlign(fragStore, combinedScore, currentContig, consOpt.rmethod, consOpt.bandwidth, consOpt.include, true);
+				if (consOpt.include) reAlign(fragStore, combinedScore, currentContig, consOpt.rmethod, consOpt.bandwidth, false, true);
 			} else {
                 std::cerr << "Performing consensus alignment..." << std::endl;
 				// Import all reads of the given contig
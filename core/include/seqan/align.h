@@ -51,6 +51,7 @@
 
 #include <seqan/basic.h>
 #include <seqan/modifier.h>  // ModifiedAlphabet<>.
+#include <seqan/parallel.h>  // SEQAN_OMP_PRAGMA.
 #include <seqan/graph_align.h>  // TODO(holtgrew): We should not have to depend on this.
 
 // TODO(holtgrew): Why not use priority queue from STL?
@@ -152,6 +153,10 @@
 #include <seqan/align/dp_traceback_impl.h>
 #include <seqan/align/dp_algorithm_impl.h>
 
+// The tiled wavefront variant of the global alignment computes the tiles of
+// one anti-diagonal in parallel and recomputes tiles for the traceback.
+#include <seqan/align/global_alignment_wavefront_impl.h>
+
 //################################################################################
 // Old module
 //################################################################################
@@ -134,6 +134,51 @@ typedef Tag<MyersBitVector_> MyersBitVector;
 struct MyersHirschberg_;
 typedef Tag<MyersHirschberg_> MyersHirschberg;
 
+/*!
+ * @class TiledWavefront
+ * @headerfile <seqan/align.h>
+ * @brief Selects the tiled, parallel wavefront computation of the global DP alignment.
+ *
+ * @signature class TiledWavefront;
+ *
+ * The DP matrix is cut into square tiles of <tt>tileSize</tt> rows and columns.  All tiles on the same
+ * anti-diagonal are computed in parallel using OpenMP.  When only the score is computed, only the current tile
+ * borders are kept.  For the traceback, all tile borders are kept and the tiles on the traceback path are
+ * recomputed on demand.  Thus, the tile size trades memory for the borders against recomputation time.
+ *
+ * @var TSize TiledWavefront::tileSize
+ * @brief Number of rows and columns of one tile, defaults to 512.
+ */
+
+/**
+.Class.TiledWavefront
+..cat:Alignments
+..summary:Selects the tiled, parallel wavefront computation of the global DP alignment.
+..signature:TiledWavefront
+..remarks:The DP matrix is cut into square tiles. All tiles on the same anti-diagonal are computed in parallel using OpenMP.
+When only the score is computed, only the current tile borders are kept.
+For the traceback, all tile borders are kept and the tiles on the traceback path are recomputed on demand.
+..memvar.TiledWavefront#tileSize:Number of rows and columns of one tile, defaults to 512.
+..see:Function.globalAlignment
+..see:Function.globalAlignmentScore
+..include:seqan/align.h
+*/
+
+class TiledWavefront
+{
+public:
+    unsigned tileSize;
+
+    TiledWavefront() : tileSize(512)
+    {}
+
+    explicit
+    TiledWavefront(unsigned tileSize_) : tileSize(tileSize_)
+    {
+        SEQAN_ASSERT_GT(tileSize_, 0u);
+    }
+};
+
 // ----------------------------------------------------------------------------
 // Local Alignment Algorithm Tags
 // ----------------------------------------------------------------------------
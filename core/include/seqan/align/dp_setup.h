@@ -244,6 +244,7 @@ _setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     TSequenceHEntry seqHEntry = sequenceEntryForScore(scoringScheme, seqH, 0);
     TSequenceVEntry seqVEntry = sequenceEntryForScore(scoringScheme, seqV, 0);
@@ -324,6 +325,7 @@ _setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     TSequenceHEntry seqHEntry = sequenceEntryForScore(scoringScheme, seqH, 0);
     TSequenceVEntry seqVEntry = sequenceEntryForScore(scoringScheme, seqV, 0);
@@ -407,6 +409,7 @@ _setUpAndRunAlignment(DPScoutState_<TDPScoutStateSpec> & dpScoutState,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     String<TraceSegment_<unsigned, unsigned> > traceSegments;
 
@@ -485,6 +488,7 @@ _setUpAndRunAlignment(DPScoutState_<TDPScoutStateSpec> & dpScoutState,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     String<TraceSegment_<unsigned, unsigned> > traceSegments;
 
@@ -574,6 +578,7 @@ _setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
     
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     TSequenceHEntry seqHEntry = sequenceEntryForScore(scoringScheme, seqH, 0);
     TSequenceVEntry seqVEntry = sequenceEntryForScore(scoringScheme, seqV, 0);
@@ -662,6 +667,7 @@ _setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     TSequenceHEntry seqHEntry = sequenceEntryForScore(scoringScheme, seqH, 0);
     TSequenceVEntry seqVEntry = sequenceEntryForScore(scoringScheme, seqV, 0);
@@ -754,6 +760,7 @@ _setUpAndRunAlignment(DPScoutState_<TDPScoutStateSpec> & dpScoutState,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     String<TraceSegment_<unsigned, unsigned> > traceSegments;
 
@@ -829,6 +836,7 @@ _setUpAndRunAlignment(DPScoutState_<TDPScoutStateSpec> & dpScoutState,
 
     SEQAN_ASSERT_GEQ(length(seqH), 1u);
     SEQAN_ASSERT_GEQ(length(seqV), 1u);
+    _checkSequenceForScore(scoringScheme, seqH);
 
     String<TraceSegment_<unsigned, unsigned> > traceSegments;
 
@@ -0,0 +1,625 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tiled wavefront computation of global alignments.
+//
+// The DP matrix is cut into square tiles.  A tile can be computed as soon as
+// its upper and its left neighbour are known, thus all tiles on the same
+// anti-diagonal of tiles are independent and are computed in parallel.
+//
+// In score-only mode we keep one horizontal border per tile column and one
+// vertical border per tile row that are overwritten while the wavefront
+// moves on.  If the traceback is needed, the borders of all tiles are kept
+// and the traceback recomputes only the tiles it passes through.
+//
+// We always compute affine gap costs.  Linear gap costs are the special case
+// where gap open and gap extend score are equal.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_WAVEFRONT_IMPL_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_WAVEFRONT_IMPL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class WavefrontCell_
+// ----------------------------------------------------------------------------
+
+// The values of one DP cell: the best score and the best scores of alignments
+// ending with a horizontal or a vertical gap.
+
+template <typename TScoreValue>
+struct WavefrontCell_
+{
+    TScoreValue _score;
+    TScoreValue _horizontalScore;
+    TScoreValue _verticalScore;
+};
+
+// ----------------------------------------------------------------------------
+// Class WavefrontTiles_
+// ----------------------------------------------------------------------------
+
+// Stores the geometry of the tiling and the tile borders.
+//
+// If keepAllBorders is true then horizontalBorders stores the complete DP row
+// at every tile row boundary and verticalBorders the complete DP column at
+// every tile column boundary.  Otherwise, horizontalBorders stores tileSize + 1
+// cells per tile column and verticalBorders tileSize + 1 cells per tile row.
+
+template <typename TScoreValue>
+struct WavefrontTiles_
+{
+    typedef WavefrontCell_<TScoreValue> TCell;
+    typedef typename Size<String<TCell> >::Type TSize;
+
+    TSize lengthH;
+    TSize lengthV;
+    TSize tileSize;
+    TSize tileCountH;
+    TSize tileCountV;
+    bool keepAllBorders;
+
+    String<TCell> horizontalBorders;
+    String<TCell> verticalBorders;
+
+    WavefrontTiles_() :
+        lengthH(0), lengthV(0), tileSize(0), tileCountH(0), tileCountV(0), keepAllBorders(false)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _horizontalBorderOffset()
+// ----------------------------------------------------------------------------
+
+// Position of the cell (tileRow * tileSize, tileColumn * tileSize) in the
+// horizontal borders.
+
+template <typename TScoreValue, typename TSize>
+inline TSize
+_horizontalBorderOffset(WavefrontTiles_<TScoreValue> const & tiles, TSize tileRow, TSize tileColumn)
+{
+    if (tiles.keepAllBorders)
+        return tileRow * (tiles.lengthH + 1) + tileColumn * tiles.tileSize;
+    return tileColumn * (tiles.tileSize + 1);
+}
+
+// ----------------------------------------------------------------------------
+// Function _verticalBorderOffset()
+// ----------------------------------------------------------------------------
+
+// Position of the cell (tileRow * tileSize, tileColumn * tileSize) in the
+// vertical borders.
+
+template <typename TScoreValue, typename TSize>
+inline TSize
+_verticalBorderOffset(WavefrontTiles_<TScoreValue> const & tiles, TSize tileRow, TSize tileColumn)
+{
+    if (tiles.keepAllBorders)
+        return tileColumn * (tiles.lengthV + 1) + tileRow * tiles.tileSize;
+    return tileRow * (tiles.tileSize + 1);
+}
+
+// ----------------------------------------------------------------------------
+// Function _initWavefrontTiles()
+// ----------------------------------------------------------------------------
+
+// Allocates the borders and initializes the first DP row and column.
+
+template <typename TScoreValue, typename TSize, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+void _initWavefrontTiles(WavefrontTiles_<TScoreValue> & tiles,
+                         TSize lengthH,
+                         TSize lengthV,
+                         TSize tileSize,
+                         bool keepAllBorders,
+                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                         AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/)
+{
+    typedef WavefrontCell_<TScoreValue> TCell;
+    typedef typename WavefrontTiles_<TScoreValue>::TSize TTilesSize;
+
+    TScoreValue const infinity = MinValue<TScoreValue>::VALUE / 2;
+    TScoreValue const gapOpen = scoreGapOpen(scoringScheme);
+    TScoreValue const gapExtend = scoreGapExtend(scoringScheme);
+
+    tiles.lengthH = lengthH;
+    tiles.lengthV = lengthV;
+    tiles.tileSize = tileSize;
+    tiles.tileCountH = (lengthH + tileSize - 1) / tileSize;
+    tiles.tileCountV = (lengthV + tileSize - 1) / tileSize;
+    tiles.keepAllBorders = keepAllBorders;
+
+    if (keepAllBorders)
+    {
+        resize(tiles.horizontalBorders, (tiles.tileCountV + 1) * (lengthH + 1), Exact());
+        resize(tiles.verticalBorders, (tiles.tileCountH + 1) * (lengthV + 1), Exact());
+    }
+    else
+    {
+        resize(tiles.horizontalBorders, tiles.tileCountH * (tileSize + 1), Exact());
+        resize(tiles.verticalBorders, tiles.tileCountV * (tileSize + 1), Exact());
+    }
+
+    // Initialize the first row.  In score-only mode the cell shared by two
+    // neighbouring tiles is stored once for each tile.
+    for (TTilesSize j = 0; j < tiles.tileCountH; ++j)
+    {
+        TTilesSize beginH = j * tileSize;
+        TTilesSize endH = _min(beginH + tileSize, static_cast<TTilesSize>(lengthH));
+        TCell * cell = begin(tiles.horizontalBorders, Standard()) + _horizontalBorderOffset(tiles, (TTilesSize)0, j);
+        for (TTilesSize pos = beginH; pos <= endH; ++pos, ++cell)
+        {
+            cell->_verticalScore = infinity;
+            if (pos == 0u)
+            {
+                cell->_score = 0;
+                cell->_horizontalScore = infinity;
+            }
+            else
+            {
+                cell->_score = (TOP) ? 0 : gapOpen + static_cast<TScoreValue>(pos - 1) * gapExtend;
+                cell->_horizontalScore = cell->_score;
+            }
+        }
+    }
+
+    // Initialize the first column.
+    for (TTilesSize i = 0; i < tiles.tileCountV; ++i)
+    {
+        TTilesSize beginV = i * tileSize;
+        TTilesSize endV = _min(beginV + tileSize, static_cast<TTilesSize>(lengthV));
+        TCell * cell = begin(tiles.verticalBorders, Standard()) + _verticalBorderOffset(tiles, i, (TTilesSize)0);
+        for (TTilesSize pos = beginV; pos <= endV; ++pos, ++cell)
+        {
+            cell->_horizontalScore = infinity;
+            if (pos == 0u)
+            {
+                cell->_score = 0;
+                cell->_verticalScore = infinity;
+            }
+            else
+            {
+                cell->_score = (LEFT) ? 0 : gapOpen + static_cast<TScoreValue>(pos - 1) * gapExtend;
+                cell->_verticalScore = cell->_score;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _storeWavefrontTrace()
+// ----------------------------------------------------------------------------
+
+// Nothing is stored if the tile is computed for the score only.
+
+template <typename TPosition, typename TScoreValue>
+inline void
+_storeWavefrontTrace(Nothing & /*traceMatrix*/,
+                     TPosition /*pos*/,
+                     WavefrontCell_<TScoreValue> const & /*cell*/,
+                     TScoreValue /*diagonalScore*/,
+                     TScoreValue /*horizontalExtendScore*/,
+                     TScoreValue /*verticalExtendScore*/)
+{}
+
+template <typename TSpec, typename TPosition, typename TScoreValue>
+inline void
+_storeWavefrontTrace(String<TraceBitMap_::TTraceValue, TSpec> & traceMatrix,
+                     TPosition pos,
+                     WavefrontCell_<TScoreValue> const & cell,
+                     TScoreValue diagonalScore,
+                     TScoreValue horizontalExtendScore,
+                     TScoreValue verticalExtendScore)
+{
+    TraceBitMap_::TTraceValue traceValue = TraceBitMap_::NONE;
+    if (cell._score == diagonalScore)
+        traceValue |= TraceBitMap_::DIAGONAL;
+    if (cell._score == cell._verticalScore)
+        traceValue |= TraceBitMap_::MAX_FROM_VERTICAL_MATRIX;
+    if (cell._score == cell._horizontalScore)
+        traceValue |= TraceBitMap_::MAX_FROM_HORIZONTAL_MATRIX;
+    // We prefer to extend gaps, the flags mark whether the gap was extended.
+    if (cell._verticalScore == verticalExtendScore)
+        traceValue |= TraceBitMap_::VERTICAL;
+    if (cell._horizontalScore == horizontalExtendScore)
+        traceValue |= TraceBitMap_::HORIZONTAL;
+    traceMatrix[pos] = traceValue;
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeWavefrontTile()
+// ----------------------------------------------------------------------------
+
+// Computes the tile (tileRow, tileColumn) from its upper and left border and
+// writes its lower and right border.  If traceMatrix is a String then the
+// trace values of all inner cells of the tile are stored row by row.
+
+template <typename TScoreValue, typename TSize, typename TSequenceH, typename TSequenceV, typename TScoreSpec,
+          typename TTraceMatrix>
+void _computeWavefrontTile(WavefrontTiles_<TScoreValue> & tiles,
+                           String<WavefrontCell_<TScoreValue> > & rowBuffer,
+                           TTraceMatrix & traceMatrix,
+                           TSequenceH const & seqH,
+                           TSequenceV const & seqV,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           TSize tileRow,
+                           TSize tileColumn)
+{
+    typedef WavefrontCell_<TScoreValue> TCell;
+    typedef typename Iterator<String<TCell>, Standard>::Type TCellIter;
+
+    TSize beginH = tileColumn * tiles.tileSize;
+    TSize endH = _min(beginH + tiles.tileSize, static_cast<TSize>(tiles.lengthH));
+    TSize beginV = tileRow * tiles.tileSize;
+    TSize endV = _min(beginV + tiles.tileSize, static_cast<TSize>(tiles.lengthV));
+    TSize width = endH - beginH;
+
+    TScoreValue const gapOpen = scoreGapOpen(scoringScheme);
+    TScoreValue const gapExtend = scoreGapExtend(scoringScheme);
+
+    TCellIter top = begin(tiles.horizontalBorders, Standard()) + _horizontalBorderOffset(tiles, tileRow, tileColumn);
+    TCellIter bottom = begin(tiles.horizontalBorders, Standard()) +
+                       _horizontalBorderOffset(tiles, tileRow + 1, tileColumn);
+    TCellIter left = begin(tiles.verticalBorders, Standard()) + _verticalBorderOffset(tiles, tileRow, tileColumn);
+    TCellIter right = begin(tiles.verticalBorders, Standard()) +
+                      _verticalBorderOffset(tiles, tileRow, tileColumn + 1);
+
+    // In score-only mode the upper and lower border as well as the left and
+    // the right border share their memory.  Thus, we read the upper border
+    // completely before writing anything.
+    resize(rowBuffer, width + 1, Exact());
+    TCellIter row = begin(rowBuffer, Standard());
+    arrayCopyForward(top, top + width + 1, row);
+    *right = row[width];
+
+    TSize tracePos = 0;
+    for (TSize posV = beginV + 1; posV <= endV; ++posV)
+    {
+        TCell diagonal = row[0];
+        row[0] = left[posV - beginV];
+
+        TCellIter cell = row + 1;
+        for (TSize posH = beginH + 1; posH <= endH; ++posH, ++cell)
+        {
+            TCell up = *cell;
+            TCell const & prev = *(cell - 1);
+
+            TScoreValue horizontalExtend = prev._horizontalScore + gapExtend;
+            TScoreValue verticalExtend = up._verticalScore + gapExtend;
+            TScoreValue diagonalScore = diagonal._score +
+                                        score(scoringScheme,
+                                              sequenceEntryForScore(scoringScheme, seqH, posH - 1),
+                                              sequenceEntryForScore(scoringScheme, seqV, posV - 1));
+
+            cell->_horizontalScore = _max(horizontalExtend, prev._score + gapOpen);
+            cell->_verticalScore = _max(verticalExtend, up._score + gapOpen);
+            cell->_score = _max(diagonalScore, _max(cell->_horizontalScore, cell->_verticalScore));
+            _storeWavefrontTrace(traceMatrix, tracePos++, *cell, diagonalScore, horizontalExtend, verticalExtend);
+
+            diagonal = up;
+        }
+        right[posV - beginV] = row[width];
+    }
+
+    arrayCopyForward(row, row + width + 1, bottom);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeWavefront()
+// ----------------------------------------------------------------------------
+
+// Computes all tiles along the anti-diagonals.  The tiles of one anti-diagonal
+// are computed in parallel.  The threads are started once and synchronize at
+// the implicit barrier of the work-sharing loop after each anti-diagonal.
+
+template <typename TScoreValue, typename TSequenceH, typename TSequenceV, typename TScoreSpec>
+void _computeWavefront(WavefrontTiles_<TScoreValue> & tiles,
+                       TSequenceH const & seqH,
+                       TSequenceV const & seqV,
+                       Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef typename WavefrontTiles_<TScoreValue>::TSize TSize;
+
+    int tileCountH = tiles.tileCountH;
+    int tileCountV = tiles.tileCountV;
+
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        String<WavefrontCell_<TScoreValue> > rowBuffer;
+        Nothing noTrace;
+
+        for (int diagonal = 0; diagonal < tileCountH + tileCountV - 1; ++diagonal)
+        {
+            int firstRow = _max(0, diagonal - tileCountH + 1);
+            int lastRow = _min(diagonal, tileCountV - 1);
+
+            // All tiles of the anti-diagonal must be finished before the next
+            // one starts, the barrier at the end of the loop ensures this.
+            SEQAN_OMP_PRAGMA(for schedule(dynamic, 1))
+            for (int tileRow = firstRow; tileRow <= lastRow; ++tileRow)
+                _computeWavefrontTile(tiles, rowBuffer, noTrace, seqH, seqV, scoringScheme,
+                                      static_cast<TSize>(tileRow), static_cast<TSize>(diagonal - tileRow));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _wavefrontLastRowCell()
+// ----------------------------------------------------------------------------
+
+// Returns the cell (lengthV, posH) after all tiles have been computed.
+
+template <typename TScoreValue, typename TSize>
+inline WavefrontCell_<TScoreValue> const &
+_wavefrontLastRowCell(WavefrontTiles_<TScoreValue> const & tiles, TSize posH)
+{
+    typedef typename WavefrontTiles_<TScoreValue>::TSize TTilesSize;
+
+    TTilesSize tileColumn = (posH == 0u) ? 0u : (posH - 1) / tiles.tileSize;
+    return tiles.horizontalBorders[_horizontalBorderOffset(tiles, tiles.tileCountV, tileColumn) +
+                                   posH - tileColumn * tiles.tileSize];
+}
+
+// ----------------------------------------------------------------------------
+// Function _wavefrontLastColumnCell()
+// ----------------------------------------------------------------------------
+
+// Returns the cell (posV, lengthH) after all tiles have been computed.
+
+template <typename TScoreValue, typename TSize>
+inline WavefrontCell_<TScoreValue> const &
+_wavefrontLastColumnCell(WavefrontTiles_<TScoreValue> const & tiles, TSize posV)
+{
+    typedef typename WavefrontTiles_<TScoreValue>::TSize TTilesSize;
+
+    TTilesSize tileRow = (posV == 0u) ? 0u : (posV - 1) / tiles.tileSize;
+    return tiles.verticalBorders[_verticalBorderOffset(tiles, tileRow, tiles.tileCountH) +
+                                 posV - tileRow * tiles.tileSize];
+}
+
+// ----------------------------------------------------------------------------
+// Function _findWavefrontMaximum()
+// ----------------------------------------------------------------------------
+
+// Finds the end point of the alignment depending on the free end gaps.
+
+template <typename TScoreValue, typename TSize, bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+TScoreValue _findWavefrontMaximum(TSize & endH,
+                                  TSize & endV,
+                                  WavefrontTiles_<TScoreValue> const & tiles,
+                                  AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & /*alignConfig*/)
+{
+    endH = tiles.lengthH;
+    endV = tiles.lengthV;
+    TScoreValue maxScore = _wavefrontLastRowCell(tiles, endH)._score;
+
+    if (BOTTOM)
+        for (TSize posH = 0; posH < tiles.lengthH; ++posH)
+            if (_wavefrontLastRowCell(tiles, posH)._score > maxScore)
+            {
+                maxScore = _wavefrontLastRowCell(tiles, posH)._score;
+                endH = posH;
+                endV = tiles.lengthV;
+            }
+    if (RIGHT)
+        for (TSize posV = 0; posV < tiles.lengthV; ++posV)
+            if (_wavefrontLastColumnCell(tiles, posV)._score > maxScore)
+            {
+                maxScore = _wavefrontLastColumnCell(tiles, posV)._score;
+                endH = tiles.lengthH;
+                endV = posV;
+            }
+    return maxScore;
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeWavefrontTraceback()
+// ----------------------------------------------------------------------------
+
+// Traces back from (endH, endV) to the first row or column.  Each tile on the
+// path is recomputed from its stored borders.  We prefer the diagonal before
+// the vertical before the horizontal direction and extending a gap before
+// opening it, like the traceback of the unbanded DP algorithms.
+
+template <typename TTraceSegments, typename TScoreValue, typename TSize, typename TSequenceH, typename TSequenceV,
+          typename TScoreSpec>
+void _computeWavefrontTraceback(TTraceSegments & target,
+                                WavefrontTiles_<TScoreValue> & tiles,
+                                TSize endH,
+                                TSize endV,
+                                TSequenceH const & seqH,
+                                TSequenceV const & seqV,
+                                Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef TraceBitMap_::TTraceValue TTraceValue;
+
+    TSize lengthH = tiles.lengthH;
+    TSize lengthV = tiles.lengthV;
+
+    // Record trailing gaps.
+    if (endV != lengthV)
+        _recordSegment(target, lengthH, endV, lengthV - endV, +TraceBitMap_::VERTICAL);
+    if (endH != lengthH)
+        _recordSegment(target, endH, endV, lengthH - endH, +TraceBitMap_::HORIZONTAL);
+
+    String<WavefrontCell_<TScoreValue> > rowBuffer;
+    String<TTraceValue> traceMatrix;
+
+    TSize posH = endH;
+    TSize posV = endV;
+    TTraceValue matrix = TraceBitMap_::DIAGONAL;  // DIAGONAL, HORIZONTAL or VERTICAL.
+    TTraceValue lastTraceValue = TraceBitMap_::NONE;
+    TSize fragmentLength = 0;
+
+    while (posH > 0u && posV > 0u)
+    {
+        TSize tileRow = (posV - 1) / tiles.tileSize;
+        TSize tileColumn = (posH - 1) / tiles.tileSize;
+        TSize beginH = tileColumn * tiles.tileSize;
+        TSize beginV = tileRow * tiles.tileSize;
+        TSize width = _min(beginH + tiles.tileSize, lengthH) - beginH;
+
+        resize(traceMatrix, width * (_min(beginV + tiles.tileSize, lengthV) - beginV), Exact());
+        _computeWavefrontTile(tiles, rowBuffer, traceMatrix, seqH, seqV, scoringScheme, tileRow, tileColumn);
+
+        while (posH > beginH && posV > beginV)
+        {
+            TTraceValue traceValue = traceMatrix[(posV - beginV - 1) * width + (posH - beginH - 1)];
+
+            // Switch into the gap matrices without moving.
+            if (matrix == TraceBitMap_::DIAGONAL && !(traceValue & TraceBitMap_::DIAGONAL))
+            {
+                matrix = (traceValue & TraceBitMap_::MAX_FROM_VERTICAL_MATRIX) ?
+                         +TraceBitMap_::VERTICAL : +TraceBitMap_::HORIZONTAL;
+                continue;
+            }
+
+            if (matrix != lastTraceValue)
+            {
+                _recordSegment(target, posH, posV, fragmentLength, lastTraceValue);
+                lastTraceValue = matrix;
+                fragmentLength = 0;
+            }
+
+            if (matrix == TraceBitMap_::DIAGONAL)
+            {
+                --posH;
+                --posV;
+            }
+            else if (matrix == TraceBitMap_::VERTICAL)
+            {
+                if (!(traceValue & TraceBitMap_::VERTICAL))
+                    matrix = TraceBitMap_::DIAGONAL;
+                --posV;
+            }
+            else
+            {
+                if (!(traceValue & TraceBitMap_::HORIZONTAL))
+                    matrix = TraceBitMap_::DIAGONAL;
+                --posH;
+            }
+            ++fragmentLength;
+        }
+    }
+
+    // Record last detected fragment and the leading gaps.
+    _recordSegment(target, posH, posV, fragmentLength, lastTraceValue);
+    if (posV != 0u)
+        _recordSegment(target, 0, 0, posV, +TraceBitMap_::VERTICAL);
+    if (posH != 0u)
+        _recordSegment(target, 0, 0, posH, +TraceBitMap_::HORIZONTAL);
+}
+
+// ----------------------------------------------------------------------------
+// Function _setUpAndRunAlignment()                            [TiledWavefront]
+// ----------------------------------------------------------------------------
+
+// Score only.
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+typename Value<Score<TScoreValue, TScoreSpec> >::Type
+_setUpAndRunAlignment(TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                      AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                      TiledWavefront const & algoTag)
+{
+    typedef typename WavefrontTiles_<TScoreValue>::TSize TSize;
+
+    // Like the other DP algorithms we return the minimal score for empty sequences.
+    if (empty(seqH) || empty(seqV))
+        return MinValue<TScoreValue>::VALUE;
+    _checkSequenceForScore(scoringScheme, seqH);
+
+    WavefrontTiles_<TScoreValue> tiles;
+    _initWavefrontTiles(tiles, static_cast<TSize>(length(seqH)), static_cast<TSize>(length(seqV)),
+                        static_cast<TSize>(algoTag.tileSize), false, scoringScheme, alignConfig);
+    _computeWavefront(tiles, seqH, seqV, scoringScheme);
+
+    TSize endH = 0;
+    TSize endV = 0;
+    return _findWavefrontMaximum(endH, endV, tiles, alignConfig);
+}
+
+// With traceback.
+
+template <typename TTraceSegment, typename TSpec, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpec, bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+typename Value<Score<TScoreValue, TScoreSpec> >::Type
+_setUpAndRunAlignment(String<TTraceSegment, TSpec> & traceSegments,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                      AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                      TiledWavefront const & algoTag)
+{
+    typedef typename WavefrontTiles_<TScoreValue>::TSize TSize;
+
+    // Like the other DP algorithms we return the minimal score for empty sequences.
+    if (empty(seqH) || empty(seqV))
+        return MinValue<TScoreValue>::VALUE;
+    _checkSequenceForScore(scoringScheme, seqH);
+
+    WavefrontTiles_<TScoreValue> tiles;
+    _initWavefrontTiles(tiles, static_cast<TSize>(length(seqH)), static_cast<TSize>(length(seqV)),
+                        static_cast<TSize>(algoTag.tileSize), true, scoringScheme, alignConfig);
+    _computeWavefront(tiles, seqH, seqV, scoringScheme);
+
+    TSize endH = 0;
+    TSize endV = 0;
+    TScoreValue res = _findWavefrontMaximum(endH, endV, tiles, alignConfig);
+    _computeWavefrontTraceback(traceSegments, tiles, endH, endV, seqH, seqV, scoringScheme);
+    return res;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_WAVEFRONT_IMPL_H_
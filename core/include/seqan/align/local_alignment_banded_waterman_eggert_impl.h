@@ -521,6 +521,7 @@ _localAlignment(LocalAlignmentFinder<TScoreValue> & finder,
     clearClipping(gapsH);
     clearGaps(gapsV);
     clearClipping(gapsV);
+    _checkSequenceForScore(sc, source(gapsH));
 
     _initLocalAlignmentFinder(source(gapsH), source(gapsV), finder, BandedWatermanEggert(), diag1, diag2);
     finder.needReinit = false;
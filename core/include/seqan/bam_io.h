@@ -46,6 +46,7 @@
 #include <seqan/sequence.h>
 #include <seqan/stream.h>
 #include <seqan/align.h>
+#include <seqan/parallel.h>
 #include <seqan/misc/misc_name_store_cache.h>
 
 // ===========================================================================
@@ -70,6 +71,7 @@
 #if SEQAN_HAS_ZLIB
 #include <seqan/bam_io/read_bam.h>
 #include <seqan/bam_io/write_bam.h>
+#include <seqan/bam_io/bam_alignment_record_lazy.h>
 #endif  // #if SEQAN_HAS_ZLIB
 
 // ===========================================================================
@@ -92,6 +94,7 @@
 // Easy BAM / SAM I/O.
 // ===========================================================================
 
+#include <seqan/bam_io/sam_parallel.h>
 #include <seqan/bam_io/xam_reader.h>
 #if SEQAN_HAS_ZLIB
 #include <seqan/bam_io/bam_reader.h>
@@ -106,4 +109,12 @@
 
 #include <seqan/bam_io/bam_stream.h>
 
+// ===========================================================================
+// Sorting.
+// ===========================================================================
+
+#if SEQAN_HAS_ZLIB
+#include <seqan/bam_io/bam_sorter.h>
+#endif  // #if SEQAN_HAS_ZLIB
+
 #endif  // CORE_INCLUDE_SEQAN_BAM_IO_H_
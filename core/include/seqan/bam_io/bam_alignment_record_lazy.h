@@ -0,0 +1,689 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// BAM alignment record that keeps the raw BAM bytes and decodes the variable
+// length fields (read name, CIGAR, sequence, qualities, tags) on demand.
+// ==========================================================================
+
+#ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_ALIGNMENT_RECORD_LAZY_H_
+#define CORE_INCLUDE_SEQAN_BAM_IO_BAM_ALIGNMENT_RECORD_LAZY_H_
+
+#include <cstring>
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+class BamLazyAlignmentRecord;
+inline void clear(BamLazyAlignmentRecord & record);
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @class BamLazyAlignmentRecord
+ * @headerfile <seqan/bam_io.h>
+ * @brief BAM alignment record that decodes its variable length fields on first access.
+ *
+ * @signature class BamLazyAlignmentRecord;
+ *
+ * The record stores the raw bytes of a BAM record.  The fixed-size fields (reference id, position, flag, mapping
+ * quality, bin, mate information and template length) are decoded when reading and available as member variables.
+ * The read name, CIGAR string, sequence, qualities and tags are only decoded when they are first requested through
+ * @link BamLazyAlignmentRecord#getQName @endlink, @link BamLazyAlignmentRecord#getCigar @endlink, etc.
+ *
+ * Writing a record to a BAM file copies the raw variable length fields without re-encoding them.  Changes to the
+ * fixed-size member variables are written out, use @link BamLazyAlignmentRecord#assignRecord @endlink to convert
+ * into a @link BamAlignmentRecord @endlink for modifying the other fields.
+ *
+ * @var __int32 BamLazyAlignmentRecord::rID
+ * @brief ID of reference for this fragment mapping (0-based, <tt>INVALID_REFID</tt> for '*').
+ *
+ * @var __int32 BamLazyAlignmentRecord::beginPos
+ * @brief The position of this fragment mapping (0-based, <tt>INVALID_POS</tt> for '*').
+ *
+ * @var __uint16 BamLazyAlignmentRecord::flag
+ * @brief The flag of this mapping, see @link BamFlags @endlink for flag constants.
+ *
+ * @var __uint8 BamLazyAlignmentRecord::mapQ
+ * @brief The mapping quality (255 for '*').
+ *
+ * @var __uint16 BamLazyAlignmentRecord::bin
+ * @brief The bin of the alignment, recomputed on writing if <tt>beginPos</tt> was changed.
+ *
+ * @var __int32 BamLazyAlignmentRecord::rNextId
+ * @brief ID of reference for next fragment mapping (0-based, <tt>INVALID_REFID</tt> for '*').
+ *
+ * @var __int32 BamLazyAlignmentRecord::pNext
+ * @brief Position of next fragment mapping (0-based, <tt>INVALID_POS</tt> for '*').
+ *
+ * @var __int32 BamLazyAlignmentRecord::tLen
+ * @brief The inferred template size (<tt>INVALID_LEN</tt> for '*').
+ */
+
+/**
+.Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:BAM alignment record that decodes its variable length fields on first access.
+..signature:BamLazyAlignmentRecord
+..description:
+The fixed-size fields are available as member variables after reading.
+Read name, CIGAR, sequence, qualities and tags are decoded on first access.
+Unmodified records are written to BAM without re-encoding.
+..include:seqan/bam_io.h
+
+.Memvar.BamLazyAlignmentRecord#rID
+..class:Class.BamLazyAlignmentRecord
+..summary:ID of reference for this fragment mapping (0-based, $INVALID_REFID$ for '*').
+..type:nolink:$__int32$
+
+.Memvar.BamLazyAlignmentRecord#beginPos
+..class:Class.BamLazyAlignmentRecord
+..summary:The position of this fragment mapping (0-based, $INVALID_POS$ for '*').
+..type:nolink:$__int32$
+
+.Memvar.BamLazyAlignmentRecord#flag
+..class:Class.BamLazyAlignmentRecord
+..summary:The flag of this mapping, see @Enum.BamFlags@ for flag constants.
+..type:nolink:$__uint16$
+
+.Memvar.BamLazyAlignmentRecord#mapQ
+..class:Class.BamLazyAlignmentRecord
+..summary:The mapping quality (255 for '*').
+..type:nolink:$__uint8$
+
+.Memvar.BamLazyAlignmentRecord#bin
+..class:Class.BamLazyAlignmentRecord
+..summary:The bin of the alignment, recomputed on writing if $beginPos$ was changed.
+..type:nolink:$__uint16$
+
+.Memvar.BamLazyAlignmentRecord#rNextId
+..class:Class.BamLazyAlignmentRecord
+..summary:ID of reference for next fragment mapping (0-based, $INVALID_REFID$ for '*')
+..type:nolink:$__int32$
+
+.Memvar.BamLazyAlignmentRecord#pNext
+..class:Class.BamLazyAlignmentRecord
+..summary:Position of next fragment mapping (0-based, $INVALID_POS$ for '*')
+..type:nolink:$__int32$
+
+.Memvar.BamLazyAlignmentRecord#tLen
+..class:Class.BamLazyAlignmentRecord
+..summary:The inferred template size ($INVALID_LEN$ for '*')
+..type:nolink:$__int32$
+*/
+
+class BamLazyAlignmentRecord
+{
+public:
+    static __int32 const INVALID_POS = BamAlignmentRecord::INVALID_POS;
+    static __int32 const INVALID_REFID = BamAlignmentRecord::INVALID_REFID;
+    static __int32 const INVALID_LEN = BamAlignmentRecord::INVALID_LEN;
+
+    // Bits of _decoded.
+    static unsigned const DECODED_QNAME = 1;
+    static unsigned const DECODED_CIGAR = 2;
+    static unsigned const DECODED_SEQ = 4;
+    static unsigned const DECODED_QUAL = 8;
+    static unsigned const DECODED_TAGS = 16;
+
+    __uint16 flag;
+    __int32 rID;
+    __int32 beginPos;
+    __uint8 mapQ;
+    __uint16 bin;
+    __int32 rNextId;
+    __int32 pNext;
+    __int32 tLen;
+
+    // The raw BAM record without the leading block_size field.
+    CharString _raw;
+    // Lengths of the variable fields, read from the raw record.
+    __uint8 _lReadName;
+    __uint16 _nCigarOp;
+    __int32 _lSeq;
+    // Position the bin was computed for.
+    __int32 _binPos;
+
+    // Fields decoded on demand and the bit mask of the decoded ones.
+    mutable unsigned _decoded;
+    mutable CharString _qName;
+    mutable String<CigarElement<> > _cigar;
+    mutable CharString _seq;
+    mutable CharString _qual;
+    mutable CharString _tags;
+
+    BamLazyAlignmentRecord()
+    {
+        clear(*this);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+///.Function.clear.param.object.type:Class.BamLazyAlignmentRecord
+///.Function.clear.class:Class.BamLazyAlignmentRecord
+
+inline void
+clear(BamLazyAlignmentRecord & record)
+{
+    record.flag = 0;
+    record.rID = BamLazyAlignmentRecord::INVALID_REFID;
+    record.beginPos = BamLazyAlignmentRecord::INVALID_POS;
+    record.mapQ = 255;
+    record.bin = 0;
+    record.rNextId = BamLazyAlignmentRecord::INVALID_REFID;
+    record.pNext = BamLazyAlignmentRecord::INVALID_POS;
+    record.tLen = BamLazyAlignmentRecord::INVALID_LEN;
+    clear(record._raw);
+    record._lReadName = 0;
+    record._nCigarOp = 0;
+    record._lSeq = 0;
+    record._binPos = record.beginPos;
+    record._decoded = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Functions for the raw record layout
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline TValue
+_bamLazyGet(CharString const & raw, unsigned offset)
+{
+    TValue x;
+    std::memcpy(&x, &raw[offset], sizeof(TValue));
+    return x;
+}
+
+// Offsets of the variable length fields in the raw record.
+
+inline unsigned
+_bamLazyCigarOffset(BamLazyAlignmentRecord const & record)
+{
+    return 32 + record._lReadName;
+}
+
+inline unsigned
+_bamLazySeqOffset(BamLazyAlignmentRecord const & record)
+{
+    return _bamLazyCigarOffset(record) + 4 * record._nCigarOp;
+}
+
+inline unsigned
+_bamLazyQualOffset(BamLazyAlignmentRecord const & record)
+{
+    return _bamLazySeqOffset(record) + (record._lSeq + 1) / 2;
+}
+
+inline unsigned
+_bamLazyTagsOffset(BamLazyAlignmentRecord const & record)
+{
+    return _bamLazyQualOffset(record) + record._lSeq;
+}
+
+// Decode the fixed-size fields from record._raw, returns 1 if the raw record is inconsistent.
+
+inline int
+_parseBamLazyFixedFields(BamLazyAlignmentRecord & record)
+{
+    record._decoded = 0;
+    if (length(record._raw) < 32u)
+        return 1;
+
+    record.rID = _bamLazyGet<__int32>(record._raw, 0);
+    record.beginPos = _bamLazyGet<__int32>(record._raw, 4);
+    __uint32 binMqNl = _bamLazyGet<__uint32>(record._raw, 8);
+    record.bin = binMqNl >> 16;
+    record.mapQ = (binMqNl >> 8) & 0x000000ff;
+    record._lReadName = binMqNl & 0x000000ff;
+    __uint32 flagNc = _bamLazyGet<__uint32>(record._raw, 12);
+    record.flag = flagNc >> 16;
+    record._nCigarOp = flagNc & 0x0000ffff;
+    record._lSeq = _bamLazyGet<__int32>(record._raw, 16);
+    record.rNextId = _bamLazyGet<__int32>(record._raw, 20);
+    record.pNext = _bamLazyGet<__int32>(record._raw, 24);
+    record.tLen = _bamLazyGet<__int32>(record._raw, 28);
+    record._binPos = record.beginPos;
+
+    if (record._lReadName == 0u || record._lSeq < 0 || _bamLazyTagsOffset(record) > length(record._raw))
+        return 1;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function getQName()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#getQName
+ * @brief Return the read name, decoding it on the first call.
+ *
+ * @signature CharString const & getQName(record);
+ *
+ * @param[in] record The BamLazyAlignmentRecord to query.
+ *
+ * @return CharString const & The read/query name.
+ */
+
+/**
+.Function.BamLazyAlignmentRecord#getQName
+..class:Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:Return the read name, decoding it on the first call.
+..signature:getQName(record)
+..param.record:The record to query.
+...type:Class.BamLazyAlignmentRecord
+..returns:The read name as a @Shortcut.CharString@ const reference.
+..include:seqan/bam_io.h
+*/
+
+inline CharString const &
+getQName(BamLazyAlignmentRecord const & record)
+{
+    if (!(record._decoded & BamLazyAlignmentRecord::DECODED_QNAME))
+    {
+        if (record._lReadName > 1u)
+            assign(record._qName, infix(record._raw, 32, 32 + record._lReadName - 1));
+        else
+            clear(record._qName);
+        record._decoded |= BamLazyAlignmentRecord::DECODED_QNAME;
+    }
+    return record._qName;
+}
+
+// ----------------------------------------------------------------------------
+// Function getCigar()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#getCigar
+ * @brief Return the CIGAR string, decoding it on the first call.
+ *
+ * @signature String<CigarElement<> > const & getCigar(record);
+ *
+ * @param[in] record The BamLazyAlignmentRecord to query.
+ *
+ * @return String<CigarElement<> > const & The CIGAR string, empty for '*'.
+ */
+
+/**
+.Function.BamLazyAlignmentRecord#getCigar
+..class:Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:Return the CIGAR string, decoding it on the first call.
+..signature:getCigar(record)
+..param.record:The record to query.
+...type:Class.BamLazyAlignmentRecord
+..returns:The CIGAR string as $String<CigarElement<> > const &$.
+..include:seqan/bam_io.h
+*/
+
+inline String<CigarElement<> > const &
+getCigar(BamLazyAlignmentRecord const & record)
+{
+    if (!(record._decoded & BamLazyAlignmentRecord::DECODED_CIGAR))
+    {
+        static char const * CIGAR_MAPPING = "MIDNSHP=";
+        resize(record._cigar, record._nCigarOp, Exact());
+        unsigned offset = _bamLazyCigarOffset(record);
+        for (unsigned i = 0; i < record._nCigarOp; ++i, offset += 4)
+        {
+            __uint32 ui = _bamLazyGet<__uint32>(record._raw, offset);
+            record._cigar[i].operation = CIGAR_MAPPING[ui & 0x0007];
+            record._cigar[i].count = ui >> 4;
+        }
+        record._decoded |= BamLazyAlignmentRecord::DECODED_CIGAR;
+    }
+    return record._cigar;
+}
+
+// ----------------------------------------------------------------------------
+// Function getSeq()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#getSeq
+ * @brief Return the read sequence, decoding it on the first call.
+ *
+ * @signature CharString const & getSeq(record);
+ *
+ * @param[in] record The BamLazyAlignmentRecord to query.
+ *
+ * @return CharString const & The sequence, empty for '*'.
+ */
+
+/**
+.Function.BamLazyAlignmentRecord#getSeq
+..class:Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:Return the read sequence, decoding it on the first call.
+..signature:getSeq(record)
+..param.record:The record to query.
+...type:Class.BamLazyAlignmentRecord
+..returns:The sequence as a @Shortcut.CharString@ const reference.
+..include:seqan/bam_io.h
+*/
+
+inline CharString const &
+getSeq(BamLazyAlignmentRecord const & record)
+{
+    if (!(record._decoded & BamLazyAlignmentRecord::DECODED_SEQ))
+    {
+        static char const * SEQ_MAPPING = "=ACMGRSVTWYHKDBN";
+        resize(record._seq, record._lSeq, Exact());
+        unsigned offset = _bamLazySeqOffset(record);
+        for (__int32 i = 0; i < record._lSeq; ++i)
+        {
+            __uint8 ui = static_cast<__uint8>(record._raw[offset + i / 2]);
+            record._seq[i] = SEQ_MAPPING[(i % 2 == 0) ? (ui >> 4) : (ui & 0x0f)];
+        }
+        record._decoded |= BamLazyAlignmentRecord::DECODED_SEQ;
+    }
+    return record._seq;
+}
+
+// ----------------------------------------------------------------------------
+// Function getQual()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#getQual
+ * @brief Return the Phred qualities in SAM encoding, decoding them on the first call.
+ *
+ * @signature CharString const & getQual(record);
+ *
+ * @param[in] record The BamLazyAlignmentRecord to query.
+ *
+ * @return CharString const & The qualities, empty for '*'.
+ */
+
+/**
+.Function.BamLazyAlignmentRecord#getQual
+..class:Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:Return the Phred qualities in SAM encoding, decoding them on the first call.
+..signature:getQual(record)
+..param.record:The record to query.
+...type:Class.BamLazyAlignmentRecord
+..returns:The qualities as a @Shortcut.CharString@ const reference.
+..include:seqan/bam_io.h
+*/
+
+inline CharString const &
+getQual(BamLazyAlignmentRecord const & record)
+{
+    if (!(record._decoded & BamLazyAlignmentRecord::DECODED_QUAL))
+    {
+        unsigned offset = _bamLazyQualOffset(record);
+        // A sequence of 0xff represents '*', only the first byte is checked (same as samtools).
+        if (record._lSeq > 0 && record._raw[offset] != '\xFF')
+        {
+            assign(record._qual, infix(record._raw, offset, offset + record._lSeq));
+            typedef Iterator<CharString, Rooted>::Type TQualIter;
+            for (TQualIter it = begin(record._qual, Rooted()); !atEnd(it); goNext(it))
+                *it += '!';
+        }
+        else
+        {
+            clear(record._qual);
+        }
+        record._decoded |= BamLazyAlignmentRecord::DECODED_QUAL;
+    }
+    return record._qual;
+}
+
+// ----------------------------------------------------------------------------
+// Function getTags()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#getTags
+ * @brief Return the raw BAM tags string, copying it out of the raw record on the first call.
+ *
+ * @signature CharString const & getTags(record);
+ *
+ * @param[in] record The BamLazyAlignmentRecord to query.
+ *
+ * @return CharString const & The raw BAM tag string, use @link BamTagsDict @endlink for accessing it.
+ */
+
+/**
+.Function.BamLazyAlignmentRecord#getTags
+..class:Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:Return the raw BAM tags string, copying it out of the raw record on the first call.
+..signature:getTags(record)
+..param.record:The record to query.
+...type:Class.BamLazyAlignmentRecord
+..returns:The raw BAM tags as a @Shortcut.CharString@ const reference, see @Class.BamTagsDict@.
+..include:seqan/bam_io.h
+*/
+
+inline CharString const &
+getTags(BamLazyAlignmentRecord const & record)
+{
+    if (!(record._decoded & BamLazyAlignmentRecord::DECODED_TAGS))
+    {
+        assign(record._tags, suffix(record._raw, _bamLazyTagsOffset(record)));
+        record._decoded |= BamLazyAlignmentRecord::DECODED_TAGS;
+    }
+    return record._tags;
+}
+
+// ----------------------------------------------------------------------------
+// Function assignRecord()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#assignRecord
+ * @brief Convert between @link BamLazyAlignmentRecord @endlink and @link BamAlignmentRecord @endlink.
+ *
+ * @signature void assignRecord(target, source);
+ *
+ * @param[out] target The record to assign to.
+ * @param[in]  source The record to convert, a @link BamLazyAlignmentRecord @endlink if <tt>target</tt> is a
+ *                    @link BamAlignmentRecord @endlink and vice versa.
+ */
+
+/**
+.Function.BamLazyAlignmentRecord#assignRecord
+..class:Class.BamLazyAlignmentRecord
+..cat:BAM I/O
+..summary:Convert between @Class.BamLazyAlignmentRecord@ and @Class.BamAlignmentRecord@.
+..signature:assignRecord(target, source)
+..param.target:The record to assign to.
+...type:Class.BamLazyAlignmentRecord
+...type:Class.BamAlignmentRecord
+..param.source:The record to convert.
+...type:Class.BamLazyAlignmentRecord
+...type:Class.BamAlignmentRecord
+..include:seqan/bam_io.h
+*/
+
+inline void
+assignRecord(BamAlignmentRecord & target, BamLazyAlignmentRecord const & source)
+{
+    target.qName = getQName(source);
+    target.flag = source.flag;
+    target.rID = source.rID;
+    target.beginPos = source.beginPos;
+    target.mapQ = source.mapQ;
+    target.bin = source.bin;
+    target.cigar = getCigar(source);
+    target.rNextId = source.rNextId;
+    target.pNext = source.pNext;
+    target.tLen = source.tLen;
+    target.seq = getSeq(source);
+    target.qual = getQual(source);
+    target.tags = getTags(source);
+}
+
+inline void
+assignRecord(BamLazyAlignmentRecord & target, BamAlignmentRecord const & source)
+{
+    clear(target._raw);
+    _writeBamRecordBody(target._raw, source);
+    _parseBamLazyFixedFields(target);
+
+    // Keep the values of the source, the encoding maps INVALID_LEN to 0 and computes the bin.
+    target.rID = source.rID;
+    target.tLen = source.tLen;
+    target._binPos = target.beginPos;
+}
+
+// ----------------------------------------------------------------------------
+// Function readRecord()                                                    Bam
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#readRecord
+ * @brief Read the raw bytes of a BAM record and decode its fixed-size fields.
+ *
+ * @signature int readRecord(record, context, stream, tag);
+ *
+ * @param[out]    record  The @link BamLazyAlignmentRecord @endlink to read into.
+ * @param[in,out] context The @link BamIOContext @endlink to use.
+ * @param[in,out] stream  The @link StreamConcept Stream @endlink to read from.
+ * @param[in]     tag     The format tag, only <tt>Bam</tt> is supported.
+ *
+ * @return int A status code, 0 on success, != 0 on failure.
+ */
+
+template <typename TStream, typename TNameStore, typename TNameStoreCache>
+int readRecord(BamLazyAlignmentRecord & record,
+               BamIOContext<TNameStore, TNameStoreCache> & context,
+               TStream & stream,
+               Bam const & /*tag*/)
+{
+    (void)context;  // Only used for assertions.
+
+    // Read size of the remaining block and the block itself.
+    __int32 blockSize = 0;
+    if (streamReadBlock(reinterpret_cast<char *>(&blockSize), stream, 4) != 4)
+        return 1;
+    if (blockSize < 32)
+        return 1;
+    resize(record._raw, blockSize, Exact());
+    if (streamReadBlock(&record._raw[0], stream, blockSize) != static_cast<size_t>(blockSize))
+        return 1;
+
+    if (_parseBamLazyFixedFields(record) != 0)
+        return 1;
+
+    // Translate file local rID into a global rID that is compatible with the context nameStore.
+    if (record.rID >= 0 && !empty(context.translateFile2GlobalRefId))
+        record.rID = context.translateFile2GlobalRefId[record.rID];
+    if (record.rID >= 0)
+        SEQAN_ASSERT_LT(static_cast<__uint64>(record.rID), length(nameStore(context)));
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function write2()                                                        Bam
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamLazyAlignmentRecord#write2
+ * @brief Write a BamLazyAlignmentRecord to a BAM file.
+ *
+ * @signature int write2(stream, record, context, tag);
+ *
+ * @param[in,out] stream  The @link StreamConcept Stream @endlink to write to.
+ * @param[in]     record  The @link BamLazyAlignmentRecord @endlink to write out.
+ * @param[in,out] context The @link BamIOContext @endlink to use.
+ * @param[in]     tag     The format tag, only <tt>Bam</tt> is supported.
+ *
+ * @return int A status code, 0 on success, != 0 on failure.
+ *
+ * @section Remarks
+ *
+ * The fixed-size fields are written from the member variables, everything else is copied from the raw record
+ * without re-encoding.
+ */
+
+template <typename TStream, typename TNameStore, typename TNameStoreCache>
+int write2(TStream & stream,
+           BamLazyAlignmentRecord const & record,
+           BamIOContext<TNameStore, TNameStoreCache> const & /*context*/,
+           Bam const & /*tag*/)
+{
+    SEQAN_ASSERT_GEQ(length(record._raw), 32u);
+
+    // Only compute the bin again if the alignment was moved.
+    __uint32 bin = record.bin;
+    if (record.beginPos != record._binPos)
+    {
+        unsigned l = 0;
+        _getLengthInRef(getCigar(record), l);
+        bin = _reg2Bin(record.beginPos, record.beginPos + l);
+    }
+
+    __int32 fixed[8];
+    fixed[0] = record.rID;
+    fixed[1] = record.beginPos;
+    fixed[2] = (bin << 16) | (record.mapQ << 8) | record._lReadName;
+    fixed[3] = (static_cast<__uint32>(record.flag) << 16) | record._nCigarOp;
+    fixed[4] = record._lSeq;
+    fixed[5] = record.rNextId;
+    fixed[6] = record.pNext;
+    fixed[7] = (record.tLen == BamLazyAlignmentRecord::INVALID_LEN) ? 0 : record.tLen;
+
+    __uint32 blockSize = length(record._raw);
+    if (streamWriteBlock(stream, reinterpret_cast<char const *>(&blockSize), 4) != 4u)
+        return 1;
+    if (streamWriteBlock(stream, reinterpret_cast<char const *>(&fixed[0]), 32) != 32u)
+        return 1;
+    if (blockSize == 32u)
+        return 0;
+    return streamWriteBlock(stream, &record._raw[32], blockSize - 32) != blockSize - 32;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_ALIGNMENT_RECORD_LAZY_H_
@@ -55,6 +55,53 @@ namespace seqan {
 // Functions
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Helper Function _lexicalCastSam2()
+// ----------------------------------------------------------------------------
+
+// Parse a decimal integer with an optional leading '-'.  Same interface as lexicalCast2() but without going through a
+// std::stringstream.
+
+template <typename TTarget, typename TSource>
+inline bool _lexicalCastSam2(TTarget & target, TSource const & source)
+{
+    typedef typename Iterator<TSource const, Standard>::Type TIter;
+
+    TIter it = begin(source, Standard());
+    TIter itEnd = end(source, Standard());
+    bool negative = (it != itEnd && *it == '-');
+    if (negative)
+        ++it;
+    if (it == itEnd)
+        return false;
+
+    __int64 x = 0;
+    for (; it != itEnd; ++it)
+    {
+        if (*it < '0' || *it > '9')
+            return false;
+        x = 10 * x + (*it - '0');
+    }
+    target = static_cast<TTarget>(negative ? -x : x);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _lexicalCastSam()
+// ----------------------------------------------------------------------------
+
+// Same as lexicalCast() for integers, see _lexicalCastSam2().
+
+template <typename TTarget, typename TSource>
+inline TTarget _lexicalCastSam(TSource const & source)
+{
+    TTarget dest = 0;
+    bool b = _lexicalCastSam2(dest, source);
+    SEQAN_ASSERT(b);
+    (void)b;
+    return dest;
+}
+
 // ----------------------------------------------------------------------------
 // Function assignTagsSamToBam()
 // ----------------------------------------------------------------------------
@@ -91,7 +138,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
             res = readUntilTabOrLineBreak(buffer, reader);
             SEQAN_ASSERT(res == 0 || res == EOF_BEFORE_SUCCESS);
             __int32 x = 0;
-            bool b = lexicalCast2<__int32>(x, buffer);
+            bool b = _lexicalCastSam2<__int32>(x, buffer);
             (void)b;
             SEQAN_ASSERT(b);
             char const * ptr = reinterpret_cast<char const *>(&x);
@@ -163,7 +210,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
                     for (; !atEnd(it) && *it != ',' && *it != '\t'; goNext(it))
                         appendValue(buffer2, *it);
                     __int16 x = 0;  // short to avoid textual interpretation in lexicalCast<> below.
-                    bool b = lexicalCast2<__int16>(x, buffer2);
+                    bool b = _lexicalCastSam2<__int16>(x, buffer2);
                     (void)b;
                     SEQAN_ASSERT(b);
                     appendValue(target, static_cast<__int8>(x));
@@ -181,7 +228,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
                     for (; !atEnd(it) && *it != ',' && *it != '\t'; goNext(it))
                         appendValue(buffer2, *it);
                     __uint16 x = 0;  // short to avoid textual interpretation in lexicalCast<> below.
-                    bool b = lexicalCast2<__uint16>(x, buffer2);
+                    bool b = _lexicalCastSam2<__uint16>(x, buffer2);
                     (void)b;
                     SEQAN_ASSERT(b);
                     appendValue(target, static_cast<__int8>(x));
@@ -199,7 +246,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
                     for (; !atEnd(it) && *it != ',' && *it != '\t'; goNext(it))
                         appendValue(buffer2, *it);
                     __int16 x = 0;
-                    bool b = lexicalCast2<__int16>(x, buffer2);
+                    bool b = _lexicalCastSam2<__int16>(x, buffer2);
                     (void)b;
                     SEQAN_ASSERT(b);
                     char const * ptr = reinterpret_cast<char const *>(&x);  // write out byte-wise
@@ -219,7 +266,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
                     for (; !atEnd(it) && *it != ',' && *it != '\t'; goNext(it))
                         appendValue(buffer2, *it);
                     __uint16 x = 0;
-                    bool b = lexicalCast2<__uint16>(x, buffer2);
+                    bool b = _lexicalCastSam2<__uint16>(x, buffer2);
                     (void)b;
                     SEQAN_ASSERT(b);
                     char const * ptr = reinterpret_cast<char const *>(&x);  // write out byte-wise
@@ -239,7 +286,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
                     for (; !atEnd(it) && *it != ',' && *it != '\t'; goNext(it))
                         appendValue(buffer2, *it);
                     __int32 x = 0;
-                    bool b = lexicalCast2<__int32>(x, buffer2);
+                    bool b = _lexicalCastSam2<__int32>(x, buffer2);
                     (void)b;
                     SEQAN_ASSERT(b);
                     char const * ptr = reinterpret_cast<char const *>(&x);  // write out byte-wise
@@ -259,7 +306,7 @@ void _assignTagsSamToBamOneTag(TTarget & target, TRecordReader & reader, CharStr
                     for (; !atEnd(it) && *it != ',' && *it != '\t'; goNext(it))
                         appendValue(buffer2, *it);
                     __uint32 x = 0;
-                    bool b = lexicalCast2<__uint32>(x, buffer2);
+                    bool b = _lexicalCastSam2<__uint32>(x, buffer2);
                     (void)b;
                     SEQAN_ASSERT(b);
                     char const * ptr = reinterpret_cast<char const *>(&x);  // write out byte-wise
@@ -356,6 +403,55 @@ void assignTagsSamToBam(TTarget & target, TSource & source)
     }
 }
 
+// ----------------------------------------------------------------------------
+// Helper Function _appendSamInteger()
+// ----------------------------------------------------------------------------
+
+// Append the decimal representation of x to target, without going through snprintf().
+
+template <typename TTarget, typename TInteger>
+inline void _appendSamInteger(TTarget & target, TInteger x)
+{
+    typedef typename MakeUnsigned<TInteger>::Type TUnsigned;
+
+    char buffer[24];
+    char * ptr = buffer + sizeof(buffer);
+    bool negative = (x < static_cast<TInteger>(0));
+    TUnsigned u = negative ? static_cast<TUnsigned>(-static_cast<TUnsigned>(x)) : static_cast<TUnsigned>(x);
+    do
+    {
+        *--ptr = '0' + static_cast<char>(u % 10);
+        u /= 10;
+    }
+    while (u != 0u);
+    if (negative)
+        *--ptr = '-';
+
+    size_t oldLength = length(target);
+    resize(target, oldLength + (buffer + sizeof(buffer) - ptr));
+    std::copy(ptr, buffer + sizeof(buffer), begin(target, Standard()) + oldLength);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _appendSamFloat()
+// ----------------------------------------------------------------------------
+
+// Append x to target as formatted by "%g".  Integral values with up to six digits are the common case and are
+// formatted as integers, this gives the same text as "%g".
+
+template <typename TTarget>
+inline void _appendSamFloat(TTarget & target, float x)
+{
+    if (x != 0.0f && x > -1e6f && x < 1e6f && x == static_cast<float>(static_cast<__int32>(x)))
+    {
+        _appendSamInteger(target, static_cast<__int32>(x));
+        return;
+    }
+    char buffer[32];
+    snprintf(buffer, 32, "%g", x);
+    append(target, buffer);
+}
+
 // ----------------------------------------------------------------------------
 // Function assignTagsBamToSam()
 // ----------------------------------------------------------------------------
@@ -395,18 +491,14 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
         {
             SEQAN_ASSERT_NOT(atEnd(it));
             __int8 x = *it++;
-            char buffer[4];
-            snprintf(buffer, 4, "%d", x);
-            append(target, buffer);
+            _appendSamInteger(target, x);
         }
         break;
     case 'C':
         {
             SEQAN_ASSERT_NOT(atEnd(it));
-            char buffer[4];
             __uint8 x = *it++;
-            snprintf(buffer, 4, "%u", x);
-            append(target, buffer);
+            _appendSamInteger(target, x);
         }
         break;
     case 's':
@@ -418,9 +510,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 SEQAN_ASSERT_NOT(atEnd(it));
                 *ptr++ = *it++;
             }
-            char buffer[32];
-            snprintf(buffer, 32, "%d", x);
-            append(target, buffer);
+            _appendSamInteger(target, x);
         }
         break;
     case 'S':
@@ -432,9 +522,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 SEQAN_ASSERT_NOT(atEnd(it));
                 *ptr++ = *it++;
             }
-            char buffer[32];
-            snprintf(buffer, 32, "%u", x);
-            append(target, buffer);
+            _appendSamInteger(target, x);
         }
         break;
     case 'i':
@@ -446,9 +534,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 SEQAN_ASSERT_NOT(atEnd(it));
                 *ptr++ = *it++;
             }
-            char buffer[32];
-            snprintf(buffer, 32, "%d", x);
-            append(target, buffer);
+            _appendSamInteger(target, x);
         }
         break;
     case 'I':
@@ -460,9 +546,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 SEQAN_ASSERT_NOT(atEnd(it));
                 *ptr++ = *it++;
             }
-            char buffer[32];
-            snprintf(buffer, 32, "%u", x);
-            append(target, buffer);
+            _appendSamInteger(target, x);
         }
         break;
     case 'f':
@@ -474,9 +558,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 SEQAN_ASSERT_NOT(atEnd(it));
                 *ptr++ = *it++;
             }
-            char buffer[32];
-            snprintf(buffer, 32, "%g", x);
-            append(target, buffer);
+            _appendSamFloat(target, x);
         }
         break;
     case 'Z':
@@ -523,9 +605,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 {
                     appendValue(target, ',');
                     __int8 y = *it++;
-                    char buffer[32];
-                    snprintf(buffer, 32, "%d", y);
-                    append(target, buffer);
+                    _appendSamInteger(target, y);
                 }
                 break;
             case 'C':
@@ -533,9 +613,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                 {
                     appendValue(target, ',');
                     __uint8 y = *it++;
-                    char buffer[32];
-                    snprintf(buffer, 32, "%u", y);
-                    append(target, buffer);
+                    _appendSamInteger(target, y);
                 }
                 break;
             case 's':
@@ -549,9 +627,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                         SEQAN_ASSERT_NOT(atEnd(it));
                         *ptr++ = *it++;
                     }
-                    char buffer[32];
-                    snprintf(buffer, 32, "%d", y);
-                    append(target, buffer);
+                    _appendSamInteger(target, y);
                 }
                 break;
             case 'S':
@@ -565,9 +641,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                         SEQAN_ASSERT_NOT(atEnd(it));
                         *ptr++ = *it++;
                     }
-                    char buffer[32];
-                    snprintf(buffer, 32, "%d", y);
-                    append(target, buffer);
+                    _appendSamInteger(target, y);
                 }
                 break;
             case 'i':
@@ -581,9 +655,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                         SEQAN_ASSERT_NOT(atEnd(it));
                         *ptr++ = *it++;
                     }
-                    char buffer[32];
-                    snprintf(buffer, 32, "%d", y);
-                    append(target, buffer);
+                    _appendSamInteger(target, y);
                 }
                 break;
             case 'I':
@@ -597,9 +669,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                         SEQAN_ASSERT_NOT(atEnd(it));
                         *ptr++ = *it++;
                     }
-                    char buffer[32];
-                    snprintf(buffer, 32, "%u", y);
-                    append(target, buffer);
+                    _appendSamInteger(target, y);
                 }
                 break;
             case 'f':
@@ -613,9 +683,7 @@ void _assignTagsBamToSamOneTag(TTarget & target, TSourceIter & it)
                         SEQAN_ASSERT_NOT(atEnd(it));
                         *ptr++ = *it++;
                     }
-                    char buffer[32];
-                    snprintf(buffer, 32, "%g", y);
-                    append(target, buffer);
+                    _appendSamFloat(target, y);
                 }
                 break;
             default:
@@ -0,0 +1,697 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// External-memory sorting of BAM alignment records by coordinate or by
+// query name.
+// ==========================================================================
+
+#ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_SORTER_H_
+#define CORE_INCLUDE_SEQAN_BAM_IO_BAM_SORTER_H_
+
+#include <algorithm>
+#include <cstring>
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+class BamSorter;
+inline void clear(BamSorter & sorter);
+inline int _compactBamSorterRuns(BamSorter & sorter);
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/*!
+ * @class BamSorter
+ * @headerfile <seqan/bam_io.h>
+ * @brief Sorts BAM alignment records by coordinate or query name using bounded memory.
+ *
+ * @signature class BamSorter;
+ *
+ * Records are added with @link BamSorter#push @endlink and buffered until the buffered records take up more than
+ * <tt>memoryLimit</tt> bytes.  The buffer is then split into one slice per thread, the slices are sorted in parallel
+ * and each of them is written to a temporary BGZF compressed file (a run).  @link BamSorter#writeRecords @endlink
+ * merges the runs and the remaining buffered records and writes them to a @link BamStream @endlink.  Whenever the last
+ * <tt>maxMergeRuns</tt> runs went through the same number of merge passes, they are merged into one larger run.  This
+ * bounds the number of open temporary files and each record is merged a logarithmic number of times.
+ *
+ * The sort is stable, records that compare equal are written in the order they were pushed.  In coordinate order,
+ * records are sorted by reference id, position and strand, unmapped records without reference come last.  In query
+ * name order, records are sorted by name and records of the first segment precede records of the last segment.
+ *
+ * The temporary files are created with <tt>openTemp</tt> and are removed automatically.
+ *
+ * @var BamSortOrder BamSorter::order
+ * @brief The sort order, <tt>BAM_SORT_COORDINATE</tt> (default) or <tt>BAM_SORT_QUERYNAME</tt>.
+ *
+ * @var __uint64 BamSorter::memoryLimit
+ * @brief Approximate number of bytes of records that are buffered before a run is written, defaults to 512 MiB.
+ *
+ * @var unsigned BamSorter::numThreads
+ * @brief Number of threads for sorting, writing and merging runs, defaults to <tt>omp_get_max_threads()</tt>.
+ *
+ * @var unsigned BamSorter::maxMergeRuns
+ * @brief Maximal number of runs that are merged at once, defaults to 64.
+ */
+
+/**
+.Class.BamSorter
+..cat:BAM I/O
+..summary:Sorts BAM alignment records by coordinate or query name using bounded memory.
+..signature:BamSorter
+..description:
+Records are buffered until they take up more than $memoryLimit$ bytes.
+The buffer is then sorted in parallel slices and written to temporary BGZF compressed files (runs).
+@Function.BamSorter#writeRecords@ merges the runs and writes the records to a @Class.BamStream@.
+The sort is stable.
+..include:seqan/bam_io.h
+
+.Memvar.BamSorter#order
+..class:Class.BamSorter
+..summary:The sort order, $BAM_SORT_COORDINATE$ (default) or $BAM_SORT_QUERYNAME$.
+..type:Enum.BamSortOrder
+
+.Memvar.BamSorter#memoryLimit
+..class:Class.BamSorter
+..summary:Approximate number of bytes of records that are buffered before a run is written, defaults to 512 MiB.
+..type:nolink:$__uint64$
+
+.Memvar.BamSorter#numThreads
+..class:Class.BamSorter
+..summary:Number of threads for sorting, writing and merging runs.
+..type:nolink:$unsigned$
+
+.Memvar.BamSorter#maxMergeRuns
+..class:Class.BamSorter
+..summary:Maximal number of runs that are merged at once, defaults to 64.
+..type:nolink:$unsigned$
+*/
+
+class BamSorter
+{
+public:
+    typedef StringSet<CharString>       TNameStore;
+    typedef NameStoreCache<TNameStore>  TNameStoreCache;
+    typedef BamIOContext<TNameStore>    TBamIOContext;
+    typedef File<Sync<> >               TFile;
+
+    BamSortOrder order;
+    __uint64 memoryLimit;
+    unsigned numThreads;
+    unsigned maxMergeRuns;
+
+    // Buffered records, only the first _bufferLength entries are used so the records are reused.
+    String<BamAlignmentRecord> _buffer;
+    size_t _bufferLength;
+    // Approximate memory used by the buffered records.
+    __uint64 _bufferSize;
+    // Largest reference id pushed, the runs are read back with a name store of this size.
+    __int32 _maxRId;
+
+    // Temporary files with the sorted runs, in the order they were written, and the number of merge passes each run
+    // went through.
+    String<TFile> _runs;
+    String<unsigned> _runLevels;
+
+    // Context for reading and writing the runs.
+    TNameStore      _nameStore;
+    TNameStoreCache _nameStoreCache;
+    TBamIOContext   _context;
+
+    BamSorter(BamSortOrder order_ = BAM_SORT_COORDINATE, __uint64 memoryLimit_ = 512 * 1024 * 1024) :
+        order(order_), memoryLimit(memoryLimit_), numThreads(omp_get_max_threads()), maxMergeRuns(64),
+        _bufferLength(0), _bufferSize(0), _maxRId(-1),
+        _nameStoreCache(_nameStore), _context(_nameStore, _nameStoreCache)
+    {}
+
+    ~BamSorter()
+    {
+        clear(*this);
+    }
+
+private:
+    BamSorter(BamSorter const &);
+    BamSorter & operator=(BamSorter const &);
+};
+
+// ----------------------------------------------------------------------------
+// Class BamSorterLess_
+// ----------------------------------------------------------------------------
+
+// Compares records in the order of the sorter.
+
+struct BamSorterLess_
+{
+    BamSortOrder order;
+
+    BamSorterLess_(BamSortOrder order_) : order(order_)
+    {}
+
+    inline bool operator()(BamAlignmentRecord const & a, BamAlignmentRecord const & b) const
+    {
+        if (order == BAM_SORT_QUERYNAME)
+        {
+            size_t lenA = length(a.qName);
+            size_t lenB = length(b.qName);
+            size_t len = std::min(lenA, lenB);
+            int cmp = (len == 0u) ? 0 : std::memcmp(&a.qName[0], &b.qName[0], len);
+            if (cmp != 0)
+                return cmp < 0;
+            if (lenA != lenB)
+                return lenA < lenB;
+            return (a.flag & (BAM_FLAG_FIRST | BAM_FLAG_LAST)) < (b.flag & (BAM_FLAG_FIRST | BAM_FLAG_LAST));
+        }
+
+        // The unsigned casts sort records without reference or position last.
+        if (a.rID != b.rID)
+            return (__uint32)a.rID < (__uint32)b.rID;
+        if (a.beginPos != b.beginPos)
+            return (__uint32)a.beginPos < (__uint32)b.beginPos;
+        return hasFlagRC(a) < hasFlagRC(b);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class BamSorterIndexLess_
+// ----------------------------------------------------------------------------
+
+// Compares positions in the record buffer, for sorting a permutation instead of moving the records.
+
+struct BamSorterIndexLess_
+{
+    String<BamAlignmentRecord> const & records;
+    BamSorterLess_ less;
+
+    BamSorterIndexLess_(String<BamAlignmentRecord> const & records_, BamSortOrder order) :
+        records(records_), less(order)
+    {}
+
+    inline bool operator()(size_t a, size_t b) const
+    {
+        return less(records[a], records[b]);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamSorter#clear
+ * @brief Remove all records and temporary files from the sorter.
+ *
+ * @signature void clear(sorter);
+ *
+ * @param[in,out] sorter The BamSorter to clear.
+ */
+
+/**
+.Function.BamSorter#clear
+..class:Class.BamSorter
+..cat:BAM I/O
+..summary:Remove all records and temporary files from the sorter.
+..signature:clear(sorter)
+..param.sorter:The BamSorter to clear.
+...type:Class.BamSorter
+..include:seqan/bam_io.h
+*/
+
+inline void clear(BamSorter & sorter)
+{
+    for (unsigned i = 0; i < length(sorter._runs); ++i)
+        close(sorter._runs[i]);
+    clear(sorter._runs);
+    clear(sorter._runLevels);
+    sorter._bufferLength = 0;
+    sorter._bufferSize = 0;
+    sorter._maxRId = -1;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bamSorterRecordSize()
+// ----------------------------------------------------------------------------
+
+// Approximate number of bytes a buffered record takes up.
+
+inline __uint64 _bamSorterRecordSize(BamAlignmentRecord const & record)
+{
+    return sizeof(BamAlignmentRecord) + length(record.qName) + length(record.cigar) * sizeof(CigarElement<>) +
+           length(record.seq) + length(record.qual) + length(record.tags);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _sortBamSorterSlices()
+// ----------------------------------------------------------------------------
+
+// Fill perm with the positions of the buffered records, split it into up to numThreads slices and sort each slice
+// with its own thread.  sliceBegins gets the slice boundaries, including the end.
+
+inline void _sortBamSorterSlices(String<size_t> & perm, String<size_t> & sliceBegins, BamSorter const & sorter)
+{
+    size_t n = sorter._bufferLength;
+    resize(perm, n, Exact());
+    for (size_t i = 0; i < n; ++i)
+        perm[i] = i;
+
+    size_t numSlices = std::max((size_t)1, std::min((size_t)sorter.numThreads, n));
+    resize(sliceBegins, numSlices + 1, Exact());
+    for (size_t i = 0; i <= numSlices; ++i)
+        sliceBegins[i] = n * i / numSlices;
+
+    BamSorterIndexLess_ less(sorter._buffer, sorter.order);
+    SEQAN_OMP_PRAGMA(parallel for num_threads(sorter.numThreads) schedule(dynamic))
+    for (int i = 0; i < (int)numSlices; ++i)
+        std::stable_sort(begin(perm, Standard()) + sliceBegins[i], begin(perm, Standard()) + sliceBegins[i + 1],
+                         less);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _openBamSorterRun()
+// ----------------------------------------------------------------------------
+
+// Create a temporary file for a run and attach a BGZF stream for writing to it.  Runs are temporary, so the
+// fastest compression level is used.
+
+inline bool _openBamSorterRun(BamSorter::TFile & file, Stream<Bgzf> & stream)
+{
+    if (!openTemp(file))
+        return false;
+    attachToFile(stream, file.handle, OPEN_WRONLY);
+    stream._compressLevel = 1;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _spillBamSorterBuffer()
+// ----------------------------------------------------------------------------
+
+// Sort the buffered records and write each sorted slice to a new run.  The slices are written in parallel.  Runs
+// are compacted afterwards.
+
+inline int _spillBamSorterBuffer(BamSorter & sorter)
+{
+    if (sorter._bufferLength == 0u)
+        return 0;
+
+    String<size_t> perm;
+    String<size_t> sliceBegins;
+    _sortBamSorterSlices(perm, sliceBegins, sorter);
+
+    // Creating temporary files changes the umask, so this is done sequentially.
+    int numSlices = length(sliceBegins) - 1;
+    size_t firstRun = length(sorter._runs);
+    resize(sorter._runs, firstRun + numSlices);
+    resize(sorter._runLevels, firstRun + numSlices, 0);
+    String<Stream<Bgzf> > streams;
+    resize(streams, numSlices);
+    for (int i = 0; i < numSlices; ++i)
+        if (!_openBamSorterRun(sorter._runs[firstRun + i], streams[i]))
+            return 1;
+
+    int error = 0;
+    SEQAN_OMP_PRAGMA(parallel for num_threads(sorter.numThreads) schedule(dynamic) reduction(|:error))
+    for (int i = 0; i < numSlices; ++i)
+    {
+        for (size_t j = sliceBegins[i]; j < sliceBegins[i + 1] && error == 0; ++j)
+            error |= write2(streams[i], sorter._buffer[perm[j]], sorter._context, Bam());
+        error |= streamFlush(streams[i]) != 0;
+    }
+
+    sorter._bufferLength = 0;
+    sorter._bufferSize = 0;
+    if (error != 0)
+        return 1;
+    return _compactBamSorterRuns(sorter);
+}
+
+// ----------------------------------------------------------------------------
+// Function push()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamSorter#push
+ * @brief Add a record to the sorter.
+ *
+ * @signature int push(sorter, record);
+ *
+ * @param[in,out] sorter The BamSorter to add the record to.
+ * @param[in]     record The @link BamAlignmentRecord @endlink to add.
+ *
+ * @return int 0 on success, 1 if writing a run failed.
+ *
+ * If the buffered records exceed the memory limit, they are sorted and written to temporary runs.
+ */
+
+/**
+.Function.BamSorter#push
+..class:Class.BamSorter
+..cat:BAM I/O
+..summary:Add a record to the sorter.
+..signature:push(sorter, record)
+..param.sorter:The BamSorter to add the record to.
+...type:Class.BamSorter
+..param.record:The record to add.
+...type:Class.BamAlignmentRecord
+..returns:$0$ on success, $1$ if writing a run failed.
+..remarks:If the buffered records exceed the memory limit, they are sorted and written to temporary runs.
+..include:seqan/bam_io.h
+*/
+
+inline int push(BamSorter & sorter, BamAlignmentRecord const & record)
+{
+    if (sorter._bufferLength == length(sorter._buffer))
+        resize(sorter._buffer, sorter._bufferLength + 1, Generous());
+    sorter._buffer[sorter._bufferLength++] = record;
+    sorter._bufferSize += _bamSorterRecordSize(record);
+    sorter._maxRId = std::max(sorter._maxRId, std::max(record.rID, record.rNextId));
+
+    if (sorter._bufferSize > sorter.memoryLimit)
+        return _spillBamSorterBuffer(sorter);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _writeBamSorterRecord()
+// ----------------------------------------------------------------------------
+
+inline int _writeBamSorterRecord(BamStream & bamIO, BamAlignmentRecord const & record, BamSorter const & /*sorter*/)
+{
+    return writeRecord(bamIO, record);
+}
+
+inline int _writeBamSorterRecord(Stream<Bgzf> & stream, BamAlignmentRecord const & record, BamSorter const & sorter)
+{
+    return write2(stream, record, sorter._context, Bam());
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bamSorterTreeLess()
+// ----------------------------------------------------------------------------
+
+// Compare the current records of two runs in the tournament tree.  Exhausted runs lose against all others and ties
+// are broken by the run order, which keeps the merge stable.
+
+inline bool _bamSorterTreeLess(String<BamAlignmentRecord> const & heads, String<bool> const & exhausted,
+                               BamSorterLess_ const & less, unsigned a, unsigned b)
+{
+    if (exhausted[a] != exhausted[b])
+        return exhausted[b];
+    if (!exhausted[a])
+    {
+        if (less(heads[a], heads[b]))
+            return true;
+        if (less(heads[b], heads[a]))
+            return false;
+    }
+    return a < b;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _buildBamSorterTree()
+// ----------------------------------------------------------------------------
+
+// Play the matches of the loser tree below node and return the winner.  Inner nodes are 1..k-1, leaves are k..2k-1,
+// losers[0] is the overall winner.
+
+inline unsigned _buildBamSorterTree(String<unsigned> & losers, unsigned node, String<BamAlignmentRecord> const & heads,
+                                    String<bool> const & exhausted, BamSorterLess_ const & less)
+{
+    unsigned k = length(heads);
+    if (node >= k)
+        return node - k;
+
+    unsigned left = _buildBamSorterTree(losers, 2 * node, heads, exhausted, less);
+    unsigned right = _buildBamSorterTree(losers, 2 * node + 1, heads, exhausted, less);
+    if (_bamSorterTreeLess(heads, exhausted, less, left, right))
+    {
+        losers[node] = right;
+        return left;
+    }
+    losers[node] = left;
+    return right;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _mergeBamSorterRuns()
+// ----------------------------------------------------------------------------
+
+// Merge the runs [beginRun, endRun) with a loser tree and write the records to target, which is either the final
+// BamStream or the BGZF stream of a larger run.  The context is only read, so disjoint ranges of runs can be merged
+// concurrently.
+
+template <typename TTarget>
+int _mergeBamSorterRuns(TTarget & target, BamSorter & sorter, size_t beginRun, size_t endRun)
+{
+    unsigned k = endRun - beginRun;
+    if (k == 0u)
+        return 0;
+
+    BamSorterLess_ less(sorter.order);
+    String<Stream<Bgzf> > streams;
+    resize(streams, k);
+    String<BamAlignmentRecord> heads;
+    resize(heads, k);
+    String<bool> exhausted;
+    resize(exhausted, k, false);
+
+    for (unsigned i = 0; i < k; ++i)
+    {
+        BamSorter::TFile & file = sorter._runs[beginRun + i];
+        seek(file, 0, SEEK_SET);
+        attachToFile(streams[i], file.handle, OPEN_RDONLY);
+        exhausted[i] = atEnd(streams[i]);
+        if (!exhausted[i] && readRecord(heads[i], sorter._context, streams[i], Bam()) != 0)
+            return 1;
+    }
+
+    String<unsigned> losers;
+    resize(losers, k);
+    losers[0] = _buildBamSorterTree(losers, 1, heads, exhausted, less);
+
+    while (!exhausted[losers[0]])
+    {
+        unsigned winner = losers[0];
+        if (_writeBamSorterRecord(target, heads[winner], sorter) != 0)
+            return 1;
+
+        exhausted[winner] = atEnd(streams[winner]);
+        if (!exhausted[winner] && readRecord(heads[winner], sorter._context, streams[winner], Bam()) != 0)
+            return 1;
+
+        // Replay the matches on the path from the winner's leaf to the root.
+        for (unsigned node = (winner + k) / 2; node > 0; node /= 2)
+            if (_bamSorterTreeLess(heads, exhausted, less, losers[node], winner))
+                std::swap(losers[node], winner);
+        losers[0] = winner;
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _compactBamSorterRuns()
+// ----------------------------------------------------------------------------
+
+// Merge the last maxMergeRuns runs into one while they all have the same level.
+
+inline int _compactBamSorterRuns(BamSorter & sorter)
+{
+    size_t maxRuns = std::max(2u, sorter.maxMergeRuns);
+
+    // The runs are read back through the context, its name store must cover all reference ids.
+    resize(sorter._nameStore, sorter._maxRId + 1);
+
+    while (length(sorter._runs) >= maxRuns)
+    {
+        size_t beginRun = length(sorter._runs) - maxRuns;
+        unsigned level = sorter._runLevels[beginRun];
+        for (size_t i = beginRun + 1; i < length(sorter._runs); ++i)
+            if (sorter._runLevels[i] != level)
+                return 0;
+
+        BamSorter::TFile file;
+        Stream<Bgzf> stream;
+        if (!_openBamSorterRun(file, stream) ||
+            _mergeBamSorterRuns(stream, sorter, beginRun, length(sorter._runs)) != 0 ||
+            streamFlush(stream) != 0)
+            return 1;
+
+        for (size_t i = beginRun; i < length(sorter._runs); ++i)
+            close(sorter._runs[i]);
+        resize(sorter._runs, beginRun);
+        resize(sorter._runLevels, beginRun);
+        appendValue(sorter._runs, file);
+        appendValue(sorter._runLevels, level + 1);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _reduceBamSorterRuns()
+// ----------------------------------------------------------------------------
+
+// Merge consecutive groups of maxMergeRuns runs into single runs until at most maxMergeRuns runs are left.  The
+// groups are merged in parallel.
+
+inline int _reduceBamSorterRuns(BamSorter & sorter)
+{
+    size_t maxRuns = std::max(2u, sorter.maxMergeRuns);
+    resize(sorter._nameStore, sorter._maxRId + 1);
+
+    while (length(sorter._runs) > maxRuns)
+    {
+        int numGroups = (length(sorter._runs) + maxRuns - 1) / maxRuns;
+        String<BamSorter::TFile> newRuns;
+        resize(newRuns, numGroups);
+        String<Stream<Bgzf> > streams;
+        resize(streams, numGroups);
+        for (int i = 0; i < numGroups; ++i)
+            if (!_openBamSorterRun(newRuns[i], streams[i]))
+                return 1;
+
+        int error = 0;
+        SEQAN_OMP_PRAGMA(parallel for num_threads(sorter.numThreads) schedule(dynamic) reduction(|:error))
+        for (int i = 0; i < numGroups; ++i)
+        {
+            size_t beginRun = i * maxRuns;
+            size_t endRun = std::min(beginRun + maxRuns, (size_t)length(sorter._runs));
+            error |= _mergeBamSorterRuns(streams[i], sorter, beginRun, endRun);
+            error |= streamFlush(streams[i]) != 0;
+        }
+        if (error != 0)
+            return 1;
+
+        for (unsigned i = 0; i < length(sorter._runs); ++i)
+            close(sorter._runs[i]);
+        sorter._runs = newRuns;
+        clear(sorter._runLevels);
+        resize(sorter._runLevels, numGroups, 0);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function writeRecords()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamSorter#writeRecords
+ * @brief Write all records of the sorter in sorted order to a BamStream.
+ *
+ * @signature int writeRecords(bamIO, sorter);
+ *
+ * @param[in,out] bamIO  The @link BamStream @endlink to write to.
+ * @param[in,out] sorter The BamSorter with the records, it is empty afterwards.
+ *
+ * @return int 0 on success, 1 on errors.
+ *
+ * If the header of <tt>bamIO</tt> was not written yet, its <tt>SO</tt> tag is set to the order of the sorter.
+ */
+
+/**
+.Function.BamSorter#writeRecords
+..class:Class.BamSorter
+..cat:BAM I/O
+..summary:Write all records of the sorter in sorted order to a BamStream.
+..signature:writeRecords(bamIO, sorter)
+..param.bamIO:The stream to write to.
+...type:Class.BamStream
+..param.sorter:The BamSorter with the records, it is empty afterwards.
+...type:Class.BamSorter
+..returns:$0$ on success, $1$ on errors.
+..remarks:If the header of $bamIO$ was not written yet, its $SO$ tag is set to the order of the sorter.
+..include:seqan/bam_io.h
+*/
+
+inline int writeRecords(BamStream & bamIO, BamSorter & sorter)
+{
+    if (!bamIO._headerWritten)
+        setSortOrder(bamIO.header, sorter.order);
+
+    int res = 0;
+    if (empty(sorter._runs))
+    {
+        // Everything fits into memory, merge the sorted slices pairwise in parallel.
+        String<size_t> perm;
+        String<size_t> sliceBegins;
+        _sortBamSorterSlices(perm, sliceBegins, sorter);
+
+        BamSorterIndexLess_ less(sorter._buffer, sorter.order);
+        while (length(sliceBegins) > 2u)
+        {
+            int numPairs = (length(sliceBegins) - 1) / 2;
+            SEQAN_OMP_PRAGMA(parallel for num_threads(sorter.numThreads) schedule(dynamic))
+            for (int i = 0; i < numPairs; ++i)
+                std::inplace_merge(begin(perm, Standard()) + sliceBegins[2 * i],
+                                   begin(perm, Standard()) + sliceBegins[2 * i + 1],
+                                   begin(perm, Standard()) + sliceBegins[2 * i + 2], less);
+
+            String<size_t> merged;
+            for (unsigned i = 0; i < length(sliceBegins); i += 2)
+                appendValue(merged, sliceBegins[i]);
+            if (back(merged) != back(sliceBegins))
+                appendValue(merged, back(sliceBegins));
+            swap(sliceBegins, merged);
+        }
+
+        for (size_t i = 0; i < length(perm) && res == 0; ++i)
+            res = writeRecord(bamIO, sorter._buffer[perm[i]]);
+    }
+    else
+    {
+        res = _spillBamSorterBuffer(sorter);
+        if (res == 0)
+            res = _reduceBamSorterRuns(sorter);
+        if (res == 0)
+            res = _mergeBamSorterRuns(bamIO, sorter, 0, length(sorter._runs));
+    }
+
+    clear(sorter);
+    return res != 0;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_SORTER_H_
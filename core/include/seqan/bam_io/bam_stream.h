@@ -179,6 +179,8 @@ When writing, the $bamIOContext$ is automatically filled/reset when the first re
 ..summary:Select the operation mode of a @Class.BamStream@.
 ..value.READ:Open stream for reading.
 ..value.WRITE:Open stream for writing.
+..value.READ_PARALLEL:Open stream for reading, SAM records are parsed in parallel and returned in file order.
+..value.WRITE_PARALLEL:Open stream for writing, SAM records are collected and formatted in parallel.
 ..include:seqan/bam_io.h
 
 .Enum.BamStream\colon\colonFormat:
@@ -202,6 +204,20 @@ When writing, the $bamIOContext$ is automatically filled/reset when the first re
  *
  * @var BamStream::OperationMode BamStream::WRITE;
  * @brief Enum value for writing.
+ *
+ * @var BamStream::OperationMode BamStream::READ_PARALLEL;
+ * @brief Enum value for reading, SAM records are parsed in parallel.
+ *
+ * @var BamStream::OperationMode BamStream::WRITE_PARALLEL;
+ * @brief Enum value for writing, SAM records are formatted in parallel.
+ *
+ * @section Parallel SAM I/O
+ *
+ * In the parallel modes, SAM input is cut into chunks of complete lines that are parsed by the OpenMP threads, the
+ * records are returned in file order.  When writing, records are collected and formatted in parallel when enough
+ * records are there and on <tt>flush()</tt> or <tt>close()</tt>.  BAM files are read and written as in the normal
+ * modes.  Use @link BamStream#setParallelThreads @endlink and @link BamStream#setParallelChunkSize @endlink for
+ * configuring the parallel modes.
  */
 
 /*!
@@ -229,7 +245,9 @@ public:
     enum OperationMode
     {
         READ,
-        WRITE
+        WRITE,
+        READ_PARALLEL,
+        WRITE_PARALLEL
     };
 
     // Enum for selecting format.  AUTO is only used as the default, after opening, only SAM and BAM are used.
@@ -242,8 +260,10 @@ public:
 
     // Name of the BAM file.
     CharString _filename;
-    // The open mode.
+    // The open mode, READ or WRITE.
     OperationMode _mode;
+    // Whether SAM records are parsed/formatted in parallel.
+    bool _parallel;
     // The format.
     Format _format;
     // Whether or not the header was written out.
@@ -269,7 +289,7 @@ public:
     // Constructors.
 
     BamStream() :
-        _mode(READ), _format(AUTO), _headerWritten(false), _atEnd(false), _isGood(true),
+        _mode(READ), _parallel(false), _format(AUTO), _headerWritten(false), _atEnd(false), _isGood(true),
         _nameStoreCache(_nameStore), bamIOContext(_nameStore, _nameStoreCache)
     {}
 
@@ -312,7 +332,8 @@ inline int open(BamStream & bamIO,
                 BamStream::Format format);
 
 inline BamStream::BamStream(char const * filename, OperationMode mode, Format format) :
-    _filename(filename), _mode(mode), _format(format), _headerWritten(false), _atEnd(false), _isGood(true),
+    _filename(filename), _mode(mode), _parallel(false), _format(format), _headerWritten(false), _atEnd(false),
+    _isGood(true),
     _nameStoreCache(_nameStore), bamIOContext(_nameStore, _nameStoreCache)
 {
     open(*this, filename, _mode, _format);
@@ -368,6 +389,13 @@ inline int open(BamStream & bamIO,
     bamIO._filename = fileName;
     bamIO._isGood = true;
 
+    // The parallel modes only differ from READ and WRITE in the SAM reader and writer.
+    bool parallel = (mode == BamStream::READ_PARALLEL || mode == BamStream::WRITE_PARALLEL);
+    if (mode == BamStream::READ_PARALLEL)
+        mode = BamStream::READ;
+    else if (mode == BamStream::WRITE_PARALLEL)
+        mode = BamStream::WRITE;
+
     // Guess format if necessary.
     if (format == BamStream::AUTO)
     {
@@ -408,7 +436,11 @@ inline int open(BamStream & bamIO,
     if (mode == BamStream::READ)
     {
         if (format == BamStream::SAM)
-            bamIO._reader.reset(new SamReader_());
+        {
+            SamReader_ * samReader = new SamReader_();
+            samReader->_parallel = parallel;
+            bamIO._reader.reset(samReader);
+        }
 #if SEQAN_HAS_ZLIB
         // The branch above is always taken if zlib is not available, there already is a check above.
         else
@@ -423,7 +455,11 @@ inline int open(BamStream & bamIO,
     else  // (format == BamStream::WRITE)
     {
         if (format == BamStream::SAM)
-            bamIO._writer.reset(new SamWriter_());
+        {
+            SamWriter_ * samWriter = new SamWriter_();
+            samWriter->_parallel = parallel;
+            bamIO._writer.reset(samWriter);
+        }
 #if SEQAN_HAS_ZLIB
         // The branch above is always taken if zlib is not available, there already is a check above.
         else
@@ -437,6 +473,7 @@ inline int open(BamStream & bamIO,
     }
 
     bamIO._mode = mode;
+    bamIO._parallel = parallel;
     bamIO._format = format;
 
     // Read header.
@@ -481,7 +518,10 @@ inline int open(BamStream & bamIO,
 
 inline int reset(BamStream & bamIO)
 {
-    return open(bamIO, toCString(bamIO._filename), bamIO._mode, bamIO._format);
+    BamStream::OperationMode mode = bamIO._mode;
+    if (bamIO._parallel)
+        mode = (mode == BamStream::READ) ? BamStream::READ_PARALLEL : BamStream::WRITE_PARALLEL;
+    return open(bamIO, toCString(bamIO._filename), mode, bamIO._format);
 }
 
 // ----------------------------------------------------------------------------
@@ -648,7 +688,7 @@ inline bool isGood(BamStream const & bamIO)
  * @signature int readRecord(record, stream);
  *
  * @param[out]   record    The @link BamAlignmentRecord @endlink to read the next alignment record into.  Of type
- *                         @link BamAlignmentRecord @endlink.
+ *                         @link BamAlignmentRecord @endlink or @link BamLazyAlignmentRecord @endlink.
  * @param[in,out] stream   The @link BamStream @endlink object to read from.
  *
  * @return int A status code, 0 on success.
@@ -674,6 +714,29 @@ inline int readRecord(BamAlignmentRecord & record, BamStream & bamIO)
     return res;
 }
 
+// When reading BAM, the lazy record is read directly from the BGZF stream.  SAM records are converted.
+
+#if SEQAN_HAS_ZLIB
+inline int readRecord(BamLazyAlignmentRecord & record, BamStream & bamIO)
+{
+    int res = 0;
+    if (bamIO._format == BamStream::BAM)
+    {
+        BamReader_ * s = static_cast<BamReader_ *>(bamIO._reader.get());
+        res = readRecord(record, bamIO.bamIOContext, s->_stream, Bam());
+    }
+    else
+    {
+        BamAlignmentRecord tmp;
+        res = bamIO._reader->readRecord(tmp, bamIO.bamIOContext);
+        if (res == 0)
+            assignRecord(record, tmp);
+    }
+    bamIO._isGood = bamIO._isGood && (res == 0);
+    return res;
+}
+#endif  // #if SEQAN_HAS_ZLIB
+
 // ----------------------------------------------------------------------------
 // Function writeRecord()
 // ----------------------------------------------------------------------------
@@ -685,7 +748,8 @@ inline int readRecord(BamAlignmentRecord & record, BamStream & bamIO)
  * @signature int writeRecord(stream, record);
  *
  * @param[in,out] bamIO  The @link BamStream @endlink object to write to.
- * @param[in]     record The @link BamAlignmentRecord @endlink to write out.
+ * @param[in]     record The @link BamAlignmentRecord @endlink or @link BamLazyAlignmentRecord @endlink to write
+ *                       out.
  *
  * @return int A status code, 0 on success.
  */
@@ -712,6 +776,109 @@ inline int writeRecord(BamStream & bamIO, BamAlignmentRecord const & record)
     return res;
 }
 
+// Unmodified lazy records are copied into BAM files without re-encoding.  SAM records are converted.
+
+#if SEQAN_HAS_ZLIB
+inline int writeRecord(BamStream & bamIO, BamLazyAlignmentRecord const & record)
+{
+    bamIO._writeHeader();  // Does nothing if head already written out.
+
+    int res = 0;
+    if (bamIO._format == BamStream::BAM)
+    {
+        BamWriter_ * s = static_cast<BamWriter_ *>(bamIO._writer.get());
+        res = write2(s->_stream, record, bamIO.bamIOContext, Bam());
+    }
+    else
+    {
+        BamAlignmentRecord tmp;
+        assignRecord(tmp, record);
+        res = bamIO._writer->writeRecord(tmp, bamIO.bamIOContext);
+    }
+    bamIO._isGood = bamIO._isGood && (res == 0);
+    return res;
+}
+#endif  // #if SEQAN_HAS_ZLIB
+
+// ----------------------------------------------------------------------------
+// Function setParallelChunkSize()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamStream#setParallelChunkSize
+ * @brief Set the approximate size of the SAM text that is parsed or formatted by one thread in the parallel modes.
+ *
+ * @signature void setParallelChunkSize(bamIO, chunkSize);
+ *
+ * @param[in,out] bamIO     The @link BamStream @endlink to configure.
+ * @param[in]     chunkSize The chunk size in bytes, defaults to 4 MiB.
+ *
+ * This has no effect if the stream is not opened in a parallel mode or on BAM files.
+ */
+
+/**
+.Function.BamStream#setParallelChunkSize
+..class:Class.BamStream
+..summary:Set the approximate size of the SAM text that is parsed or formatted by one thread in the parallel modes.
+..signature:setParallelChunkSize(bamIO, chunkSize)
+..param.bamIO:The @Class.BamStream@ object to configure.
+...type:Class.BamStream
+..param.chunkSize:The chunk size in bytes, defaults to 4 MiB.
+...type:nolink:$unsigned$
+..remarks:This has no effect if the stream is not opened in a parallel mode or on BAM files.
+..include:seqan/bam_io.h
+*/
+
+inline SamParallelState_ * _samParallelState(BamStream & bamIO)
+{
+    if (!bamIO._parallel || bamIO._format != BamStream::SAM)
+        return 0;
+    if (bamIO._mode == BamStream::READ)
+        return (bamIO._reader.get() != 0) ? &static_cast<SamReader_ *>(bamIO._reader.get())->_parallelState : 0;
+    return (bamIO._writer.get() != 0) ? &static_cast<SamWriter_ *>(bamIO._writer.get())->_parallelState : 0;
+}
+
+inline void setParallelChunkSize(BamStream & bamIO, unsigned chunkSize)
+{
+    if (SamParallelState_ * state = _samParallelState(bamIO))
+        state->chunkSize = _max(1u, chunkSize);
+}
+
+// ----------------------------------------------------------------------------
+// Function setParallelThreads()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn BamStream#setParallelThreads
+ * @brief Set the number of threads that parse or format SAM records in the parallel modes.
+ *
+ * @signature void setParallelThreads(bamIO, numThreads);
+ *
+ * @param[in,out] bamIO      The @link BamStream @endlink to configure.
+ * @param[in]     numThreads The number of threads, defaults to the number of OpenMP threads.
+ *
+ * This has no effect if the stream is not opened in a parallel mode or on BAM files.
+ */
+
+/**
+.Function.BamStream#setParallelThreads
+..class:Class.BamStream
+..summary:Set the number of threads that parse or format SAM records in the parallel modes.
+..signature:setParallelThreads(bamIO, numThreads)
+..param.bamIO:The @Class.BamStream@ object to configure.
+...type:Class.BamStream
+..param.numThreads:The number of threads, defaults to the number of OpenMP threads.
+...type:nolink:$unsigned$
+..remarks:This has no effect if the stream is not opened in a parallel mode or on BAM files.
+..include:seqan/bam_io.h
+*/
+
+inline void setParallelThreads(BamStream & bamIO, unsigned numThreads)
+{
+    if (SamParallelState_ * state = _samParallelState(bamIO))
+        state->numThreads = _max(1u, numThreads);
+}
+
 // ----------------------------------------------------------------------------
 // Function fileSize()
 // ----------------------------------------------------------------------------
@@ -329,7 +329,7 @@ int readRecord(BamAlignmentRecord & record,
     res = readDigits(buffer, reader);
     if (res != 0)
         return res;
-    record.flag = lexicalCast<__uint16>(buffer);
+    record.flag = _lexicalCastSam<__uint16>(buffer);
     SEQAN_SKIP_TAB;
 
     // RNAME
@@ -362,7 +362,7 @@ int readRecord(BamAlignmentRecord & record,
     else if (buffer == "0")
         record.beginPos = BamAlignmentRecord::INVALID_POS;
     else
-        record.beginPos = lexicalCast<__uint32>(buffer) - 1;
+        record.beginPos = _lexicalCastSam<__uint32>(buffer) - 1;
     SEQAN_SKIP_TAB;
 
     // MAPQ
@@ -377,7 +377,7 @@ int readRecord(BamAlignmentRecord & record,
         res = readDigits(buffer, reader);
         if (res != 0)
             return res;
-        record.mapQ = lexicalCast<__uint16>(buffer);
+        record.mapQ = _lexicalCastSam<__uint16>(buffer);
     }
     SEQAN_SKIP_TAB;
 
@@ -397,7 +397,7 @@ int readRecord(BamAlignmentRecord & record,
             res = readDigits(buffer, reader);
             if (res != 0)
                 return res;
-            element.count = lexicalCast<__uint32>(buffer);
+            element.count = _lexicalCastSam<__uint32>(buffer);
             element.operation = value(reader);
             if (goNext(reader))
                 return EOF_BEFORE_SUCCESS;
@@ -443,7 +443,7 @@ int readRecord(BamAlignmentRecord & record,
         if (buffer == "0")
             record.pNext = BamAlignmentRecord::INVALID_POS;
         else
-            record.pNext = lexicalCast<__uint32>(buffer) - 1;
+            record.pNext = _lexicalCastSam<__uint32>(buffer) - 1;
     }
     SEQAN_SKIP_TAB;
 
@@ -467,7 +467,7 @@ int readRecord(BamAlignmentRecord & record,
         res = readDigits(buffer, reader);
         if (res != 0)
             return res;
-        record.tLen = lexicalCast<__int32>(buffer);
+        record.tLen = _lexicalCastSam<__int32>(buffer);
     }
     SEQAN_SKIP_TAB;
 
@@ -0,0 +1,383 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Parallel parsing and formatting of SAM records, used by SamReader_ and
+// SamWriter_ in the parallel modes of BamStream.
+//
+// When reading, the input is cut into large chunks that end on line breaks.
+// The chunks are parsed in parallel and the records are handed out in file
+// order.  When writing, records are collected into a batch that is formatted
+// in parallel and written out in order.
+// ==========================================================================
+
+#ifndef CORE_INCLUDE_SEQAN_BAM_IO_SAM_PARALLEL_H_
+#define CORE_INCLUDE_SEQAN_BAM_IO_SAM_PARALLEL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class SamParallelState_
+// ----------------------------------------------------------------------------
+
+// State of the parallel SAM reader and writer.
+//
+// The reference names of the records are resolved against a copy of the name store in each chunk.  Names that are not
+// in the name store yet are added to the shared name store in file order after the parallel part.
+
+struct SamParallelState_
+{
+    typedef BamIOContext<StringSet<CharString> > TBamIOContext;
+
+    // Approximate size of the SAM text that is parsed or formatted by one thread.
+    unsigned chunkSize;
+    // Number of threads, defaults to the number of OpenMP threads.
+    unsigned numThreads;
+
+    // Reading: Bytes after the last line break of the last chunk.
+    CharString carry;
+    // Reading: Parsed records of the last chunks, their numbers and the position of the next record to hand out.  The
+    // record strings are kept over the chunks such that their memory is reused.
+    String<String<BamAlignmentRecord> > records;
+    String<size_t> numRecords;
+    unsigned cacheChunk;
+    size_t cacheRecord;
+
+    // Writing: Records that have not been formatted yet, their approximate SAM size and the context to use.  The first
+    // batchLength entries of batch are used.
+    String<BamAlignmentRecord> batch;
+    size_t batchLength;
+    size_t batchBytes;
+    TBamIOContext const * context;
+
+    SamParallelState_() :
+        chunkSize(4 * 1024 * 1024), numThreads(omp_get_max_threads()), cacheChunk(0), cacheRecord(0), batchLength(0),
+        batchBytes(0), context(0)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Function _readSamParallelChunk()
+// ----------------------------------------------------------------------------
+
+// Read the next chunk that ends on a line break or at the end of the input.  Sets chunk to the empty string if there
+// is no more input.
+
+template <typename TStream, typename TPass>
+inline int
+_readSamParallelChunk(CharString & chunk,
+                      SamParallelState_ & state,
+                      RecordReader<TStream, TPass> & reader)
+{
+    clear(chunk);
+    swap(chunk, state.carry);
+
+    size_t targetSize = state.chunkSize;
+    while (true)
+    {
+        if (length(chunk) < targetSize)
+        {
+            int res = readNChars(chunk, reader, targetSize - length(chunk));
+            if (res != 0 && res != EOF_BEFORE_SUCCESS)
+                return res;
+        }
+        if (atEnd(reader))
+            return 0;
+
+        for (size_t pos = length(chunk); pos > 0u; --pos)
+            if (chunk[pos - 1] == '\n')
+            {
+                state.carry = suffix(chunk, pos);
+                resize(chunk, pos);
+                return 0;
+            }
+        // No line break, the line is longer than the chunk.
+        targetSize *= 2;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _parseSamParallelChunk()
+// ----------------------------------------------------------------------------
+
+// Parse all records of a chunk into the first numRecords entries of records.  The reference ids of names that are not
+// in the name store of context are numbered from length(nameStore(context)) on, these names are appended to newNames.
+
+template <typename TNameStore, typename TNameStoreCache>
+inline int
+_parseSamParallelChunk(String<BamAlignmentRecord> & records,
+                       size_t & numRecords,
+                       StringSet<CharString> & newNames,
+                       CharString & chunk,
+                       BamIOContext<TNameStore, TNameStoreCache> const & context)
+{
+    StringSet<CharString> localNameStore(nameStore(context));
+    NameStoreCache<StringSet<CharString> > localNameStoreCache(localNameStore);
+    BamIOContext<StringSet<CharString> > localContext(localNameStore, localNameStoreCache);
+
+    numRecords = 0;
+    clear(newNames);
+
+    RecordReader<CharString, SinglePass<StringReader> > reader(chunk);
+    while (!atEnd(reader))
+    {
+        if (numRecords == length(records))
+            resize(records, numRecords + 1);
+        int res = readRecord(records[numRecords], localContext, reader, Sam());
+        if (res != 0)
+            return res;
+        ++numRecords;
+    }
+
+    for (unsigned i = length(nameStore(context)); i < length(localNameStore); ++i)
+        appendValue(newNames, localNameStore[i]);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _mergeSamParallelNames()
+// ----------------------------------------------------------------------------
+
+// Add the new names of a chunk to the name store of context and translate the reference ids of its records.
+
+template <typename TNameStore, typename TNameStoreCache>
+inline void
+_mergeSamParallelNames(String<BamAlignmentRecord> & records,
+                       size_t numRecords,
+                       StringSet<CharString> const & newNames,
+                       unsigned oldLength,
+                       BamIOContext<TNameStore, TNameStoreCache> & context)
+{
+    if (empty(newNames))
+        return;
+
+    String<__int32> ids;
+    resize(ids, length(newNames), Exact());
+    for (unsigned i = 0; i < length(newNames); ++i)
+        if (!getIdByName(nameStore(context), newNames[i], ids[i], nameStoreCache(context)))
+        {
+            ids[i] = length(nameStore(context));
+            appendName(nameStore(context), newNames[i], nameStoreCache(context));
+        }
+
+    for (size_t i = 0; i < numRecords; ++i)
+    {
+        if (records[i].rID >= static_cast<__int32>(oldLength))
+            records[i].rID = ids[records[i].rID - oldLength];
+        if (records[i].rNextId >= static_cast<__int32>(oldLength))
+            records[i].rNextId = ids[records[i].rNextId - oldLength];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _skipEmptySamParallelChunks()
+// ----------------------------------------------------------------------------
+
+inline void
+_skipEmptySamParallelChunks(SamParallelState_ & state)
+{
+    while (state.cacheChunk < length(state.numRecords) && state.cacheRecord == state.numRecords[state.cacheChunk])
+    {
+        ++state.cacheChunk;
+        state.cacheRecord = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _fillSamParallelCache()
+// ----------------------------------------------------------------------------
+
+// Read the next chunks and parse them into the cache.  The cache stays empty at the end of the input.
+
+template <typename TStream, typename TPass, typename TNameStore, typename TNameStoreCache>
+inline int
+_fillSamParallelCache(SamParallelState_ & state,
+                      RecordReader<TStream, TPass> & reader,
+                      BamIOContext<TNameStore, TNameStoreCache> & context)
+{
+    unsigned numThreads = _max(1u, state.numThreads);
+    int res = 0;
+
+    String<CharString> chunks;
+    CharString chunk;
+    while (length(chunks) < numThreads)
+    {
+        if ((res = _readSamParallelChunk(chunk, state, reader)) != 0)
+            return res;
+        if (empty(chunk))
+            break;
+        appendValue(chunks, chunk);
+    }
+    unsigned numChunks = length(chunks);
+
+    if (length(state.records) < numChunks)
+        resize(state.records, numChunks);
+    resize(state.numRecords, numChunks, 0);
+    state.cacheChunk = 0;
+    state.cacheRecord = 0;
+    if (numChunks == 0u)
+        return 0;
+
+    String<StringSet<CharString> > newNames;
+    resize(newNames, numChunks);
+    String<int> chunkResults;
+    resize(chunkResults, numChunks, 0);
+    BamIOContext<TNameStore, TNameStoreCache> const & constContext = context;
+    SEQAN_OMP_PRAGMA(parallel for num_threads(numThreads) schedule(dynamic))
+    for (int i = 0; i < (int)numChunks; ++i)
+        chunkResults[i] = _parseSamParallelChunk(state.records[i], state.numRecords[i], newNames[i], chunks[i],
+                                                 constContext);
+
+    unsigned oldLength = length(nameStore(context));
+    for (unsigned i = 0; i < numChunks; ++i)
+    {
+        if (chunkResults[i] != 0)
+            return chunkResults[i];
+        _mergeSamParallelNames(state.records[i], state.numRecords[i], newNames[i], oldLength, context);
+    }
+    _skipEmptySamParallelChunks(state);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _readSamRecordParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TStream, typename TPass, typename TNameStore, typename TNameStoreCache>
+inline int
+_readSamRecordParallel(BamAlignmentRecord & record,
+                       SamParallelState_ & state,
+                       RecordReader<TStream, TPass> & reader,
+                       BamIOContext<TNameStore, TNameStoreCache> & context)
+{
+    if (state.cacheChunk >= length(state.numRecords))
+    {
+        int res = _fillSamParallelCache(state, reader, context);
+        if (res != 0)
+            return res;
+        if (state.cacheChunk >= length(state.numRecords))
+            return EOF_BEFORE_SUCCESS;
+    }
+
+    record = state.records[state.cacheChunk][state.cacheRecord++];
+    _skipEmptySamParallelChunks(state);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _atEndSamParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TStream, typename TPass>
+inline bool
+_atEndSamParallel(SamParallelState_ const & state, RecordReader<TStream, TPass> & reader)
+{
+    return state.cacheChunk >= length(state.numRecords) && empty(state.carry) && atEnd(reader);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _flushSamParallelBatch()
+// ----------------------------------------------------------------------------
+
+// Format the collected records in parallel and write them out in order.
+
+template <typename TStream>
+inline int
+_flushSamParallelBatch(TStream & stream, SamParallelState_ & state)
+{
+    if (state.batchLength == 0u)
+        return 0;
+
+    int numSlices = _min(_max(1u, state.numThreads), (unsigned)state.batchLength);
+    String<CharString> buffers;
+    resize(buffers, numSlices);
+    SEQAN_OMP_PRAGMA(parallel for num_threads(numSlices) schedule(static))
+    for (int i = 0; i < numSlices; ++i)
+    {
+        size_t sliceBegin = state.batchLength * i / numSlices;
+        size_t sliceEnd = state.batchLength * (i + 1) / numSlices;
+        for (size_t j = sliceBegin; j < sliceEnd; ++j)
+            _formatSamRecord(buffers[i], state.batch[j], *state.context);
+    }
+
+    state.batchLength = 0;
+    state.batchBytes = 0;
+    for (int i = 0; i < numSlices; ++i)
+    {
+        int res = streamPut(stream, buffers[i]);
+        if (res != 0)
+            return res;
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _writeSamRecordParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TStream>
+inline int
+_writeSamRecordParallel(TStream & stream,
+                        SamParallelState_ & state,
+                        BamAlignmentRecord const & record,
+                        BamIOContext<StringSet<CharString> > const & context)
+{
+    if (state.batchLength == length(state.batch))
+        resize(state.batch, state.batchLength + 1);
+    state.batch[state.batchLength++] = record;
+    state.context = &context;
+    state.batchBytes += 32 + length(record.qName) + 2 * length(record.seq) + 2 * length(record.tags);
+    if (state.batchBytes < static_cast<size_t>(_max(1u, state.numThreads)) * state.chunkSize)
+        return 0;
+    return _flushSamParallelBatch(stream, state);
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef CORE_INCLUDE_SEQAN_BAM_IO_SAM_PARALLEL_H_
@@ -63,9 +63,12 @@ public:
 
     // Record reader to use for parsing.
     std::SEQAN_AUTO_PTR_NAME<RecordReader<std::istream, SinglePass<> > > _reader;
+    // Whether the records are parsed in parallel and the state for this.
+    bool _parallel;
+    SamParallelState_ _parallelState;
 
     SamReader_() :
-        XamReader_(), _fileSize(0), _stream(0)
+        XamReader_(), _fileSize(0), _stream(0), _parallel(false)
     {}
 
     SamReader_(CharString const & filename);
@@ -96,7 +99,7 @@ public:
 // ----------------------------------------------------------------------------
 
 inline SamReader_::SamReader_(CharString const & filename) :
-    XamReader_(filename), _stream(0), _reader()
+    XamReader_(filename), _stream(0), _reader(), _parallel(false)
 {
     this->open(_filename);
 }
@@ -144,6 +147,8 @@ inline bool SamReader_::isGood()
 
 inline bool SamReader_::atEnd()
 {
+    if (this->_parallel)
+        return _atEndSamParallel(this->_parallelState, *this->_reader);
     return seqan::atEnd(*this->_reader);
 }
 
@@ -162,6 +167,8 @@ inline int SamReader_::readHeader(BamHeader & header, BamIOContext<StringSet<Cha
 
 inline int SamReader_::readRecord(BamAlignmentRecord & record, BamIOContext<StringSet<CharString> > & context)
 {
+    if (this->_parallel)
+        return _readSamRecordParallel(record, this->_parallelState, *this->_reader, context);
     return seqan::readRecord(record, context, *this->_reader, Sam());
 }
 
@@ -53,13 +53,22 @@ public:
     std::ostream * _stream;
     // The file stream to write to if we do not write to stdout.  Pointed to by _stream.
     std::ofstream _fstream;
+    // Whether the records are formatted in parallel and the state for this.
+    bool _parallel;
+    SamParallelState_ _parallelState;
 
     SamWriter_() :
-        XamWriter_(), _stream(0)
+        XamWriter_(), _stream(0), _parallel(false)
     {}
 
     SamWriter_(CharString const & filename);
 
+    ~SamWriter_()
+    {
+        if (this->_stream != 0)
+            _flushSamParallelBatch(*this->_stream, this->_parallelState);
+    }
+
     // XamWriter_ interface.
 
     virtual int open(CharString const & filename);
@@ -83,7 +92,7 @@ public:
 // ----------------------------------------------------------------------------
 
 inline SamWriter_::SamWriter_(CharString const & filename) :
-    XamWriter_(filename), _stream(0)
+    XamWriter_(filename), _stream(0), _parallel(false)
 {
     this->open(filename);
 }
@@ -133,6 +142,8 @@ inline int SamWriter_::writeHeader(BamHeader const & header, BamIOContext<String
 
 inline int SamWriter_::writeRecord(BamAlignmentRecord const & record, BamIOContext<StringSet<CharString> > const & context)
 {
+    if (this->_parallel)
+        return _writeSamRecordParallel(*this->_stream, this->_parallelState, record, context);
     return seqan::write2(*this->_stream, record, context, Sam());
 }
 
@@ -142,6 +153,9 @@ inline int SamWriter_::writeRecord(BamAlignmentRecord const & record, BamIOConte
 
 inline int SamWriter_::flush()
 {
+    int res = _flushSamParallelBatch(*this->_stream, this->_parallelState);
+    if (res != 0)
+        return res;
     return streamFlush(*this->_stream);
 }
 
@@ -151,6 +165,9 @@ inline int SamWriter_::flush()
 
 inline int SamWriter_::close()
 {
+    int res = _flushSamParallelBatch(*this->_stream, this->_parallelState);
+    if (res != 0)
+        return res;
     if (this->_stream == &this->_fstream)  // not to stdout
         this->_fstream.close();
     return 0;
@@ -165,16 +165,10 @@ static inline int _reg2Bin(uint32_t beg, uint32_t end)
     return 0;
 }
 
-template <typename TStream, typename TNameStore, typename TNameStoreCache>
-int write2(TStream & stream,
-           BamAlignmentRecord const & record,
-           BamIOContext<TNameStore, TNameStoreCache> const & /*context*/,
-           Bam const & /*tag*/)
-{
-    CharString buffer;
-
-    // First, write record to buffer.
+// Encode record into buffer, without the leading block_size field.
 
+inline void _writeBamRecordBody(CharString & buffer, BamAlignmentRecord const & record)
+{
     // refID
     streamWriteBlock(buffer, reinterpret_cast<char const *>(&record.rID), 4);
 
@@ -295,6 +289,17 @@ int write2(TStream & stream,
     // tags
     if (length(record.tags) > 0u)
         streamWriteBlock(buffer, reinterpret_cast<char const *>(&record.tags[0]), length(record.tags));
+}
+
+template <typename TStream, typename TNameStore, typename TNameStoreCache>
+int write2(TStream & stream,
+           BamAlignmentRecord const & record,
+           BamIOContext<TNameStore, TNameStoreCache> const & /*context*/,
+           Bam const & /*tag*/)
+{
+    // First, write record to buffer.
+    CharString buffer;
+    _writeBamRecordBody(buffer, record);
 
     // buffer to stream
     __uint32 blockSize = length(buffer);
@@ -151,140 +151,106 @@ int write2(TStream & stream,
 }
 
 // ----------------------------------------------------------------------------
-// Function write2()                                         BamAlignmentRecord
+// Helper Function _formatSamRecord()
 // ----------------------------------------------------------------------------
 
-template <typename TStream, typename TNameStore, typename TNameStoreCache>
-int write2(TStream & stream,
-           BamAlignmentRecord const & record,
-           BamIOContext<TNameStore, TNameStoreCache> const & context,
-           Sam const & /*tag*/)
-{
-    int res = 0;
-
-#define SEQAN_PUT_TAB                           \
-    do {                                        \
-        res = streamPut(stream, '\t');      \
-        if (res != 0)                       \
-            return res;                     \
-    } \
-    while (false)
-
-    res = streamPut(stream, record.qName);
-    if (res != 0)
-        return res;
+// Append the SAM line of record, including the line break, to buffer.  Numbers are formatted with
+// _appendSamInteger() instead of going through the stream, so this is also used by the parallel SAM writer.
 
-    SEQAN_PUT_TAB;
-
-    res = streamPut(stream, record.flag);
-    if (res != 0)
-        return res;
+template <typename TNameStore, typename TNameStoreCache>
+void _formatSamRecord(CharString & buffer,
+                      BamAlignmentRecord const & record,
+                      BamIOContext<TNameStore, TNameStoreCache> const & context)
+{
+    append(buffer, record.qName);
+    appendValue(buffer, '\t');
 
-    SEQAN_PUT_TAB;
+    _appendSamInteger(buffer, record.flag);
+    appendValue(buffer, '\t');
 
     if (record.rID == BamAlignmentRecord::INVALID_REFID)
-        res = streamPut(stream, '*');
+        appendValue(buffer, '*');
     else
-        res = streamPut(stream, nameStore(context)[record.rID]);
-    if (res != 0)
-        return res;
-
-    SEQAN_PUT_TAB;
+        append(buffer, nameStore(context)[record.rID]);
+    appendValue(buffer, '\t');
 
     if (record.rID == BamAlignmentRecord::INVALID_REFID)
-        res = streamPut(stream, '*');
+        appendValue(buffer, '*');
     else
-        res = streamPut(stream, record.beginPos + 1);
-    if (res != 0)
-        return res;
+        _appendSamInteger(buffer, record.beginPos + 1);
+    appendValue(buffer, '\t');
 
-    SEQAN_PUT_TAB;
-
-    res = streamPut(stream, static_cast<__uint16>(record.mapQ));
-    if (res != 0)
-        return res;
-
-    SEQAN_PUT_TAB;
+    _appendSamInteger(buffer, static_cast<__uint16>(record.mapQ));
+    appendValue(buffer, '\t');
 
     if (empty(record.cigar))
     {
-        res = streamPut(stream, '*');
-        if (res != 0)
-            return res;
+        appendValue(buffer, '*');
     }
     else
     {
         for (unsigned i = 0; i < length(record.cigar); ++i)
         {
-            res = streamPut(stream, record.cigar[i].count);
-            if (res != 0)
-                return res;
-
-            res = streamPut(stream, record.cigar[i].operation);
-            if (res != 0)
-                return res;
+            _appendSamInteger(buffer, record.cigar[i].count);
+            appendValue(buffer, record.cigar[i].operation);
         }
     }
-
-    SEQAN_PUT_TAB;
+    appendValue(buffer, '\t');
 
     if (record.rNextId == BamAlignmentRecord::INVALID_REFID)
-        res = streamPut(stream, '*');
+        appendValue(buffer, '*');
     else if (record.rID == record.rNextId)
-        res = streamPut(stream, '=');
+        appendValue(buffer, '=');
     else
-        res = streamPut(stream, nameStore(context)[record.rNextId]);
-    if (res != 0)
-        return res;
-
-    SEQAN_PUT_TAB;
+        append(buffer, nameStore(context)[record.rNextId]);
+    appendValue(buffer, '\t');
 
     if (record.pNext == BamAlignmentRecord::INVALID_POS)
-        res = streamPut(stream, '0');
+        appendValue(buffer, '0');
     else
-        res = streamPut(stream, record.pNext + 1);
-    if (res != 0)
-        return res;
-
-    SEQAN_PUT_TAB;
+        _appendSamInteger(buffer, record.pNext + 1);
+    appendValue(buffer, '\t');
 
     if (record.tLen == BamAlignmentRecord::INVALID_LEN)
-        res = streamPut(stream, '0');
+        appendValue(buffer, '0');
     else
-        res = streamPut(stream, record.tLen);
-    if (res != 0)
-        return res;
-
-    SEQAN_PUT_TAB;
+        _appendSamInteger(buffer, record.tLen);
+    appendValue(buffer, '\t');
 
     if (empty(record.seq))
-        res = streamPut(stream, '*');  // Case of empty seq string / "*".
+        appendValue(buffer, '*');  // Case of empty seq string / "*".
     else
-        res = streamPut(stream, record.seq);
-    if (res != 0)
-        return res;
-
-    SEQAN_PUT_TAB;
-
+        append(buffer, record.seq);
+    appendValue(buffer, '\t');
 
     if (empty(record.qual))  // Case of empty quality string / "*".
-        res = streamPut(stream, '*');
+        appendValue(buffer, '*');
     else
-        res = streamPut(stream, record.qual);
-    if (res != 0)
-        return res;
+        append(buffer, record.qual);
 
-    if (!empty(record.tags))
+    typedef Iterator<CharString const, Rooted>::Type TTagsIter;
+    for (TTagsIter it = begin(record.tags, Rooted()); !atEnd(it);)
     {
-        SEQAN_PUT_TAB;
-        CharString buffer;
-        assignTagsBamToSam(buffer, record.tags);
-        streamPut(stream, buffer);
+        appendValue(buffer, '\t');
+        _assignTagsBamToSamOneTag(buffer, it);
     }
 
-    return streamPut(stream, '\n');
+    appendValue(buffer, '\n');
+}
+
+// ----------------------------------------------------------------------------
+// Function write2()                                         BamAlignmentRecord
+// ----------------------------------------------------------------------------
 
-#undef SEQAN_PUT_TAB
+template <typename TStream, typename TNameStore, typename TNameStoreCache>
+int write2(TStream & stream,
+           BamAlignmentRecord const & record,
+           BamIOContext<TNameStore, TNameStoreCache> const & context,
+           Sam const & /*tag*/)
+{
+    CharString buffer;
+    _formatSamRecord(buffer, record, context);
+    return streamPut(stream, buffer);
 }
 
 }  // namespace seqan
@@ -182,6 +182,74 @@ scoreConsensus(TConsensus& consensus)
 
 //////////////////////////////////////////////////////////////////////////////////
 
+// State that is kept between the realignment rounds of one contig.
+//
+// The buffers are reused for all reads and rounds.  In incremental mode, each consensus column carries the step
+// in which it was last changed and each read the step in which it was last realigned.  The realignment of a read
+// only depends on its own alignment and the profile columns in its band window, so a read is skipped if none of
+// these columns changed since it was realigned the last time.
+template <typename TConsensus, typename TAlignedRead>
+struct ReAlignState_
+{
+	bool incremental;
+	unsigned step;
+	String<unsigned> columnSteps;
+	String<unsigned> readSteps;
+	String<unsigned> stepBuffer;
+
+	TConsensus bandConsensus;
+	TConsensus myRead;
+	TConsensus newConsensus;
+	TConsensus oldWindow;
+	TAlignedRead oldRead;
+	String<Fragment<> > matches;
+
+	ReAlignState_() : incremental(false), step(0)
+	{}
+};
+
+// Returns true if the band window of a read did not change since the read was realigned the last time.
+//
+// The window is the band that reAlign() fills: it starts bandwidth columns left of the read, clamped to column 0, and
+// holds 2 * bandwidth + (endPos - beginPos) columns.  Thus, if the offset is clamped, the band reaches further to
+// the right of the read.  Columns that only contain the read are removed before the band is filled, each of them moves
+// the end of the band one column to the right.
+template <typename TConsensus, typename TAlignedRead, typename TSize, typename TBandwidth>
+inline bool
+_reAlignWindowUnchanged(ReAlignState_<TConsensus, TAlignedRead> const & state,
+						TConsensus const & consensus,
+						TAlignedRead const & alignedRead,
+						TSize readIdx,
+						TBandwidth const bandwidth)
+{
+	typedef typename Value<TConsensus>::Type TProfileChar;
+	typedef typename Size<TConsensus>::Type TConsSize;
+
+	if (!state.incremental || state.readSteps[readIdx] == 0)
+		return false;
+
+	TConsSize gapPos = ValueSize<TProfileChar>::VALUE - 1;
+	TConsSize beginPos = alignedRead.beginPos;
+	TConsSize endPos = alignedRead.endPos;
+	TConsSize windowBegin = (bandwidth < (TBandwidth) beginPos) ? beginPos - bandwidth : 0;
+	TConsSize windowEnd = windowBegin + 2 * bandwidth + (endPos - beginPos);
+	for (TConsSize i = beginPos; i < endPos && i < length(consensus); ++i) {
+		TConsSize count = 0;
+		for (TConsSize k = 0; k < gapPos; ++k)
+			count += consensus[i].count[k];
+		if (count <= 1u)
+			++windowEnd;
+	}
+	windowEnd = _min(windowEnd, (TConsSize) length(state.columnSteps));
+
+	for (TConsSize i = windowBegin; i < windowEnd; ++i)
+		if (state.columnSteps[i] > state.readSteps[readIdx])
+			return false;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
 // Perform one realignment round.
 // TODO(holtgrew): Rename to reflect this more clearly.
 // TODO(holtgrew): TConsensus/consensus are profiles, really.
@@ -196,7 +264,8 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 		bool includeReference,
         double & timeBeforeAlign,
         double & timeAlign,
-        double & timeAfterAlign
+        double & timeAfterAlign,
+        ReAlignState_<TConsensus, TAlignedRead> & state
         )
 {
 	typedef FragmentStore<TSpec, TConfig> TFragmentStore;
@@ -219,11 +288,18 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 	TAlignedReadIter alignItEnd = end(contigReads, Standard());
 	if (includeReference)
         --alignItEnd;
-	TConsensus bandConsensus;
-	TConsensus myRead;
-	TConsensus newConsensus;
+	TConsensus & bandConsensus = state.bandConsensus;
+	TConsensus & myRead = state.myRead;
+	TConsensus & newConsensus = state.newConsensus;
+	if (state.incremental) {
+		resize(state.readSteps, length(contigReads), 0u);
+		resize(state.columnSteps, length(consensus), 0u);
+	}
     int i = 0;
 	for (; alignIt != alignItEnd; ++alignIt) {
+		TSize readIdx = alignIt - begin(contigReads, Standard());
+		if (_reAlignWindowUnchanged(state, consensus, *alignIt, readIdx, bandwidth))
+			continue;
         double tBegin = sysTime();
         if (i++ > 1000 || i == 1) {
             //printf("realigning %u/%u\r", unsigned(alignIt-beg), unsigned(alignItEnd-beg));
@@ -265,6 +341,12 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 			itCons += bandOffset; itConsPos += bandOffset;
 			SEQAN_ASSERT_LEQ(itCons, itConsEnd);
 		}
+		if (state.incremental) {
+			// Keep the old window to detect whether the realignment changed the profile.
+			TSize windowEnd = _min((TSize) length(consensus), (TSize) (alignIt->endPos + bandwidth));
+			state.oldWindow = infix(consensus, bandOffset, _max((TSize) bandOffset, windowEnd));
+			state.oldRead = *alignIt;
+		}
 		int leftDiag = (alignIt->beginPos - bandOffset) - bandwidth;
 		int rightDiag = leftDiag + 2 * bandwidth;
 		//int increaseBand = 0;
@@ -388,7 +470,8 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 		//std::cout << "..............." << std::endl;
 
 		typedef String<Fragment<> > TFragmentString;
-		TFragmentString matches;
+		TFragmentString & matches = state.matches;
+		clear(matches);
 		assignProfile(consScore, bandConsensus);
 
         double tBegAlign = sysTime();
@@ -507,6 +590,22 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 		}
 		resize(newConsensus, newConsIt - begin(newConsensus, Standard()), Generous());
 
+		if (state.incremental) {
+			// Mark the window as changed unless the read was put back at the very same place.
+			TSize windowEnd = itCons - begin(consensus, Standard());
+			++state.step;
+			bool changed = (windowEnd - bandOffset != length(state.oldWindow) || length(newConsensus) != length(state.oldWindow));
+			changed = changed || alignIt->beginPos != state.oldRead.beginPos || alignIt->endPos != state.oldRead.endPos ||
+					  !(alignIt->gaps == state.oldRead.gaps);
+			for (TSize k = 0; !changed && k < length(newConsensus); ++k)
+				changed = !(state.oldWindow[k] == newConsensus[k]);
+			if (changed) {
+				resize(state.stepBuffer, length(newConsensus), Exact());
+				arrayFill(begin(state.stepBuffer, Standard()), end(state.stepBuffer, Standard()), state.step);
+				replace(state.columnSteps, bandOffset, windowEnd, state.stepBuffer);
+			}
+			state.readSteps[readIdx] = state.step;
+		}
 		replace(consensus, bandOffset, itCons - begin(consensus), newConsensus);
         double tEnd = sysTime();
 
@@ -518,24 +617,51 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 
 //////////////////////////////////////////////////////////////////////////////////
 
+template<typename TFragSpec, typename TConfig, typename TAlignedRead, typename TSpec, typename TConsensus, typename TScore, typename TMethod, typename TBandwidth>
+inline void 
+reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
+		String<TAlignedRead, TSpec>& contigReads,
+		TConsensus& consensus,
+		TScore& consScore,
+		TMethod const rmethod,
+		TBandwidth const bandwidth,
+		bool includeReference,
+        double & timeBeforeAlign,
+        double & timeAlign,
+        double & timeAfterAlign
+        )
+{
+	ReAlignState_<TConsensus, TAlignedRead> state;
+	reAlign(fragStore, contigReads, consensus, consScore, rmethod, bandwidth, includeReference,
+			timeBeforeAlign, timeAlign, timeAfterAlign, state);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
 /*!
  * @fn reAlign
  * @headerfile <seqan/consensus.h>
  * @brief Perform realignment using the Anson-Myers realignment.
  *
- * @signature void reAlign(fragStore, consensusScore, contigID, [realignmentMethod,] bandwidth, includeReference);
+ * @signature void reAlign(fragStore, consensusScore, contigID, [realignmentMethod,] bandwidth, includeReference[, incremental]);
  *
  * @param[in,out] fragStore        The @link FragmentStore @endlink with the alignment to realign.
  * @param[in]     consensusScore   The @link Score @endlink to use for scoring alignments.
  * @param[in]     contigID         The integer id of the contig to realign.
  * @param[in]     bandwidth        The bandwidth to use for realignment.
  * @param[in]     includeReference A <tt>bool</tt> flag that indicates whether to include the reference as a pseudo-read.
+ * @param[in]     incremental      A <tt>bool</tt> flag that enables incremental realignment, defaults to <tt>false</tt>.
+ *                                 Only given together with <tt>realignmentMethod</tt>.
  *
  * @section Remarks
  *
  * If <tt>includeReference</tt> then the reference of the given contig will be used as a pseudo-read.  In this case, the
  * reference will be replaced by the consensus.  When included as a pseudo-read, the alignment of the consensus relative
  * to the original refernence can be used to call variants.
+ *
+ * In incremental mode, a read is only realigned again if the profile columns in its band window changed since its
+ * last realignment.  The result is the same as without incremental mode, but later rounds only realign the reads
+ * in regions that still change.
  */
 
 // TODO(holtgrew): realignmentMethod should not be optional or moved to the end of the list.
@@ -544,9 +670,11 @@ reAlign(FragmentStore<TFragSpec, TConfig>& fragStore,
 .Function.reAlign:
 ..cat:Consensus
 ..summary:Perform realignment similar to Anson-Myers algorithm.
-..signature:reAlignment(fragmentStore, consensusScore, contigId, [realignmentMethod,] bandwidth, includeReference)
+..signature:reAlignment(fragmentStore, consensusScore, contigId, [realignmentMethod,] bandwidth, includeReference[, incremental])
 ..category:Alignments
 ..remark:The consensus sequence will be appended to the readSeqStore of fragmentStore if includeReference is true.
+..remark:If incremental is true, a read is only realigned again if the profile columns in its band window changed since its last realignment.
+The result is the same, but later rounds only realign the reads in regions that still change.
 ..include:seqan/consensus.h
 */
 template<typename TSpec, typename TConfig, typename TScore, typename TId, typename TMethod, typename TBandwidth>
@@ -556,7 +684,8 @@ reAlign(FragmentStore<TSpec, TConfig> & fragStore,
 		TId const contigId,
 		TMethod const rmethod,
 		TBandwidth const bandwidth,
-		bool includeReference)
+		bool includeReference,
+		bool incremental)
 {
 	typedef FragmentStore<TSpec, TConfig> TFragmentStore;
 	typedef typename Size<TFragmentStore>::Type TSize;
@@ -703,7 +832,9 @@ reAlign(FragmentStore<TSpec, TConfig> & fragStore,
 	
     // beginTime = sysTime();
     double tBefore = 0, tAlign = 0, tAfter = 0;
-	reAlign(fragStore, contigReads, consensus, consScore, rmethod, bandwidth, includeReference, tBefore, tAlign, tAfter);
+	ReAlignState_<TProfileString, TAlignedElement> state;
+	state.incremental = incremental;
+	reAlign(fragStore, contigReads, consensus, consScore, rmethod, bandwidth, includeReference, tBefore, tAlign, tAfter, state);
 //    fprintf(stderr, "TIME before align: %f s\nTIME align: %f s\nTIME after align: %f s\n", tBefore, tAlign, tAfter);
     // endTime = sysTime();
 //    std::cerr << "TIME realign " << endTime - beginTime << std::endl;
@@ -714,7 +845,7 @@ reAlign(FragmentStore<TSpec, TConfig> & fragStore,
 		oldScore = score;
 //        double beginTime = sysTime();
         double tBefore = 0, tAlign = 0, tAfter = 0;
-		reAlign(fragStore, contigReads, consensus, consScore, rmethod, bandwidth, includeReference, tBefore, tAlign, tAfter);
+		reAlign(fragStore, contigReads, consensus, consScore, rmethod, bandwidth, includeReference, tBefore, tAlign, tAfter, state);
 //        fprintf(stderr, "TIME before align: %f s\nTIME align: %f s\nTIME after align: %f s\n", tBefore, tAlign, tAfter);
 //        double endTime = sysTime();
 //        std::cerr << "TIME realign " << endTime - beginTime << std::endl;
@@ -785,6 +916,21 @@ reAlign(FragmentStore<TSpec, TConfig> & fragStore,
 
 //////////////////////////////////////////////////////////////////////////////////
 
+// Forwards to the overload that accepts the incremental flag.
+template<typename TSpec, typename TConfig, typename TScore, typename TId, typename TMethod, typename TBandwidth>
+inline void 
+reAlign(FragmentStore<TSpec, TConfig> & fragStore,
+		TScore & consScore,
+		TId const contigId,
+		TMethod const rmethod,
+		TBandwidth const bandwidth,
+		bool includeReference)
+{
+	reAlign(fragStore, consScore, contigId, rmethod, bandwidth, includeReference, false);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
 // Forwards to the overload that accepts the alignment method.
 template<typename TSpec, typename TConfig, typename TScore, typename TId, typename TBandwidth>
 inline void 
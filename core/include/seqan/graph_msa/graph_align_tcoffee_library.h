@@ -864,6 +864,46 @@ _setDistanceValue(String<TFragment, TSpec>&,
 
 //////////////////////////////////////////////////////////////////////////////
 
+// The scoring scheme used for the pairwise alignments of the global library.  Score matrices are replaced by a query
+// profile of the first sequence of a pair.  The pairs are usually grouped by the first sequence, so the profile is
+// computed once per group and reused for all of its pairwise alignments.
+
+template<typename TScore, typename TString>
+struct GlobalLibraryScore_
+{
+	typedef TScore Type;
+};
+
+template<typename TScoreValue, typename TSeqValue, typename TMatrixSpec, typename TString>
+struct GlobalLibraryScore_<Score<TScoreValue, ScoreMatrix<TSeqValue, TMatrixSpec> >, TString>
+{
+	typedef Score<TScoreValue, QueryProfile<Score<TScoreValue, ScoreMatrix<TSeqValue, TMatrixSpec> >, TString> > Type;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
+template<typename TScore, typename TString>
+inline void
+_assignGlobalLibraryQuery(TScore& libraryScore,
+						  TScore const& score_type,
+						  TString const&)
+{
+	SEQAN_CHECKPOINT
+	libraryScore = score_type;
+}
+
+template<typename TScoreValue, typename TMatrixScore, typename TString>
+inline void
+_assignGlobalLibraryQuery(Score<TScoreValue, QueryProfile<TMatrixScore, TString> >& libraryScore,
+						  TMatrixScore const& score_type,
+						  TString const& query)
+{
+	SEQAN_CHECKPOINT
+	assignQuery(libraryScore, score_type, query);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 template<typename TString, typename TSpec, typename TSize2, typename TSpec2, typename TScore, typename TSegmentMatches, typename TScoreValues, typename TDistance, typename TAlignConfig>
 inline void 
 appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
@@ -880,11 +920,16 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
 	typedef typename Id<TStringSet>::Type TId;
 	typedef typename Size<TStringSet>::Type TSize;
 	typedef typename Value<TScoreValues>::Type TScoreValue;
+	typedef typename GlobalLibraryScore_<TScore, TString>::Type TLibraryScore;
 	typedef typename Iterator<String<TSize2, TSpec2> const, Standard>::Type TPairIter;
 
 	// Initialization
 	TSize nseq = length(str);
 	_resizeWithRespectToDistance(dist, nseq);
+
+	TLibraryScore libraryScore;
+	bool hasQuery = false;
+	TId queryId = 0;
 	
 	// Pairwise alignments
 	TPairIter itPair = begin(pList, Standard());
@@ -896,10 +941,17 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
 		TId id2 = positionToId(str, *itPair);
 		assignValueById(pairSet, const_cast<TStringSet&>(str), id1);
 		assignValueById(pairSet, const_cast<TStringSet&>(str), id2);
+
+		// The first sequence is the horizontal one
+		if (!hasQuery || queryId != id1) {
+			_assignGlobalLibraryQuery(libraryScore, score_type, value(pairSet, 0));
+			queryId = id1;
+			hasQuery = true;
+		}
 				
 		// Alignment
 		TSize from = length(matches);
-		TScoreValue myScore = globalAlignment(matches, pairSet, score_type, ac, Gotoh() );
+		TScoreValue myScore = globalAlignment(matches, pairSet, libraryScore, ac, Gotoh() );
 		TSize to = length(matches);
 
 		// Record the scores
@@ -915,7 +967,6 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
 	}
 }
 
-
 //////////////////////////////////////////////////////////////////////////////
 
 template<typename TString, typename TSpec, typename TSize2, typename TSpec2, typename TScore, typename TSegmentMatches, typename TScoreValues, typename TDistance>
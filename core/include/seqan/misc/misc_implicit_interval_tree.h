@@ -0,0 +1,532 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// An immutable interval tree stored implicitly in a sorted array.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_MISC_IMPLICIT_INTERVAL_TREE_H
+#define SEQAN_HEADER_MISC_IMPLICIT_INTERVAL_TREE_H
+
+#include <algorithm>
+
+#include <seqan/misc/misc_interval_tree.h>
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// Select whether internal queries report the cargos or the positions of the intervals.
+struct ImplicitIntervalTreeCargo_;
+struct ImplicitIntervalTreePosition_;
+
+// ----------------------------------------------------------------------------
+// Class ImplicitIntervalTree
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class ImplicitIntervalTree
+ * @headerfile <seqan/misc/misc_implicit_interval_tree.h>
+ * @brief An immutable interval tree in contiguous memory.
+ *
+ * @signature template <typename TValue, typename TCargo>
+ *            class ImplicitIntervalTree;
+ *
+ * @tparam TValue The value type of the interval boundaries, defaults to <tt>int</tt>.
+ * @tparam TCargo The cargo/id type, defaults to <tt>unsigned</tt>.
+ *
+ * The intervals are stored sorted by their left boundary.  The sorted array is interpreted as an implicit binary
+ * search tree whose root is the middle element, and each node is augmented with the maximal right boundary of its
+ * subtree.  In contrast to @link IntervalTree @endlink there are no per node lists and no pointers to follow, and
+ * intervals cannot be added or removed after construction.
+ *
+ * Intervals are half-open, i.e. an interval <tt>[b, e)</tt> contains the points <tt>b</tt> to <tt>e - 1</tt>.
+ *
+ * @fn ImplicitIntervalTree::ImplicitIntervalTree
+ * @brief Constructor
+ *
+ * @signature ImplicitIntervalTree::ImplicitIntervalTree();
+ * @signature ImplicitIntervalTree::ImplicitIntervalTree(intervals);
+ *
+ * @param[in] intervals A string of @link IntervalAndCargo @endlink objects.
+ */
+
+/**
+.Class.ImplicitIntervalTree:
+..cat:Miscellaneous
+..summary:An immutable interval tree in contiguous memory.
+..signature:ImplicitIntervalTree<TValue, TCargo>
+..param.TValue:The value type.
+...default:int
+..param.TCargo:The cargo/id type.
+...default:unsigned
+..remarks:The intervals are stored sorted by their left boundary.
+The sorted array is interpreted as an implicit binary search tree whose root is the middle element,
+and each node is augmented with the maximal right boundary of its subtree.
+Intervals are half-open and cannot be added or removed after construction.
+..see:Class.IntervalTree
+..include:seqan/misc/misc_implicit_interval_tree.h
+
+.Memfunc.ImplicitIntervalTree#ImplicitIntervalTree:
+..class:Class.ImplicitIntervalTree
+..summary:Constructor
+..signature:ImplicitIntervalTree()
+..signature:ImplicitIntervalTree(intervals)
+..param.intervals:Container of intervals.
+...remarks:A string of $IntervalAndCargo<TValue, TCargo>$ objects, see @Class.IntervalAndCargo@.
+*/
+
+template <typename TValue = int, typename TCargo = unsigned>
+class ImplicitIntervalTree
+{
+public:
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+
+    String<TInterval> intervals;    // sorted by left boundary
+    String<TValue> maxEnds;         // maximal right boundary in the subtree of each node
+    unsigned maxLevel;              // level of the root node
+
+    ImplicitIntervalTree() :
+        maxLevel(0)
+    {}
+
+    template <typename TIntervals>
+    explicit
+    ImplicitIntervalTree(TIntervals const & _intervals) :
+        maxLevel(0)
+    {
+        createIntervalTree(*this, _intervals);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+template <typename TValue, typename TCargo>
+struct Value<ImplicitIntervalTree<TValue, TCargo> >
+{
+    typedef TValue Type;
+};
+
+template <typename TValue, typename TCargo>
+struct Cargo<ImplicitIntervalTree<TValue, TCargo> >
+{
+    typedef TCargo Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function length()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TCargo>
+inline typename Size<String<IntervalAndCargo<TValue, TCargo> > >::Type
+length(ImplicitIntervalTree<TValue, TCargo> const & tree)
+{
+    return length(tree.intervals);
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TCargo>
+inline void
+clear(ImplicitIntervalTree<TValue, TCargo> & tree)
+{
+    clear(tree.intervals);
+    clear(tree.maxEnds);
+    tree.maxLevel = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function createIntervalTree()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ImplicitIntervalTree#createIntervalTree
+ * @brief Build the tree from a set of intervals, replacing its previous content.
+ *
+ * @signature void createIntervalTree(tree, intervals);
+ *
+ * @param[out] tree      The ImplicitIntervalTree to build.
+ * @param[in]  intervals A string of @link IntervalAndCargo @endlink objects.
+ */
+
+/**
+.Function.createIntervalTree
+..signature:createIntervalTree(implicitIntervalTree, intervals)
+..param.implicitIntervalTree:An implicit interval tree, its previous content is replaced.
+...type:Class.ImplicitIntervalTree
+..include:seqan/misc/misc_implicit_interval_tree.h
+*/
+
+template <typename TValue, typename TCargo, typename TIntervals>
+inline void
+createIntervalTree(ImplicitIntervalTree<TValue, TCargo> & tree, TIntervals const & intervals)
+{
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+    typedef typename Size<String<TInterval> >::Type TSize;
+
+    assign(tree.intervals, intervals, Exact());
+    std::stable_sort(begin(tree.intervals, Standard()), end(tree.intervals, Standard()),
+                     _less_compI1_ITree<TInterval>);
+
+    TSize n = length(tree.intervals);
+    resize(tree.maxEnds, n, Exact());
+    tree.maxLevel = 0;
+    if (n == 0)
+        return;
+
+    // Leaves (level 0) are the even positions.  The node at position i is on level k if i has exactly k trailing
+    // ones, its children are i - 2^(k-1) and i + 2^(k-1).  Right children beyond the end are replaced by the last
+    // node of the corresponding level, whose maximum is kept in lastMax.
+    TSize lastPos = 0;
+    TValue lastMax = TValue();
+    for (TSize i = 0; i < n; i += 2)
+    {
+        lastPos = i;
+        lastMax = tree.maxEnds[i] = rightBoundary(tree.intervals[i]);
+    }
+
+    unsigned k = 1;
+    for (; ((TSize)1 << k) <= n; ++k)
+    {
+        TSize x = (TSize)1 << (k - 1);
+        for (TSize i = (x << 1) - 1; i < n; i += x << 2)
+        {
+            TValue maxEnd = rightBoundary(tree.intervals[i]);
+            maxEnd = std::max(maxEnd, tree.maxEnds[i - x]);
+            maxEnd = std::max(maxEnd, (i + x < n) ? tree.maxEnds[i + x] : lastMax);
+            tree.maxEnds[i] = maxEnd;
+        }
+        lastPos = ((lastPos >> k) & 1) ? lastPos - x : lastPos + x;
+        if (lastPos < n && tree.maxEnds[lastPos] > lastMax)
+            lastMax = tree.maxEnds[lastPos];
+    }
+    tree.maxLevel = k - 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _implicitIntervalTreeHit()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TCargo, typename TSize>
+inline TCargo
+_implicitIntervalTreeHit(ImplicitIntervalTree<TValue, TCargo> const & tree, TSize pos,
+                         Tag<ImplicitIntervalTreeCargo_> const & /*tag*/)
+{
+    return cargo(tree.intervals[pos]);
+}
+
+template <typename TValue, typename TCargo, typename TSize>
+inline TSize
+_implicitIntervalTreeHit(ImplicitIntervalTree<TValue, TCargo> const & /*tree*/, TSize pos,
+                         Tag<ImplicitIntervalTreePosition_> const & /*tag*/)
+{
+    return pos;
+}
+
+// ----------------------------------------------------------------------------
+// Function _findIntervalsImplicit()
+// ----------------------------------------------------------------------------
+
+// Appends the cargos (or positions) of all intervals [b, e) with b < queryEnd (or b <= queryEnd if closedEnd) and
+// queryBegin < e to result, in the order of their left boundaries.
+template <typename TValue, typename TCargo, typename TResult, typename TReport>
+inline void
+_findIntervalsImplicit(ImplicitIntervalTree<TValue, TCargo> const & tree,
+                       TValue queryBegin,
+                       TValue queryEnd,
+                       bool closedEnd,
+                       TResult & result,
+                       Tag<TReport> const & reportTag)
+{
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+    typedef typename Size<String<TInterval> >::Type TSize;
+
+    struct StackEntry
+    {
+        unsigned level;
+        bool leftDone;
+        TSize pos;
+    };
+
+    TSize n = length(tree.intervals);
+    if (n == 0)
+        return;
+
+    // Every level pushes at most two entries.
+    StackEntry stack[2 * BitsPerValue<TSize>::VALUE + 2];
+    unsigned top = 0;
+    StackEntry root = { tree.maxLevel, false, ((TSize)1 << tree.maxLevel) - 1 };
+    stack[top++] = root;
+
+    while (top != 0)
+    {
+        StackEntry z = stack[--top];
+        if (z.level <= 3)
+        {
+            // Small subtrees are scanned linearly.
+            TSize i = z.pos >> z.level << z.level;
+            TSize iEnd = std::min(i + ((TSize)1 << (z.level + 1)) - 1, n);
+            for (; i < iEnd; ++i)
+            {
+                TValue b = leftBoundary(tree.intervals[i]);
+                if (b > queryEnd || (b == queryEnd && !closedEnd))
+                    break;
+                if (queryBegin < rightBoundary(tree.intervals[i]))
+                    appendValue(result, _implicitIntervalTreeHit(tree, i, reportTag), Generous());
+            }
+        }
+        else if (!z.leftDone)
+        {
+            // Descend into the left subtree first if it can contain overlapping intervals.
+            TSize left = z.pos - ((TSize)1 << (z.level - 1));
+            z.leftDone = true;
+            stack[top++] = z;
+            if (left >= n || tree.maxEnds[left] > queryBegin)
+            {
+                StackEntry child = { z.level - 1, false, left };
+                stack[top++] = child;
+            }
+        }
+        else if (z.pos < n)
+        {
+            TValue b = leftBoundary(tree.intervals[z.pos]);
+            if (b < queryEnd || (b == queryEnd && closedEnd))
+            {
+                if (queryBegin < rightBoundary(tree.intervals[z.pos]))
+                    appendValue(result, _implicitIntervalTreeHit(tree, z.pos, reportTag), Generous());
+                StackEntry child = { z.level - 1, false, z.pos + ((TSize)1 << (z.level - 1)) };
+                stack[top++] = child;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _seedImplicitIntervalSweep()
+// ----------------------------------------------------------------------------
+
+// Prepares a sweep that starts at firstQuery.  active receives the positions of all intervals that start before
+// firstQuery and end behind it, next the position of the first interval that starts at or behind firstQuery.
+template <typename TValue, typename TCargo, typename TSize>
+inline void
+_seedImplicitIntervalSweep(String<TSize> & active,
+                           TSize & next,
+                           ImplicitIntervalTree<TValue, TCargo> const & tree,
+                           TValue firstQuery)
+{
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+
+    clear(active);
+    _findIntervalsImplicit(tree, firstQuery, firstQuery, false, active, Tag<ImplicitIntervalTreePosition_>());
+    next = std::lower_bound(begin(tree.intervals, Standard()), end(tree.intervals, Standard()),
+                            TInterval(firstQuery, firstQuery, TCargo()), _less_compI1_ITree<TInterval>) -
+           begin(tree.intervals, Standard());
+}
+
+// ----------------------------------------------------------------------------
+// Function findIntervals()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn ImplicitIntervalTree#findIntervals
+ * @brief Find all intervals that contain the query point or overlap with the query interval.
+ *
+ * @signature void findIntervals(tree, query, result);
+ * @signature void findIntervals(tree, queryBegin, queryEnd, result);
+ * @signature void findIntervals(tree, queries, results);
+ * @signature void findIntervals(tree, queryBegins, queryEnds, results);
+ *
+ * @param[in]  tree        The ImplicitIntervalTree to search.
+ * @param[in]  query       A query point.
+ * @param[in]  queryBegin  The begin position of the query interval.
+ * @param[in]  queryEnd    The end position of the query interval.
+ * @param[out] result      A @link String @endlink of <tt>TCargo</tt> objects.  The cargos are ordered by the left
+ *                         boundaries of their intervals.
+ * @param[in]  queries     A string of query points in ascending order.
+ * @param[in]  queryBegins A string of begin positions of query intervals in ascending order.
+ * @param[in]  queryEnds   A string of the corresponding end positions.
+ * @param[out] results     A @link ConcatDirectStringSet @endlink of <tt>TCargo</tt> strings, one for each query.
+ *
+ * The batch variants descend the tree only for the first query and then sweep once over the sorted intervals and the
+ * sorted queries, keeping the intervals that may overlap the current query in an active list.  Hence, querying
+ * consecutive chunks of a sorted query set costs no more than querying the whole set at once.
+ */
+
+/**
+.Function.findIntervals
+..signature:findIntervals(implicitIntervalTree, query, result)
+..signature:findIntervals(implicitIntervalTree, query_begin, query_end, result)
+..signature:findIntervals(implicitIntervalTree, queries, results)
+..signature:findIntervals(implicitIntervalTree, query_begins, query_ends, results)
+..param.implicitIntervalTree:An implicit interval tree.
+...type:Class.ImplicitIntervalTree
+..param.queries:A string of query points in ascending order.
+..param.query_begins:A string of begin positions of query intervals in ascending order.
+..param.query_ends:A string of the corresponding end positions.
+..param.results:A $StringSet<String<TCargo>, Owner<ConcatDirect<> > >$ with one string of cargos per query.
+...remarks:The batch variants descend the tree only for the first query and then sweep once over the sorted intervals and queries.
+..include:seqan/misc/misc_implicit_interval_tree.h
+*/
+
+template <typename TValue, typename TCargo>
+inline void
+findIntervals(ImplicitIntervalTree<TValue, TCargo> const & tree,
+              TValue query,
+              String<TCargo> & result)
+{
+    clear(result);
+    _findIntervalsImplicit(tree, query, query, true, result, Tag<ImplicitIntervalTreeCargo_>());
+}
+
+template <typename TValue, typename TCargo>
+inline void
+findIntervals(ImplicitIntervalTree<TValue, TCargo> const & tree,
+              TValue queryBegin,
+              TValue queryEnd,
+              String<TCargo> & result)
+{
+    clear(result);
+    _findIntervalsImplicit(tree, queryBegin, queryEnd, false, result, Tag<ImplicitIntervalTreeCargo_>());
+}
+
+template <typename TValue, typename TCargo, typename TQueries, typename TResultSpec>
+inline void
+findIntervals(ImplicitIntervalTree<TValue, TCargo> const & tree,
+              TQueries const & queries,
+              StringSet<String<TCargo>, Owner<ConcatDirect<TResultSpec> > > & results)
+{
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+    typedef typename Size<String<TInterval> >::Type TSize;
+    typedef typename Iterator<String<TSize>, Standard>::Type TActiveIter;
+    typedef typename Iterator<TQueries const, Standard>::Type TQueryIter;
+
+    clear(results);
+    reserve(stringSetLimits(results), length(queries) + 1, Exact());
+
+    // Intervals that started at or before the current query and have not been passed yet, ordered by left boundary.
+    String<TSize> active;
+    TSize next = 0;
+    TSize n = length(tree.intervals);
+    if (!empty(queries))
+        _seedImplicitIntervalSweep(active, next, tree, (TValue)front(queries));
+
+    TQueryIter itEnd = end(queries, Standard());
+    for (TQueryIter it = begin(queries, Standard()); it != itEnd; ++it)
+    {
+        TValue query = *it;
+        SEQAN_ASSERT(it == begin(queries, Standard()) || !(query < *(it - 1)));
+
+        for (; next < n && !(query < leftBoundary(tree.intervals[next])); ++next)
+            appendValue(active, next, Generous());
+
+        // Report overlapping intervals and drop the ones that end before the query, as all later queries are larger.
+        TActiveIter itDst = begin(active, Standard());
+        TActiveIter itActiveEnd = end(active, Standard());
+        for (TActiveIter itActive = itDst; itActive != itActiveEnd; ++itActive)
+            if (query < rightBoundary(tree.intervals[*itActive]))
+            {
+                appendValue(concat(results), cargo(tree.intervals[*itActive]), Generous());
+                *itDst++ = *itActive;
+            }
+        resize(active, itDst - begin(active, Standard()));
+        appendValue(stringSetLimits(results), length(concat(results)), Generous());
+    }
+}
+
+template <typename TValue, typename TCargo, typename TQueries, typename TResultSpec>
+inline void
+findIntervals(ImplicitIntervalTree<TValue, TCargo> const & tree,
+              TQueries const & queryBegins,
+              TQueries const & queryEnds,
+              StringSet<String<TCargo>, Owner<ConcatDirect<TResultSpec> > > & results)
+{
+    typedef IntervalAndCargo<TValue, TCargo> TInterval;
+    typedef typename Size<String<TInterval> >::Type TSize;
+    typedef typename Iterator<String<TSize>, Standard>::Type TActiveIter;
+    typedef typename Size<TQueries>::Type TQuerySize;
+
+    SEQAN_ASSERT_EQ(length(queryBegins), length(queryEnds));
+
+    clear(results);
+    reserve(stringSetLimits(results), length(queryBegins) + 1, Exact());
+
+    // Intervals that started before the end of some query so far and have not been passed by the query begins.
+    String<TSize> active;
+    TSize next = 0;
+    TSize n = length(tree.intervals);
+    if (!empty(queryBegins))
+        _seedImplicitIntervalSweep(active, next, tree, (TValue)front(queryBegins));
+
+    for (TQuerySize q = 0; q < length(queryBegins); ++q)
+    {
+        TValue queryBegin = queryBegins[q];
+        TValue queryEnd = queryEnds[q];
+        SEQAN_ASSERT(q == 0 || !(queryBegin < queryBegins[q - 1]));
+
+        for (; next < n && leftBoundary(tree.intervals[next]) < queryEnd; ++next)
+            appendValue(active, next, Generous());
+
+        // Query ends are not sorted, so active intervals may start behind the current query end.  Intervals that
+        // end before the current query begin can't overlap any later query and are dropped.
+        TActiveIter itDst = begin(active, Standard());
+        TActiveIter itActiveEnd = end(active, Standard());
+        for (TActiveIter itActive = itDst; itActive != itActiveEnd; ++itActive)
+        {
+            TInterval const & interval = tree.intervals[*itActive];
+            if (!(queryBegin < rightBoundary(interval)))
+                continue;
+            if (leftBoundary(interval) < queryEnd)
+                appendValue(concat(results), cargo(interval), Generous());
+            *itDst++ = *itActive;
+        }
+        resize(active, itDst - begin(active, Standard()));
+        appendValue(stringSetLimits(results), length(concat(results)), Generous());
+    }
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_HEADER_MISC_IMPLICIT_INTERVAL_TREE_H
@@ -32,10 +32,9 @@
 // Author: David Weese <david.weese@fu-berlin.de>
 // ==========================================================================
 
-//TODO(weese): Make the name stores thread-safe, i.e. provide an atomic
-//             getIdByName() that returns the id of an existing name or append
-//             the new one with its id
-
+//TODO(weese): Provide an atomic getIdByName() that returns the id of an
+//             existing name or appends the new one with its id.  Lookups are
+//             thread-safe already, appendName() still needs to be serialized.
 
 #ifndef SEQAN_HEADER_MISC_NAME_STORE_CACHE_H
 #define SEQAN_HEADER_MISC_NAME_STORE_CACHE_H
@@ -102,6 +101,11 @@ struct NameStoreLess_
  * @tparam TNameStore The type to use for the name store.  Usually a @link StringSet @endlink.
  * @tparam TName      The type to use for the names.  Defaults to <tt>Value&lt;TNameStore&gt;::Type</tt>.
  *
+ * The cache is an open addressing hash table that stores the ids together with the precomputed hashes of their
+ * names.  Lookups with @link NameStoreCache#getIdByName @endlink do not modify the cache and can be run
+ * concurrently from multiple threads.  Calls to @link NameStoreCache#appendName @endlink and
+ * @link NameStoreCache#refresh @endlink must not run concurrently with other accesses.
+ *
  *
  * @fn NameStoreCache::NameStoreCache
  * @brief Constructor
@@ -122,6 +126,9 @@ struct NameStoreLess_
 ..param.TName:The name type.
 ...default:$Value<TNameStore>::Type$
 ...type:Shortcut.CharString
+..remarks:The cache is an open addressing hash table of ids and their precomputed name hashes.
+Lookups via @Function.getIdByName@ don't modify the cache and are thread-safe.
+@Function.appendName@ and @Function.refresh@ must not be called concurrently with other accesses.
 
 .Memfunc.NameStoreCache#NameStoreCache
 ..summary:Constructor
@@ -137,20 +144,20 @@ class NameStoreCache
 {
 public:
     typedef typename Position<TNameStore>::Type TId;
-    typedef NameStoreLess_<TNameStore, TName> TLess;
-    typedef std::set<TId, TLess> TSet;
-    
-    TSet nameSet;
+    typedef __uint32                            THash;
+    typedef String<TId>                         TIds;
+    typedef String<THash>                       THashes;
+
+    TIds ids;               // slots of the hash table, maxValue<TId>() marks an empty slot
+    THashes hashes;         // hash of the name in the corresponding slot
+    TId numNames;           // number of occupied slots
     TNameStore *nameStore;
-    // TODO(holtgrew): Mutable here necessary for conceptual const-ness.  However, we would rather have a thread-safe interface!
-    TName mutable name;
 
     NameStoreCache(TNameStore &_nameStore):
-        nameSet(TLess(_nameStore, name)),
+        numNames(0),
         nameStore(&_nameStore)
     {
-        for (unsigned i = 0; i < length(*nameStore); ++i)
-            nameSet.insert(i);
+        refresh(*this);
     }
 };
 
@@ -162,6 +169,111 @@ public:
 // Functions
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Function _nameStoreHash()
+// ----------------------------------------------------------------------------
+
+// FNV-1a over the characters of the name.
+template <typename TName>
+inline __uint32
+_nameStoreHash(TName const & name)
+{
+    typedef typename Iterator<TName const, Standard>::Type TIter;
+
+    __uint32 hash = 2166136261u;
+    TIter itEnd = end(name, Standard());
+    for (TIter it = begin(name, Standard()); it != itEnd; ++it)
+    {
+        hash ^= ordValue(*it);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// ----------------------------------------------------------------------------
+// Function _findNameStoreSlot()
+// ----------------------------------------------------------------------------
+
+// Returns the slot holding the id of name or the empty slot where it has to be inserted.
+template <typename TNameStore, typename TName, typename TCName>
+inline typename Position<TNameStore>::Type
+_findNameStoreSlot(NameStoreCache<TNameStore, TCName> const & cache, TName const & name, __uint32 hash)
+{
+    typedef typename Position<TNameStore>::Type TId;
+
+    TId mask = length(cache.ids) - 1;
+    for (TId slot = hash & mask; ; slot = (slot + 1) & mask)
+    {
+        TId id = cache.ids[slot];
+        if (id == maxValue<TId>())
+            return slot;
+        if (cache.hashes[slot] == hash && (*cache.nameStore)[id] == name)
+            return slot;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _insertNameStoreId()
+// ----------------------------------------------------------------------------
+
+// Registers the id of an existing name store entry.  Ids of duplicate names are ignored, i.e. the first one wins.
+template <typename TNameStore, typename TCName, typename TId>
+inline void
+_insertNameStoreId(NameStoreCache<TNameStore, TCName> & cache, TId id)
+{
+    typedef typename Position<TNameStore>::Type TPos;
+
+    __uint32 hash = _nameStoreHash((*cache.nameStore)[id]);
+    TPos slot = _findNameStoreSlot(cache, (*cache.nameStore)[id], hash);
+    if (cache.ids[slot] != maxValue<TPos>())
+        return;
+    cache.ids[slot] = id;
+    cache.hashes[slot] = hash;
+    ++cache.numNames;
+}
+
+// ----------------------------------------------------------------------------
+// Function _resizeNameStoreCache()
+// ----------------------------------------------------------------------------
+
+// Rebuilds the table with at least twice as many slots as names.
+template <typename TNameStore, typename TCName, typename TSize>
+inline void
+_resizeNameStoreCache(NameStoreCache<TNameStore, TCName> & cache, TSize numNames)
+{
+    typedef NameStoreCache<TNameStore, TCName>  TCache;
+    typedef typename TCache::TId                TId;
+    typedef typename TCache::TIds               TIds;
+    typedef typename TCache::THashes            THashes;
+    typedef typename Iterator<TIds, Standard>::Type TIter;
+
+    TId tableSize = 16;
+    while (tableSize < 2 * (TId)numNames)
+        tableSize *= 2;
+
+    TIds oldIds;
+    THashes oldHashes;
+    swap(oldIds, cache.ids);
+    swap(oldHashes, cache.hashes);
+    resize(cache.ids, tableSize, maxValue<TId>(), Exact());
+    resize(cache.hashes, tableSize, Exact());
+
+    // Re-insert the old entries without comparing names, they are unique already.
+    TId mask = tableSize - 1;
+    TIter itEnd = end(oldIds, Standard());
+    for (TIter it = begin(oldIds, Standard()); it != itEnd; ++it)
+    {
+        if (*it == maxValue<TId>())
+            continue;
+        __uint32 hash = oldHashes[it - begin(oldIds, Standard())];
+        TId slot = hash & mask;
+        while (cache.ids[slot] != maxValue<TId>())
+            slot = (slot + 1) & mask;
+        cache.ids[slot] = *it;
+        cache.hashes[slot] = hash;
+    }
+}
+
 // ----------------------------------------------------------------------------
 // refresh()
 // ----------------------------------------------------------------------------
@@ -191,9 +303,12 @@ template <typename TNameStore, typename TName>
 inline void
 refresh(NameStoreCache<TNameStore, TName> &cache)
 {
-    cache.nameSet.clear();
+    clear(cache.ids);
+    clear(cache.hashes);
+    cache.numNames = 0;
+    _resizeNameStoreCache(cache, length(*cache.nameStore));
     for (unsigned i = 0; i < length(*cache.nameStore); ++i)
-        cache.nameSet.insert(i);
+        _insertNameStoreId(cache, i);
 }
 
 
@@ -266,30 +381,14 @@ template<typename TNameStore, typename TName, typename TPos, typename TCNameStor
 inline bool
 getIdByName(TNameStore const & /*nameStore*/, TName const & name, TPos & pos, NameStoreCache<TCNameStore, TCName> const & context)
 {
-    typedef typename Position<TNameStore const>::Type TId;
-    typedef NameStoreCache<TCNameStore, TCName> const TNameStoreCache;
-    typedef typename TNameStoreCache::TSet TSet;
-
-    TSet const &set = context.nameSet;
-    typename TSet::const_iterator it;
-
-    // (weese:)
-    // To avoid local variables to copy the name into we use a member in context.
-    // However, changing the NameStoreCache per query is not thread-safe and the user might not notice it.
-    // To avoid pitfalls, we should introduce a critical section.
-    //SEQAN_OMP_PRAGMA(critical (nameStoreFind))
-    {
-
-        context.name = name;
-        it = set.find(maxValue<TId>());
-    }
-    
-    if (it != set.end())
-    {
-        pos = *it;
-        return true;
-    }
-    return false;
+    typedef typename Position<TCNameStore>::Type TId;
+
+    // The lookup only reads from the cache and is safe to be called from multiple threads.
+    TId id = context.ids[_findNameStoreSlot(context, name, _nameStoreHash(name))];
+    if (id == maxValue<TId>())
+        return false;
+    pos = id;
+    return true;
 }
 
 // ----------------------------------------------------------------------------
@@ -342,7 +441,9 @@ inline void
 appendName(TNameStore &nameStore, TName const & name, NameStoreCache<TCNameStore, TCName> &context)
 {
     appendValue(nameStore, name, Generous());
-    context.nameSet.insert(length(nameStore) - 1);
+    if (2 * (context.numNames + 1) > length(context.ids))
+        _resizeNameStoreCache(context, context.numNames + 1);
+    _insertNameStoreId(context, length(nameStore) - 1);
 }
 
 }  // namespace seqan
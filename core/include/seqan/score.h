@@ -47,5 +47,6 @@
 #include <seqan/score/score_matrix_io.h>
 #include <seqan/score/score_matrix_data.h>
 #include <seqan/score/score_simple.h>
+#include <seqan/score/score_query_profile.h>
 
 #endif  // SEQAN_SCORE_H_
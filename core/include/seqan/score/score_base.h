@@ -190,6 +190,17 @@ sequenceEntryForScore(TScore const & /*scoringScheme*/, TSequence const & seq, T
     return seq[pos];
 }
 
+// ----------------------------------------------------------------------------
+// Function _checkSequenceForScore()
+// ----------------------------------------------------------------------------
+
+// Scoring schemes that are bound to a horizontal sequence overload this function and abort if seqH does not fit.
+
+template <typename TScore, typename TSequenceH>
+inline void
+_checkSequenceForScore(TScore const & /*scoringScheme*/, TSequenceH const & /*seqH*/)
+{}
+
 /*!
  * @fn Score#scoreGapOpenHorizontal
  * @brief Returns the score for opening a gap in horizontal direction.
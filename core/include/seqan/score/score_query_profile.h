@@ -0,0 +1,293 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Query profile scoring scheme, precomputes the score rows of a query.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_SCORE_SCORE_QUERY_PROFILE_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_SCORE_SCORE_QUERY_PROFILE_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+template <typename TScore, typename TSequence>
+struct QueryProfile;
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class QueryProfile Score
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class QueryProfileScore QueryProfile Score
+ * @extends Score
+ * @headerfile <seqan/score.h>
+ * @brief Scoring scheme with precomputed score rows for one query sequence.
+ *
+ * @signature template <typename TValue, typename TScore, typename TSequence>
+ *            class Score<TValue, QueryProfile<TScore, TSequence> >;
+ *
+ * @tparam TValue    The score value type, must be the value type of TScore.
+ * @tparam TScore    The underlying scoring scheme, e.g. <tt>Blosum62</tt>.
+ * @tparam TSequence The type of the query sequence.
+ *
+ * For each position of the query, the scores of the query character against all characters of the alphabet are
+ * stored in one row.  The row of a query position is looked up once and then indexed with the ordinal value of the
+ * other character, which replaces the two-dimensional lookup of the score matrix.
+ *
+ * The query has to be the horizontal sequence (first row) of all alignments computed with this scoring scheme.  It
+ * pays off when the same query is aligned many times, e.g. against a database or in library building.
+ */
+
+/*!
+ * @fn QueryProfileScore::Score
+ * @brief Constructor
+ *
+ * @signature Score::Score();
+ * @signature Score::Score(scoringScheme, query);
+ *
+ * @param[in] scoringScheme The underlying scoring scheme, type TScore.
+ * @param[in] query         The query to compute the profile for, type TSequence.
+ */
+
+/**
+.Spec.QueryProfile Score
+..cat:Scoring
+..general:Class.Score
+..summary:Scoring scheme with precomputed score rows for one query sequence.
+..signature:Score<TValue, QueryProfile<TScore, TSequence> >
+..param.TValue:The score value type, must be the value type of $TScore$.
+..param.TScore:The underlying scoring scheme, e.g. @Shortcut.Blosum62@.
+...type:Class.Score
+..param.TSequence:The type of the query sequence.
+..description:
+For each position of the query, the scores of the query character against all characters of the alphabet are stored in one row.
+The row of a query position is looked up once and then indexed with the ordinal value of the other character, which replaces the two-dimensional lookup of the score matrix.
+..remarks:The query has to be the horizontal sequence (first row) of all alignments computed with this scoring scheme.
+It pays off when the same query is aligned many times, e.g. against a database or in library building.
+..include:seqan/score.h
+
+.Memfunc.QueryProfile Score#Score
+..class:Spec.QueryProfile Score
+..summary:Constructor.
+..signature:Score()
+..signature:Score(scoringScheme, query)
+..param.scoringScheme:The underlying scoring scheme.
+..param.query:The query to compute the profile for.
+..see:Function.assignQuery
+*/
+
+template <typename TValue, typename TScore, typename TSequence>
+class Score<TValue, QueryProfile<TScore, TSequence> >
+{
+public:
+    typedef typename Value<TSequence>::Type TAlphabet_;
+
+    enum {
+        VALUE_SIZE = ValueSize<TAlphabet_>::VALUE
+    };
+
+    // The score rows, VALUE_SIZE entries for each query position.
+    String<TValue> rows;
+
+    // The gap extension score.
+    TValue data_gap_extend;
+
+    // The gap open score.
+    TValue data_gap_open;
+
+    Score() : data_gap_extend(-1), data_gap_open(-1)
+    {}
+
+    Score(TScore const & scoringScheme, TSequence const & query) :
+        data_gap_extend(scoreGapExtend(scoringScheme)), data_gap_open(scoreGapOpen(scoringScheme))
+    {
+        assignQuery(*this, scoringScheme, query);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class QueryProfileEntry_
+// ----------------------------------------------------------------------------
+
+// Sequence entry of the QueryProfile Score.  For the query, _row points to the score row of the position.  For the
+// other sequence, only the ordinal value is used.
+
+template <typename TValue>
+struct QueryProfileEntry_
+{
+    TValue const * _row;
+    unsigned _ord;
+
+    QueryProfileEntry_() : _row(0), _ord(0)
+    {}
+
+    QueryProfileEntry_(TValue const * row, unsigned ord) : _row(row), _ord(ord)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction SequenceEntryForScore                    [QueryProfile Score]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TScore, typename TQuery, typename TSequence>
+struct SequenceEntryForScore<Score<TValue, QueryProfile<TScore, TQuery> >, TSequence>
+{
+    typedef QueryProfileEntry_<TValue> Type;
+};
+
+template <typename TValue, typename TScore, typename TQuery, typename TSequence>
+struct SequenceEntryForScore<Score<TValue, QueryProfile<TScore, TQuery> > const, TSequence> :
+    SequenceEntryForScore<Score<TValue, QueryProfile<TScore, TQuery> >, TSequence>
+{};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function assignQuery()                                [QueryProfile Score]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn QueryProfileScore#assignQuery
+ * @brief Compute the score rows for a query.
+ *
+ * @signature void assignQuery(score, scoringScheme, query);
+ *
+ * @param[out] score         The QueryProfile Score to compute the rows for.
+ * @param[in]  scoringScheme The underlying scoring scheme.  Its gap scores are copied as well.
+ * @param[in]  query         The query sequence.
+ */
+
+/**
+.Function.assignQuery
+..class:Spec.QueryProfile Score
+..cat:Scoring
+..summary:Compute the score rows for a query.
+..signature:assignQuery(score, scoringScheme, query)
+..param.score:The QueryProfile Score to compute the rows for.
+...type:Spec.QueryProfile Score
+..param.scoringScheme:The underlying scoring scheme. Its gap scores are copied as well.
+...type:Class.Score
+..param.query:The query sequence.
+..include:seqan/score.h
+*/
+
+template <typename TValue, typename TScore, typename TSequence>
+void
+assignQuery(Score<TValue, QueryProfile<TScore, TSequence> > & me,
+            TScore const & scoringScheme,
+            TSequence const & query)
+{
+    typedef Score<TValue, QueryProfile<TScore, TSequence> > TProfileScore;
+    typedef typename TProfileScore::TAlphabet_ TAlphabet;
+    typedef typename Iterator<String<TValue>, Standard>::Type TRowIterator;
+
+    me.data_gap_extend = scoreGapExtend(scoringScheme);
+    me.data_gap_open = scoreGapOpen(scoringScheme);
+
+    resize(me.rows, length(query) * TProfileScore::VALUE_SIZE, Exact());
+    TRowIterator it = begin(me.rows, Standard());
+    for (unsigned i = 0; i < length(query); ++i)
+    {
+        TAlphabet c = query[i];
+        for (unsigned j = 0; j < (unsigned)TProfileScore::VALUE_SIZE; ++j, ++it)
+            *it = score(scoringScheme, c, TAlphabet(j));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function sequenceEntryForScore()                      [QueryProfile Score]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TScore, typename TQuery, typename TSequence, typename TPosition>
+inline QueryProfileEntry_<TValue>
+sequenceEntryForScore(Score<TValue, QueryProfile<TScore, TQuery> > const & me,
+                      TSequence const & seq,
+                      TPosition pos)
+{
+    typedef Score<TValue, QueryProfile<TScore, TQuery> > TProfileScore;
+    typedef typename TProfileScore::TAlphabet_ TAlphabet;
+
+    // We do not know whether seq is the query, so the row is set for all positions within the query.
+    unsigned offset = pos * TProfileScore::VALUE_SIZE;
+    TValue const * row = (offset < length(me.rows)) ? begin(me.rows, Standard()) + offset : 0;
+    return QueryProfileEntry_<TValue>(row, ordValue(static_cast<TAlphabet>(seq[pos])));
+}
+
+// ----------------------------------------------------------------------------
+// Function _checkSequenceForScore()                     [QueryProfile Score]
+// ----------------------------------------------------------------------------
+
+// The rows are looked up by position, so aligning a horizontal sequence other than the query silently gives wrong
+// scores.  We can only compare the lengths, and we do so regardless of the debug level.
+
+template <typename TValue, typename TScore, typename TQuery, typename TSequenceH>
+inline void
+_checkSequenceForScore(Score<TValue, QueryProfile<TScore, TQuery> > const & me, TSequenceH const & seqH)
+{
+    typedef Score<TValue, QueryProfile<TScore, TQuery> > TProfileScore;
+
+    SEQAN_CHECK(length(seqH) * TProfileScore::VALUE_SIZE == length(me.rows),
+                "The horizontal sequence (length %u) is not the profiled query (length %u).",
+                (unsigned)length(seqH), (unsigned)(length(me.rows) / TProfileScore::VALUE_SIZE));
+}
+
+// ----------------------------------------------------------------------------
+// Function score()                                      [QueryProfile Score]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TScore, typename TSequence>
+inline TValue
+score(Score<TValue, QueryProfile<TScore, TSequence> > const & /*me*/,
+      QueryProfileEntry_<TValue> const & entryH,
+      QueryProfileEntry_<TValue> const & entryV)
+{
+    SEQAN_ASSERT(entryH._row != 0);
+    return entryH._row[entryV._ord];
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_SCORE_SCORE_QUERY_PROFILE_H_
@@ -52,6 +52,7 @@
 #include <seqan/align.h>
 #include <seqan/map.h>
 #include <seqan/modifier.h>
+#include <seqan/parallel.h>
 
 // ===========================================================================
 // Seeds Module
@@ -50,11 +50,81 @@ namespace seqan {
 ..see:Function.chainSeedsGlobally
 ..tag:SparseChaining:
     Chaining as described in (Gusfield, 1997) section 13.3.
+..tag:RangeMaxChaining:
+    Same result as $SparseChaining$ but the sweep uses sorted arrays and a range maximum (Fenwick) tree instead of
+    node based sets.
 ..include:seqan/seeds.h
  */
 struct SparseChaining_;
 typedef Tag<SparseChaining_> SparseChaining;
 
+/*!
+ * @defgroup GlobalChainingTags Global Chaining Tags
+ * @brief Tags for selecting the global chaining algorithm.
+ */
+
+/*!
+ * @tag GlobalChainingTags#RangeMaxChaining
+ * @headerfile <seqan/seeds.h>
+ * @brief Sparse chaining with a sorted-array sweep and a range maximum tree.
+ *
+ * @signature struct RangeMaxChaining_;
+ * @signature typedef Tag<RangeMaxChaining_> RangeMaxChaining;
+ *
+ * Computes the same chain weight as <tt>SparseChaining</tt>.  The end positions in the vertical dimension are
+ * compressed to ranks and the best chain ending left of a rank is queried from a Fenwick tree.  All data lives in
+ * flat arrays.
+ */
+
+struct RangeMaxChaining_;
+typedef Tag<RangeMaxChaining_> RangeMaxChaining;
+
+/*!
+ * @class GapCostChaining
+ * @headerfile <seqan/seeds.h>
+ * @brief Global chaining with gap costs and a bounded look-back.
+ *
+ * @signature class GapCostChaining;
+ *
+ * The seeds are sorted by their end positions.  For each seed, only the <tt>maxLookBack</tt> closest predecessors
+ * whose distance is at most <tt>maxGap</tt> in both dimensions are considered.  A seed contributes
+ * <tt>seedSize(seed) * scoreMatch(score)</tt>; the difference between the horizontal and the vertical distance of two
+ * consecutive seeds is scored as a gap with the gap open and extend scores of the scoring scheme.
+ *
+ * @var TSize GapCostChaining::maxGap
+ * @brief Largest distance between two consecutive seeds in each dimension, defaults to 5000.
+ * @var TSize GapCostChaining::maxLookBack
+ * @brief Number of predecessors considered for each seed, defaults to 50.
+ */
+
+/**
+.Class.GapCostChaining
+..cat:Seed Handling
+..summary:Global chaining with gap costs and a bounded look-back.
+..signature:GapCostChaining
+..remarks:For each seed, only the $maxLookBack$ closest predecessors whose distance is at most $maxGap$ in both
+dimensions are considered.
+A seed contributes $seedSize(seed) * scoreMatch(score)$, the difference of the distances of two consecutive seeds in
+both dimensions is scored as a gap.
+..memvar.GapCostChaining#maxGap:Largest distance between two consecutive seeds in each dimension, defaults to 5000.
+..memvar.GapCostChaining#maxLookBack:Number of predecessors considered for each seed, defaults to 50.
+..see:Function.chainSeedsGlobally
+..include:seqan/seeds.h
+*/
+
+class GapCostChaining
+{
+public:
+    unsigned maxGap;
+    unsigned maxLookBack;
+
+    GapCostChaining() : maxGap(5000), maxLookBack(50)
+    {}
+
+    GapCostChaining(unsigned maxGap_, unsigned maxLookBack_) : maxGap(maxGap_), maxLookBack(maxLookBack_)
+    {}
+};
+
 // ===========================================================================
 // Metafunctions
 // ===========================================================================
@@ -69,10 +139,21 @@ typedef Tag<SparseChaining_> SparseChaining;
  * @brief Global chaining of seeds.
  *
  * @signature void chainSeedsGlobally(target, seedSet, tag);
+ * @signature TScoreValue chainSeedsGlobally(target, seedSet, score, gapCostChaining);
+ * @signature void chainSeedsGlobally(targets, seedSets, tag, Parallel());
+ * @signature void chainSeedsGlobally(targets, seedSets, score, gapCostChaining, Parallel());
  *
  * @param[out] target  A @link ContainerConcept container @endlink to append the seeds to.
- * @param[in]  seedSet The SeedSet object to get the seeds from.
- * @param[in]  tag     The tag to select the algorithm with (currently only <tt>SparseChaining</tt> is supported).
+ * @param[in]  seedSet The SeedSet object to get the seeds from.  <tt>RangeMaxChaining</tt> and
+ *                     <tt>GapCostChaining</tt> also accept a String of seeds.
+ * @param[in]  tag     The tag to select the algorithm with, <tt>SparseChaining</tt> or <tt>RangeMaxChaining</tt>.
+ * @param[in]  score   The scoring scheme for seeds and gaps between them, used by <tt>GapCostChaining</tt>.
+ * @param[in]  gapCostChaining The GapCostChaining object with the gap and look-back limits.
+ * @param[out] targets A String of containers, one chain per seed set.
+ * @param[in]  seedSets A String of seed sets or seed strings, e.g. one per query/reference pair.  The seed sets are
+ *                     chained independently and in parallel.
+ *
+ * @return TScoreValue The score of the best chain for <tt>GapCostChaining</tt>.
  */
 
 // TODO(holtgrew): Implement scored!
@@ -80,6 +161,20 @@ typedef Tag<SparseChaining_> SparseChaining;
 .Function.chainSeedsGlobally
 ..summary:Global chaining of seeds.
 ..signature:chainSeedsGlobally(target, seedSet, tag)
+..signature:chainSeedsGlobally(target, seedSet, score, gapCostChaining)
+..signature:chainSeedsGlobally(targets, seedSets, tag, Parallel())
+..signature:chainSeedsGlobally(targets, seedSets, score, gapCostChaining, Parallel())
+..param.target:Container to write the chain to.
+..param.seedSet:The SeedSet object to get the seeds from.
+...remarks:$RangeMaxChaining$ and $GapCostChaining$ also accept a @Class.String@ of seeds.
+..param.tag:The tag to select the algorithm with.
+...type:Tag.Global Chaining
+..param.score:The scoring scheme for seeds and gaps between them.
+..param.gapCostChaining:Limits for gaps and look-back.
+...type:Class.GapCostChaining
+..param.targets:A @Class.String@ of containers, one chain per seed set.
+..param.seedSets:A @Class.String@ of seed sets or seed strings that are chained independently and in parallel.
+..returns:The score of the best chain for $GapCostChaining$, nothing otherwise.
 ..include:seqan/seeds.h
 */
 template <typename TTargetContainer, typename TSeedSpec, typename TSeedSetSpec>
@@ -158,80 +253,49 @@ chainSeedsGlobally(
             // Find the closest seed (in dimension 1) to seed k with an
             // entry in intermediateSolutions whose end coordinate in
             // dimension 1 is <= the begin coordinate in dimension 1
-            // of seedK.
+            // of seedK.  The qualities in intermediateSolutions grow
+            // with the end coordinate, so this is the best predecessor.
             //
             // STL gives us upper_bound which returns a pointer to the
             // *first* one that compares greater than the reference
             // one.  Searching for the this one and decrementing the
-            // result iterator gives the desired result.
-            TIntermediateSolution referenceSolution(beginPositionV(seedK), 0, maxValue<unsigned>());
-            // std::cout << "    intermediateSolutions.upper_bound(" << beginPositionV(seedK) << ")" << std::endl;
+            // result iterator gives the desired result.  The reference
+            // must compare greater than all solutions ending at the
+            // begin coordinate, these are valid predecessors.
+            TIntermediateSolution referenceSolution(beginPositionV(seedK), maxValue<TSize>(), maxValue<unsigned>());
             TIntermediateSolutionsIterator itJ = intermediateSolutions.upper_bound(referenceSolution);
-            if (itJ == intermediateSolutions.begin()) {
-                if (intermediateSolutions.size() > 0 &&
-                    intermediateSolutions.rbegin()->i1 <= beginPositionV(seedK)) {
-                    itJ = intermediateSolutions.end();
-                    --itJ;
-                } else {
-                    continue;
-                }
-            } else {
-                SEQAN_ASSERT_GT(intermediateSolutions.size(), 0u);  // TODO(holtgrew): Remove this assertion?
-                --itJ;
-            }
-            // std::cout << "     --> " << seeds[itJ->i3] << std::endl;
+            if (itJ == intermediateSolutions.begin())
+                continue;
+            --itJ;
             // Now, we have found such a seed j.
-            SEQAN_ASSERT_LEQ(endPositionV(seeds[itJ->i3]), endPositionV(seedK));
+            SEQAN_ASSERT_LEQ(endPositionV(seeds[itJ->i3]), beginPositionV(seedK));
             // Update the intermediate solution value for k and set predecessor.
             qualityOfChainEndingIn[it->i3] += itJ->i2;
-            // std::cout << "  UPDATE qualityOfChainEndingIn[" << it->i3 << "] == " << qualityOfChainEndingIn[it->i3] << std::endl;
             predecessor[it->i3] = itJ->i3;
-            // std::cout << "         predecessor[" << it->i3 << "] == " << itJ->i3 << std::endl;
         } else {  // Is end point.
-            // Search for the first triple in intermediateSolutions
-            // where the end coordinate in dimension 1 is >= end
-            // coordinate in dimension 1 for seed k.  The corresponding
-            // seed is seed j.
-            //
-            // We work with upper_bound here which gives us the first
-            // value that is > so we have to work around this to get
-            // >= again...
-            SEQAN_ASSERT_GT(endPositionV(seedK), 0u);
-            TIntermediateSolution referenceSolution(endPositionV(seedK), 0, maxValue<unsigned>());
+            // The chain ending in k is only useful if no solution that
+            // ends at or before the end coordinate in dimension 1 of
+            // seed k has at least the same quality.
+            TSize qualityK = qualityOfChainEndingIn[it->i3];
+            TIntermediateSolution referenceSolution(endPositionV(seedK), maxValue<TSize>(), maxValue<unsigned>());
             TIntermediateSolutionsIterator itSol = intermediateSolutions.upper_bound(referenceSolution);
-            if (itSol == intermediateSolutions.end()) {
-                // None found.  Insert a new triple for seed k.
-                TIntermediateSolution sol(endPositionV(seedK), qualityOfChainEndingIn[it->i3], it->i3);
-                // std::cout << "  INSERT (" << sol.i1 << ", " << sol.i2 << ", " << sol.i3 << ") " << __LINE__ << std::endl;
-                intermediateSolutions.insert(sol);
-            } else {
-                // Found this intermediate solution.
-                SEQAN_ASSERT_GEQ(itSol->i1, endPositionV(seedK));
-                TSeed const & seedJ = seeds[itSol->i3];
-                // Possibly start a new chain at k if the end1 is
-                // before the end1 of the chain ending in j or they
-                // end at the same coordinate in dim1 but k already
-                // has a higher quality than the whole chaing ending
-                // at j.
-                if (endPositionV(seedJ) > endPositionV(seedK) ||
-                    (endPositionV(seedJ) == endPositionV(seedK) && qualityOfChainEndingIn[it->i3] > itSol->i2)) {
-                    TIntermediateSolution sol(endPositionV(seedK), qualityOfChainEndingIn[it->i3], it->i3);
-                    // std::cout << "  INSERT (" << sol.i1 << ", " << sol.i2 << ", " << sol.i3 << ")" << __LINE__  << std::endl;
-                    intermediateSolutions.insert(sol);
-                }
-            }
-            
-            // Delete all intermediate solutions where end1 >= end1 of k and have a lower quality than k.
-            TIntermediateSolutionsIterator itDel = intermediateSolutions.upper_bound(referenceSolution);
-            TIntermediateSolutionsIterator itDelEnd = intermediateSolutions.end();
-            while (itDel != itDelEnd) {
-                TIntermediateSolutionsIterator ptr = itDel;
-                ++itDel;
-                if (qualityOfChainEndingIn[it->i3] > ptr->i2) {
-                    // std::cout << "  ERASE (" << ptr->i1 << ", " << ptr->i2 << ", " << ptr->i3 << ")" << std::endl;
-                    intermediateSolutions.erase(ptr);
-                }
+            if (itSol != intermediateSolutions.begin()) {
+                TIntermediateSolutionsIterator itPrev = itSol;
+                --itPrev;
+                if (itPrev->i2 >= qualityK)
+                    continue;
             }
+
+            // Delete all intermediate solutions where end1 >= end1 of k and
+            // that do not have a higher quality than k.  Then insert k.  This
+            // keeps the qualities increasing with the end coordinate.
+            TIntermediateSolution lowerSolution(endPositionV(seedK), 0, 0);
+            TIntermediateSolutionsIterator itDel = intermediateSolutions.lower_bound(lowerSolution);
+            TIntermediateSolutionsIterator itDelEnd = itDel;
+            while (itDelEnd != intermediateSolutions.end() && itDelEnd->i2 <= qualityK)
+                ++itDelEnd;
+            intermediateSolutions.erase(itDel, itDelEnd);
+            intermediateSolutions.insert(TIntermediateSolution(endPositionV(seedK), qualityK, it->i3));
         }
     }
 
@@ -242,6 +306,8 @@ chainSeedsGlobally(
     // -----------------------------------------------------------------------
     // TODO(holtgrew): We could use two different algorithms for target containers that are strings and those that are lists.
     clear(target);
+    if (intermediateSolutions.empty())
+        return;
     unsigned next = intermediateSolutions.rbegin()->i3;
     while (next != maxValue<unsigned>())
     {
@@ -273,6 +339,333 @@ chainSeedsGlobally(
     #endif  // #if SEQAN_ENABLE_DEBUG
 }
 
+// ---------------------------------------------------------------------------
+// Function _copySeedsForChaining()
+// ---------------------------------------------------------------------------
+
+template <typename TSeed, typename TSeedSpec, typename TSeedSetSpec>
+inline void
+_copySeedsForChaining(String<TSeed> & seeds, SeedSet<TSeedSpec, TSeedSetSpec> const & seedSet)
+{
+    resize(seeds, length(seedSet), Exact());
+    std::copy(seedSet._seeds.begin(), seedSet._seeds.end(), begin(seeds, Standard()));
+}
+
+template <typename TSeed, typename TSeed2, typename TSpec>
+inline void
+_copySeedsForChaining(String<TSeed> & seeds, String<TSeed2, TSpec> const & seedString)
+{
+    assign(seeds, seedString, Exact());
+}
+
+// ---------------------------------------------------------------------------
+// Function _writeChain()
+// ---------------------------------------------------------------------------
+
+// Writes the chain ending in seed last to target, following the predecessor links.
+
+template <typename TTargetContainer, typename TSeed>
+inline void
+_writeChain(TTargetContainer & target, String<TSeed> const & seeds, String<unsigned> const & predecessor,
+            unsigned last)
+{
+    clear(target);
+    for (unsigned next = last; next != maxValue<unsigned>(); next = predecessor[next])
+        appendValue(target, seeds[next]);
+    reverse(target);
+}
+
+// ---------------------------------------------------------------------------
+// Function _rangeMaxTreeQuery()
+// ---------------------------------------------------------------------------
+
+// The range maximum tree is a Fenwick tree over (quality, seed index) pairs.  Entry 0 is unused, _rangeMaxTreeQuery()
+// returns the maximum of the ranks [0, rank) and _rangeMaxTreeUpdate() raises the value of one rank.
+
+template <typename TSize>
+inline Pair<TSize, unsigned>
+_rangeMaxTreeQuery(String<Pair<TSize, unsigned> > const & tree, unsigned rank)
+{
+    Pair<TSize, unsigned> result(0, maxValue<unsigned>());
+    for (; rank > 0u; rank &= rank - 1)
+        if (tree[rank].i1 > result.i1)
+            result = tree[rank];
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Function _rangeMaxTreeUpdate()
+// ---------------------------------------------------------------------------
+
+template <typename TSize>
+inline void
+_rangeMaxTreeUpdate(String<Pair<TSize, unsigned> > & tree, unsigned rank, Pair<TSize, unsigned> const & value)
+{
+    for (++rank; rank < length(tree); rank += rank & (~rank + 1))
+        if (value.i1 > tree[rank].i1)
+            tree[rank] = value;
+}
+
+// ---------------------------------------------------------------------------
+// Function _chainSeedsGloballyRangeMax()
+// ---------------------------------------------------------------------------
+
+template <typename TTargetContainer, typename TSeed>
+void
+_chainSeedsGloballyRangeMax(TTargetContainer & target, String<TSeed> const & seeds)
+{
+    typedef typename Position<TSeed>::Type TPosition;
+    typedef typename Size<TSeed>::Type TSize;
+    typedef typename Iterator<String<TPosition> const, Standard>::Type TPositionIterator;
+
+    clear(target);
+    if (empty(seeds))
+        return;
+
+    // Compress the vertical end positions to ranks.
+    String<TPosition> endsV;
+    resize(endsV, length(seeds), Exact());
+    for (unsigned i = 0; i < length(seeds); ++i)
+        endsV[i] = endPositionV(seeds[i]);
+    std::sort(begin(endsV, Standard()), end(endsV, Standard()));
+    resize(endsV, std::unique(begin(endsV, Standard()), end(endsV, Standard())) - begin(endsV, Standard()));
+
+    // The interval points are sorted as in SparseChaining: end points come before begin points at the same position.
+    typedef Triple<TPosition, bool, unsigned> TIntervalPoint;
+    typedef typename Iterator<String<TIntervalPoint>, Standard>::Type TIntervalPointsIterator;
+
+    String<TIntervalPoint> intervalPoints;
+    reserve(intervalPoints, 2 * length(seeds), Exact());
+    String<TSize> qualityOfChainEndingIn;
+    resize(qualityOfChainEndingIn, length(seeds), Exact());
+    String<unsigned> predecessor;
+    resize(predecessor, length(seeds), maxValue<unsigned>(), Exact());
+    for (unsigned i = 0; i < length(seeds); ++i)
+    {
+        qualityOfChainEndingIn[i] = seedSize(seeds[i]);
+        appendValue(intervalPoints, TIntervalPoint(beginPositionH(seeds[i]), true, i));
+        appendValue(intervalPoints, TIntervalPoint(endPositionH(seeds[i]), false, i));
+    }
+    std::sort(begin(intervalPoints, Standard()), end(intervalPoints, Standard()));
+
+    String<Pair<TSize, unsigned> > tree;
+    resize(tree, length(endsV) + 1, Pair<TSize, unsigned>(0, maxValue<unsigned>()), Exact());
+
+    TPositionIterator itEndsBegin = begin(endsV, Standard());
+    TPositionIterator itEndsEnd = end(endsV, Standard());
+    Pair<TSize, unsigned> best(0, maxValue<unsigned>());
+    for (TIntervalPointsIterator it = begin(intervalPoints, Standard()), itEnd = end(intervalPoints, Standard());
+         it != itEnd; ++it)
+    {
+        unsigned k = it->i3;
+        if (it->i2)
+        {
+            // Begin point: append seed k to the best chain ending left of and above it.
+            unsigned rank = std::upper_bound(itEndsBegin, itEndsEnd, beginPositionV(seeds[k])) - itEndsBegin;
+            Pair<TSize, unsigned> j = _rangeMaxTreeQuery(tree, rank);
+            if (j.i2 != maxValue<unsigned>())
+            {
+                qualityOfChainEndingIn[k] += j.i1;
+                predecessor[k] = j.i2;
+            }
+        }
+        else
+        {
+            // End point: the chain ending in seed k becomes available for seeds right of it.
+            unsigned rank = std::lower_bound(itEndsBegin, itEndsEnd, endPositionV(seeds[k])) - itEndsBegin;
+            Pair<TSize, unsigned> sol(qualityOfChainEndingIn[k], k);
+            _rangeMaxTreeUpdate(tree, rank, sol);
+            if (best.i2 == maxValue<unsigned>() || sol.i1 > best.i1)
+                best = sol;
+        }
+    }
+
+    _writeChain(target, seeds, predecessor, best.i2);
+}
+
+template <typename TTargetContainer, typename TSeedSpec, typename TSeedSetSpec>
+inline void
+chainSeedsGlobally(
+        TTargetContainer & target,
+        SeedSet<TSeedSpec, TSeedSetSpec> const & seedSet,
+        RangeMaxChaining const &)
+{
+    String<typename Value<SeedSet<TSeedSpec, TSeedSetSpec> >::Type> seeds;
+    _copySeedsForChaining(seeds, seedSet);
+    _chainSeedsGloballyRangeMax(target, seeds);
+}
+
+template <typename TTargetContainer, typename TSeed, typename TSpec>
+inline void
+chainSeedsGlobally(
+        TTargetContainer & target,
+        String<TSeed, TSpec> const & seedString,
+        RangeMaxChaining const &)
+{
+    String<TSeed> seeds;
+    _copySeedsForChaining(seeds, seedString);
+    _chainSeedsGloballyRangeMax(target, seeds);
+}
+
+// ---------------------------------------------------------------------------
+// Function _chainSeedsGloballyGapCost()
+// ---------------------------------------------------------------------------
+
+template <typename TSeed>
+struct LessEndPositions_
+{
+    bool operator()(TSeed const & a, TSeed const & b) const
+    {
+        if (endPositionH(a) != endPositionH(b))
+            return endPositionH(a) < endPositionH(b);
+        return endPositionV(a) < endPositionV(b);
+    }
+};
+
+template <typename TSeed>
+struct LessBeginEnd_
+{
+    bool operator()(TSeed const & a, TSeed const & b) const
+    {
+        return beginPositionH(a) < endPositionH(b);
+    }
+};
+
+template <typename TTargetContainer, typename TSeed, typename TScoreValue, typename TScoreSpec>
+TScoreValue
+_chainSeedsGloballyGapCost(TTargetContainer & target,
+                           String<TSeed> & seeds,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           GapCostChaining const & config)
+{
+    typedef typename Position<TSeed>::Type TPosition;
+    typedef typename MakeSigned<TPosition>::Type TSignedPosition;
+
+    clear(target);
+    if (empty(seeds))
+        return 0;
+
+    // Sort by end positions.  The possible predecessors of a seed then form a prefix of the array and the closest ones
+    // are found by walking back from the end of this prefix.
+    std::sort(begin(seeds, Standard()), end(seeds, Standard()), LessEndPositions_<TSeed>());
+
+    String<TScoreValue> scoreOfChainEndingIn;
+    resize(scoreOfChainEndingIn, length(seeds), Exact());
+    String<unsigned> predecessor;
+    resize(predecessor, length(seeds), maxValue<unsigned>(), Exact());
+
+    unsigned best = 0;
+    for (unsigned i = 0; i < length(seeds); ++i)
+    {
+        TSeed const & seedI = seeds[i];
+        TScoreValue seedScore = static_cast<TScoreValue>(seedSize(seedI)) * scoreMatch(scoringScheme);
+        scoreOfChainEndingIn[i] = seedScore;
+
+        // The begin positions are not sorted, so look up the end of the predecessor prefix by binary search.
+        unsigned candidatesEnd = std::upper_bound(begin(seeds, Standard()), begin(seeds, Standard()) + i, seedI,
+                                                  LessBeginEnd_<TSeed>()) - begin(seeds, Standard());
+
+        unsigned lookBack = 0;
+        for (unsigned j = candidatesEnd; j > 0u && lookBack < config.maxLookBack; ++lookBack)
+        {
+            TSeed const & seedJ = seeds[--j];
+            TSignedPosition distH = beginPositionH(seedI) - endPositionH(seedJ);
+            if (distH > static_cast<TSignedPosition>(config.maxGap))
+                break;  // All remaining candidates are even farther away.
+            if (endPositionV(seedJ) > beginPositionV(seedI))
+                continue;
+            TSignedPosition distV = beginPositionV(seedI) - endPositionV(seedJ);
+            if (distV > static_cast<TSignedPosition>(config.maxGap))
+                continue;
+
+            TSignedPosition gapLength = (distH > distV) ? distH - distV : distV - distH;
+            TScoreValue chainScore = scoreOfChainEndingIn[j] + seedScore;
+            if (gapLength > 0)
+                chainScore += scoreGapOpen(scoringScheme) + (gapLength - 1) * scoreGapExtend(scoringScheme);
+            if (chainScore > scoreOfChainEndingIn[i])
+            {
+                scoreOfChainEndingIn[i] = chainScore;
+                predecessor[i] = j;
+            }
+        }
+
+        if (scoreOfChainEndingIn[i] > scoreOfChainEndingIn[best])
+            best = i;
+    }
+
+    _writeChain(target, seeds, predecessor, best);
+    return scoreOfChainEndingIn[best];
+}
+
+template <typename TTargetContainer, typename TSeedSpec, typename TSeedSetSpec, typename TScoreValue,
+          typename TScoreSpec>
+inline TScoreValue
+chainSeedsGlobally(
+        TTargetContainer & target,
+        SeedSet<TSeedSpec, TSeedSetSpec> const & seedSet,
+        Score<TScoreValue, TScoreSpec> const & scoringScheme,
+        GapCostChaining const & config)
+{
+    String<typename Value<SeedSet<TSeedSpec, TSeedSetSpec> >::Type> seeds;
+    _copySeedsForChaining(seeds, seedSet);
+    return _chainSeedsGloballyGapCost(target, seeds, scoringScheme, config);
+}
+
+template <typename TTargetContainer, typename TSeed, typename TSpec, typename TScoreValue, typename TScoreSpec>
+inline TScoreValue
+chainSeedsGlobally(
+        TTargetContainer & target,
+        String<TSeed, TSpec> const & seedString,
+        Score<TScoreValue, TScoreSpec> const & scoringScheme,
+        GapCostChaining const & config)
+{
+    String<TSeed> seeds;
+    _copySeedsForChaining(seeds, seedString);
+    return _chainSeedsGloballyGapCost(target, seeds, scoringScheme, config);
+}
+
+// ---------------------------------------------------------------------------
+// Function chainSeedsGlobally()                                    [Parallel]
+// ---------------------------------------------------------------------------
+
+// The seed sets are independent, e.g. one per query/reference pair, and are chained in parallel.
+
+template <typename TTargetContainer, typename TTargetSpec, typename TSeedSets, typename TTag>
+void
+chainSeedsGlobally(
+        String<TTargetContainer, TTargetSpec> & targets,
+        TSeedSets const & seedSets,
+        TTag const & tag,
+        Parallel const &)
+{
+    typedef typename MakeSigned<typename Size<TSeedSets>::Type>::Type TSignedSize;
+
+    resize(targets, length(seedSets));
+    TSignedSize count = length(seedSets);
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (TSignedSize i = 0; i < count; ++i)
+        chainSeedsGlobally(targets[i], seedSets[i], tag);
+}
+
+template <typename TTargetContainer, typename TTargetSpec, typename TSeedSets, typename TScoreValue,
+          typename TScoreSpec>
+void
+chainSeedsGlobally(
+        String<TTargetContainer, TTargetSpec> & targets,
+        TSeedSets const & seedSets,
+        Score<TScoreValue, TScoreSpec> const & scoringScheme,
+        GapCostChaining const & config,
+        Parallel const &)
+{
+    typedef typename MakeSigned<typename Size<TSeedSets>::Type>::Type TSignedSize;
+
+    resize(targets, length(seedSets));
+    TSignedSize count = length(seedSets);
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (TSignedSize i = 0; i < count; ++i)
+        chainSeedsGlobally(targets[i], seedSets[i], scoringScheme, config);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_SEEDS_SEEDS_GLOBAL_CHAINING_H_
@@ -43,6 +43,7 @@
 
 #include <seqan/basic.h>
 #include <seqan/stream.h>
+#include <seqan/parallel.h>
 
 // ===========================================================================
 // Lower-Level I/O Interface for Sequences
@@ -61,6 +62,7 @@
 // SequenceStream
 // ===========================================================================
 
+#include <seqan/seq_io/sequence_stream_parallel.h>
 #include <seqan/seq_io/sequence_stream_impl.h>
 #include <seqan/seq_io/sequence_stream.h>
 
@@ -81,5 +83,6 @@
 // ===========================================================================
 
 #include <seqan/seq_io/fai_index.h>
+#include <seqan/seq_io/fai_index_view.h>
 
 #endif  // CORE_INCLUDE_SEQAN_SEQ_IO_H_
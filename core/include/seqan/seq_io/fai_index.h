@@ -93,6 +93,9 @@ public:
  * FAI indices allow the rast random access to sequences or parts of sequences in a FASTA file.  Originally, they were
  * introduced in the <a href="http://samtools.sourceforge.net/samtools.shtml">samtools</a> program.
  *
+ * FASTA files compressed with bgzip can be read if there is a GZI file with the block offsets next to them, e.g.
+ * <tt>ref.fa.gz.gzi</tt> as written by <tt>bgzip -i</tt>.  Only the blocks overlapping a region are decompressed.
+ *
  * Also see the <a href="http://trac.seqan.de/wiki/Tutorial/IndexedFastaIO">Indexed FASTA I/O Tutorial</a>.
  *
  * @section Example
@@ -117,6 +120,8 @@ public:
 ..signature:FaiIndex
 ..summary:Data type for storing FAI indices.
 ..wiki:Tutorial/IndexedFastaIO|Tutorial: Indexed FASTA I/O
+..remarks:FASTA files compressed with bgzip can be read if there is a GZI file with the block offsets next to them, e.g. $ref.fa.gz.gzi$ as written by $bgzip -i$.
+Only the blocks overlapping a region are decompressed.
 ..example.text:The following example demonstrate the usage of the FAIIndex class.
 ..example.file:demos/seq_io/fai_index_example.cpp
 ..include:seqan/seq_io.h
@@ -148,8 +153,19 @@ public:
     String<char, MMap<> > mmapString;
     bool mmapStringOpen;
 
+#if SEQAN_HAS_ZLIB
+    // Compressed FASTA files are read through this BGZF stream instead, reading changes its state.
+    mutable Stream<Bgzf> bgzfStream;
+    bool bgzfStreamOpen;
+    // The GZI block offsets, the uncompressed (i2) and compressed (i1) offset of each block after the first one.
+    String<Pair<__uint64, __uint64> > gziIndex;
+#endif  // #if SEQAN_HAS_ZLIB
+
     FaiIndex() :
         refNameStoreCache(refNameStore), mmapStringOpen(false)
+#if SEQAN_HAS_ZLIB
+        , bgzfStreamOpen(false)
+#endif  // #if SEQAN_HAS_ZLIB
     {}
 };
 
@@ -192,6 +208,9 @@ inline void clear(FaiIndex & index)
     clear(index.indexEntryStore);
     clear(index.refNameStore);
     refresh(index.refNameStoreCache);
+#if SEQAN_HAS_ZLIB
+    clear(index.gziIndex);
+#endif  // #if SEQAN_HAS_ZLIB
 }
 
 // ----------------------------------------------------------------------------
@@ -396,6 +415,92 @@ inline __uint64 numSeqs(FaiIndex const & index)
 ..include:seqan/seq_io.h
 */
 
+// Append n sequence characters starting at column of the line it points into, skipping the line breaks of the fixed
+// line layout from the FAI entry.
+
+template <typename TTarget>
+inline void
+_appendFaiLines(TTarget & str,
+                char const * it,
+                unsigned column,
+                unsigned lineLength,
+                unsigned overallLineLength,
+                __uint64 n)
+{
+    while (true)
+    {
+        __uint64 k = std::min((__uint64)(lineLength - column), n);
+        _appendCharSpan(str, it, it + k);
+        n -= k;
+        if (n == 0u)
+            return;
+        it += k + (overallLineLength - lineLength);
+        column = 0;
+    }
+}
+
+#if SEQAN_HAS_ZLIB
+
+// Translate an offset in the uncompressed FASTA file into a BGZF virtual offset using the GZI block offsets.
+
+inline __uint64
+_gziVirtualOffset(FaiIndex const & index, __uint64 offset)
+{
+    // Find the last block that starts at or before offset, the first block starts at 0 and is not in the index.
+    size_t lo = 0, hi = length(index.gziIndex);
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index.gziIndex[mid].i2 <= offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    __uint64 blockAddress = 0, blockBegin = 0;
+    if (lo > 0u)
+    {
+        blockAddress = index.gziIndex[lo - 1].i1;
+        blockBegin = index.gziIndex[lo - 1].i2;
+    }
+    return (blockAddress << 16) | (offset - blockBegin);
+}
+
+// Read a region from a compressed FASTA file, only the blocks overlapping the region are decompressed.
+
+template <typename TValue, typename TSpec>
+inline int
+_readRegionBgzf(String<TValue, TSpec> & str,
+                FaiIndex const & index,
+                FaiIndexEntry_ const & entry,
+                unsigned beginPos,
+                unsigned toRead)
+{
+    clear(str);
+    if (toRead == 0u)
+        return 0;
+
+    // The bytes from beginPos up to and including the last character of the region.
+    unsigned lastPos = beginPos + toRead - 1;
+    __uint64 firstByte = entry.offset + (__uint64)(beginPos / entry.lineLength) * entry.overallLineLength +
+            beginPos % entry.lineLength;
+    __uint64 lastByte = entry.offset + (__uint64)(lastPos / entry.lineLength) * entry.overallLineLength +
+            lastPos % entry.lineLength;
+    size_t numBytes = lastByte - firstByte + 1;
+
+    CharString buffer;
+    resize(buffer, numBytes);
+    if (streamSeek(index.bgzfStream, _gziVirtualOffset(index, firstByte), SEEK_SET) != 0)
+        return 1;
+    if (streamReadBlock(&buffer[0], index.bgzfStream, numBytes) != numBytes)
+        return 1;
+
+    reserve(str, toRead, Exact());
+    _appendFaiLines(str, &buffer[0], beginPos % entry.lineLength, entry.lineLength, entry.overallLineLength, toRead);
+    return 0;
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
 template <typename TValue, typename TSpec>
 inline int readRegion(String<TValue, TSpec> & str,
                       FaiIndex const & index,
@@ -409,8 +514,12 @@ inline int readRegion(String<TValue, TSpec> & str,
     endPos = std::min(std::max(beginPos, endPos), seqLen);
     unsigned toRead = endPos - beginPos;
 
+#if SEQAN_HAS_ZLIB
+    if (index.bgzfStreamOpen)
+        return _readRegionBgzf(str, index, index.indexEntryStore[refId], beginPos, toRead);
+#endif  // #if SEQAN_HAS_ZLIB
+
     typedef typename Iterator<String<char, MMap<> > const, Standard>::Type TSourceIter;
-    typedef typename Iterator<String<TValue, TSpec>, Standard>::Type TTargetIter;
     TSourceIter itSource = begin(index.mmapString, Standard());
     __uint64 offset = index.indexEntryStore[refId].offset;
     // First, compute offset of the completely filled lines.
@@ -422,20 +531,19 @@ inline int readRegion(String<TValue, TSpec> & str,
     // Advance iterator in MMap file.
     itSource += offset;
 
-    // Copy out the characters from FASTA file and convert via iterator assignment to target string's type.
-    resize(str, toRead, TValue());
-    TTargetIter itTarget = begin(str, Standard());
+    // Copy out the characters from FASTA file line by line and convert them in bulk to target string's type.  There
+    // are at least toRead - i non-space characters left behind itSource, so the scan stays within the file.
+    clear(str);
+    reserve(str, toRead, Exact());
+    TokenizeCharSet_ spaces = _tokenizeCharSet(Whitespace_(), true);
     for (unsigned i = 0; i < toRead; )
     {
-        if (isspace(*itSource))
-        {
-            ++itSource;
-            continue;  // Skip spaces.
-        }
-        *itTarget = *itSource;
-        ++itTarget;
-        ++itSource;
-        ++i;
+        char const * itLineEnd = _tokenizeFind(&*itSource, &*itSource + (toRead - i), spaces);
+        _appendCharSpan(str, &*itSource, itLineEnd);
+        i += itLineEnd - &*itSource;
+        itSource += itLineEnd - &*itSource;
+        while (i < toRead && isspace(*itSource))
+            ++itSource;  // Skip spaces.
     }
 
     return 0;
@@ -505,6 +613,61 @@ inline int readSequence(String<TValue, TSpec> & str, FaiIndex const & index, uns
     return readRegion(str, index, refId, 0, sequenceLength(index, refId));
 }
 
+#if SEQAN_HAS_ZLIB
+
+// ----------------------------------------------------------------------------
+// Helper Function _isBgzfFile()
+// ----------------------------------------------------------------------------
+
+// Returns true if the file starts with a BGZF block header.
+
+inline bool _isBgzfFile(char const * filename)
+{
+    char header[18];
+    std::ifstream in(filename, std::ios::binary | std::ios::in);
+    if (!in.read(&header[0], sizeof(header)))
+        return false;
+    return _bgzfCheckHeader(&header[0]);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _readGziIndex()
+// ----------------------------------------------------------------------------
+
+// Read the GZI file "${filename}.gzi".  It holds the number of entries followed by the compressed and uncompressed
+// offset of each block after the first, all as little-endian 64 bit integers.
+
+inline __uint64 _gziUnpackInt64(unsigned char const * buffer)
+{
+    __uint64 result = 0;
+    for (int i = 7; i >= 0; --i)
+        result = (result << 8) | buffer[i];
+    return result;
+}
+
+inline int _readGziIndex(String<Pair<__uint64, __uint64> > & gziIndex, char const * filename)
+{
+    CharString gziFilename = filename;
+    append(gziFilename, ".gzi");
+    std::ifstream in(toCString(gziFilename), std::ios::binary | std::ios::in);
+    unsigned char buffer[16];
+    if (!in.read((char *)&buffer[0], 8))
+        return 1;
+
+    clear(gziIndex);
+    resize(gziIndex, _gziUnpackInt64(&buffer[0]));
+    for (unsigned i = 0; i < length(gziIndex); ++i)
+    {
+        if (!in.read((char *)&buffer[0], 16))
+            return 1;
+        gziIndex[i].i1 = _gziUnpackInt64(&buffer[0]);
+        gziIndex[i].i2 = _gziUnpackInt64(&buffer[8]);
+    }
+    return 0;
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
 // ----------------------------------------------------------------------------
 // Function read()
 // ----------------------------------------------------------------------------
@@ -548,9 +711,28 @@ inline int read(FaiIndex & index, char const * fastaFilename, char const * faiFi
 
     if (index.mmapStringOpen)
         close(index.mmapString);
-    if (!open(index.mmapString, toCString(fastaFilename), OPEN_RDONLY))
-        return 1;  // Could not open file.
-    index.mmapStringOpen = true;
+    index.mmapStringOpen = false;
+#if SEQAN_HAS_ZLIB
+    if (index.bgzfStreamOpen)
+        close(index.bgzfStream);
+    index.bgzfStreamOpen = false;
+    if (_isBgzfFile(fastaFilename))
+    {
+        if (_readGziIndex(index.gziIndex, fastaFilename) != 0)
+            return 1;  // Could not read GZI file.
+        if (!open(index.bgzfStream, fastaFilename, "r"))
+            return 1;  // Could not open file.
+        // Keep some decompressed blocks, neighbouring regions often share them.
+        index.bgzfStream._maxCacheSize = 8 * 64 * 1024;
+        index.bgzfStreamOpen = true;
+    }
+    else
+#endif  // #if SEQAN_HAS_ZLIB
+    {
+        if (!open(index.mmapString, toCString(fastaFilename), OPEN_RDONLY))
+            return 1;  // Could not open file.
+        index.mmapStringOpen = true;
+    }
 
     // Open file.
     std::ifstream faiStream(toCString(index.faiFilename), std::ios::binary | std::ios::in);
@@ -769,6 +951,8 @@ inline int write(FaiIndex & index)
  *                         Default: <tt>"${seqFileName}.fai"</tt>.
  *
  * @return 0 on success, non-0 on errors.
+ *
+ * Indices of bgzip compressed FASTA files cannot be built, use <tt>samtools faidx</tt> and <tt>bgzip -i</tt> for them.
  */
 
 /**
@@ -785,6 +969,7 @@ inline int write(FaiIndex & index)
 ...default:$fastaFilename + ".fai"$
 ...type:nolink:$char const *$
 ..returns:$int$, equal to 0 on success, != 0 otherwise.
+..remarks:Indices of bgzip compressed FASTA files cannot be built, use $samtools faidx$ and $bgzip -i$ for them.
 ..include:seqan/stream.h
  */
 
@@ -793,6 +978,11 @@ inline int build(FaiIndex & index, char const * seqFilename, char const * faiFil
     index.fastaFilename = seqFilename;
     index.faiFilename = faiFilename;
     
+#if SEQAN_HAS_ZLIB
+    if (index.bgzfStreamOpen)
+        close(index.bgzfStream);
+    index.bgzfStreamOpen = false;
+#endif  // #if SEQAN_HAS_ZLIB
     if (index.mmapStringOpen)
         close(index.mmapString);
     if (!open(index.mmapString, toCString(seqFilename), OPEN_RDONLY))
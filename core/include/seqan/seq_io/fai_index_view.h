@@ -0,0 +1,730 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Zero-copy views on regions of FAI indexed FASTA files and an LRU cache of
+// decoded windows.
+//
+// The views point directly into the memory mapped FASTA file of a FaiIndex.
+// Their iterators use the fixed line layout stored in the FAI entries to
+// skip the line breaks without scanning or copying.
+// ==========================================================================
+
+#ifndef CORE_INCLUDE_SEQAN_SEQ_IO_FAI_INDEX_VIEW_H_
+#define CORE_INCLUDE_SEQAN_SEQ_IO_FAI_INDEX_VIEW_H_
+
+#include <list>
+#include <map>
+#include <utility>
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+struct FaiLineStride_;
+typedef Tag<FaiLineStride_> FaiLineStride;
+
+// ----------------------------------------------------------------------------
+// Class FaiRegionView
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class FaiRegionView
+ * @headerfile <seqan/seq_io.h>
+ * @brief Read-only view on a region of a sequence in a FaiIndex.
+ *
+ * @signature class FaiRegionView;
+ *
+ * The view points into the memory mapped FASTA file of the FaiIndex and does not copy or convert the characters.  Its
+ * iterators skip the line breaks using the line lengths from the FAI file.  The view becomes invalid when the
+ * FaiIndex is cleared, read again or destroyed.
+ *
+ * Use @link FaiIndex#readRegion @endlink to let a view point to a region.  Views are only available for uncompressed
+ * FASTA files.
+ */
+
+/**
+.Class.FaiRegionView
+..cat:Input/Output
+..signature:FaiRegionView
+..summary:Read-only view on a region of a sequence in a @Class.FaiIndex@.
+..remarks:The view points into the memory mapped FASTA file of the @Class.FaiIndex@ and does not copy or convert the characters.
+Its iterators skip the line breaks using the line lengths from the FAI file.
+The view becomes invalid when the @Class.FaiIndex@ is cleared, read again or destroyed.
+..remarks:Use @Function.FaiIndex#readRegion@ to let a view point to a region.
+Views are only available for uncompressed FASTA files.
+..include:seqan/seq_io.h
+*/
+
+class FaiRegionView
+{
+public:
+    // First character of the sequence in the memory mapped file.
+    char const * _seqBegin;
+    // Number of sequence characters per line.
+    unsigned _lineLength;
+    // Number of overall characters per line, including newline character(s).
+    unsigned _overallLineLength;
+    // Region in sequence coordinates.
+    __uint64 _beginPos;
+    __uint64 _endPos;
+
+    FaiRegionView() :
+        _seqBegin(0), _lineLength(1), _overallLineLength(1), _beginPos(0), _endPos(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Spec FaiLineStride Iterator
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class FaiLineStrideIterator
+ * @extends Iter
+ * @headerfile <seqan/seq_io.h>
+ * @brief Random access iterator over a FaiRegionView that skips the line breaks.
+ *
+ * @signature template <typename TView>
+ *            class Iter<TView, FaiLineStride>;
+ *
+ * @tparam TView The view type, FaiRegionView.
+ */
+
+/**
+.Spec.FaiLineStride Iterator
+..cat:Iterators
+..general:Class.Iter
+..summary:Random access iterator over a @Class.FaiRegionView@ that skips the line breaks.
+..signature:Iter<TView, FaiLineStride>
+..param.TView:The view type, @Class.FaiRegionView@.
+..include:seqan/seq_io.h
+*/
+
+template <typename TView>
+class Iter<TView, FaiLineStride>
+{
+public:
+    // Current character in the memory mapped file.
+    char const * _ptr;
+    // First character of the sequence in the memory mapped file.
+    char const * _seqBegin;
+    // Position in the sequence and column in the current line.
+    __uint64 _pos;
+    unsigned _column;
+    unsigned _lineLength;
+    unsigned _overallLineLength;
+
+    Iter() :
+        _ptr(0), _seqBegin(0), _pos(0), _column(0), _lineLength(1), _overallLineLength(1)
+    {}
+
+    Iter(FaiRegionView const & view, __uint64 pos) :
+        _seqBegin(view._seqBegin), _lineLength(view._lineLength), _overallLineLength(view._overallLineLength)
+    {
+        _setPosition(*this, pos);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class FaiRegionCache
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class FaiRegionCache
+ * @headerfile <seqan/seq_io.h>
+ * @brief LRU cache of decoded windows of the sequences in a FaiIndex.
+ *
+ * @signature template <typename TSequence>
+ *            class FaiRegionCache;
+ *
+ * @tparam TSequence The type of the decoded windows, defaults to @link Dna5String @endlink.
+ *
+ * The sequences are cut into windows of a fixed size.  @link FaiRegionCache#readRegion @endlink decodes the windows
+ * overlapping a region once and keeps the most recently used ones.  This pays off when many small regions are read
+ * from a few hot spots.  The cache is not thread-safe.
+ *
+ * @fn FaiRegionCache::FaiRegionCache
+ * @brief Constructor.
+ *
+ * @signature FaiRegionCache::FaiRegionCache(faiIndex[, capacity[, windowSize]]);
+ *
+ * @param[in] faiIndex   The FaiIndex to read from, must live longer than the cache.
+ * @param[in] capacity   The maximal number of cached windows, defaults to 1024.
+ * @param[in] windowSize The number of characters per window, defaults to 4096.
+ */
+
+/**
+.Class.FaiRegionCache
+..cat:Input/Output
+..signature:FaiRegionCache<TSequence>
+..summary:LRU cache of decoded windows of the sequences in a @Class.FaiIndex@.
+..param.TSequence:The type of the decoded windows.
+...default:@Shortcut.Dna5String@
+..remarks:The sequences are cut into windows of a fixed size.
+@Function.FaiRegionCache#readRegion@ decodes the windows overlapping a region once and keeps the most recently used ones.
+This pays off when many small regions are read from a few hot spots.
+The cache is not thread-safe.
+..include:seqan/seq_io.h
+
+.Memfunc.FaiRegionCache#FaiRegionCache
+..class:Class.FaiRegionCache
+..signature:FaiRegionCache(faiIndex[, capacity[, windowSize]])
+..param.faiIndex:The @Class.FaiIndex@ to read from, must live longer than the cache.
+..param.capacity:The maximal number of cached windows.
+...default:1024
+..param.windowSize:The number of characters per window.
+...default:4096
+*/
+
+template <typename TSequence = Dna5String>
+class FaiRegionCache
+{
+public:
+    // A window is identified by the reference id and its number in the reference.
+    typedef std::pair<unsigned, __uint64> TKey;
+    typedef std::list<unsigned> TLruList;
+
+    FaiIndex const * _index;
+    unsigned _capacity;
+    unsigned _windowSize;
+
+    // The decoded windows and their keys.
+    String<TSequence> _windows;
+    String<TKey> _keys;
+    // Maps keys to their slots in _windows.
+    std::map<TKey, unsigned> _slots;
+    // Slots ordered by their last use, the most recently used first, and the entry of each slot in this list.
+    TLruList _lru;
+    String<typename TLruList::iterator> _lruEntries;
+
+    FaiRegionCache(FaiIndex const & index, unsigned capacity = 1024, unsigned windowSize = 4096) :
+        _index(&index), _capacity(_max(1u, capacity)), _windowSize(_max(1u, windowSize))
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunctions Value, GetValue, Reference, Size, Position, Difference
+// ----------------------------------------------------------------------------
+
+template <>
+struct Value<FaiRegionView>
+{
+    typedef char Type;
+};
+
+template <>
+struct Value<FaiRegionView const> : Value<FaiRegionView>
+{};
+
+// The characters are returned by value, the view is read-only.
+
+template <>
+struct GetValue<FaiRegionView> : Value<FaiRegionView>
+{};
+
+template <>
+struct GetValue<FaiRegionView const> : Value<FaiRegionView>
+{};
+
+template <>
+struct Reference<FaiRegionView> : Value<FaiRegionView>
+{};
+
+template <>
+struct Reference<FaiRegionView const> : Value<FaiRegionView>
+{};
+
+template <>
+struct Size<FaiRegionView>
+{
+    typedef __uint64 Type;
+};
+
+template <>
+struct Size<FaiRegionView const> : Size<FaiRegionView>
+{};
+
+template <>
+struct Position<FaiRegionView> : Size<FaiRegionView>
+{};
+
+template <>
+struct Position<FaiRegionView const> : Size<FaiRegionView>
+{};
+
+template <>
+struct Difference<FaiRegionView>
+{
+    typedef __int64 Type;
+};
+
+template <>
+struct Difference<FaiRegionView const> : Difference<FaiRegionView>
+{};
+
+// ----------------------------------------------------------------------------
+// Metafunction Iterator
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+struct Iterator<FaiRegionView, TSpec>
+{
+    typedef Iter<FaiRegionView const, FaiLineStride> Type;
+};
+
+template <typename TSpec>
+struct Iterator<FaiRegionView const, TSpec> : Iterator<FaiRegionView, TSpec>
+{};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Function _setPosition()                      [FaiLineStride Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TView>
+inline void
+_setPosition(Iter<TView, FaiLineStride> & it, __uint64 pos)
+{
+    it._pos = pos;
+    it._column = pos % it._lineLength;
+    it._ptr = it._seqBegin + (pos / it._lineLength) * it._overallLineLength + it._column;
+}
+
+// ----------------------------------------------------------------------------
+// Function value()                                    [FaiLineStride Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TView>
+inline char
+value(Iter<TView, FaiLineStride> const & it)
+{
+    return *it._ptr;
+}
+
+template <typename TView>
+inline char
+value(Iter<TView, FaiLineStride> & it)
+{
+    return *it._ptr;
+}
+
+// ----------------------------------------------------------------------------
+// Function position()                                 [FaiLineStride Iterator]
+// ----------------------------------------------------------------------------
+
+// Returns the position in the sequence, not in the view.
+
+template <typename TView>
+inline __uint64
+position(Iter<TView, FaiLineStride> const & it)
+{
+    return it._pos;
+}
+
+template <typename TView>
+inline __uint64
+position(Iter<TView, FaiLineStride> & it)
+{
+    return it._pos;
+}
+
+// ----------------------------------------------------------------------------
+// Function goNext()                                   [FaiLineStride Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TView>
+inline void
+goNext(Iter<TView, FaiLineStride> & it)
+{
+    ++it._pos;
+    ++it._ptr;
+    if (++it._column == it._lineLength)
+    {
+        it._column = 0;
+        it._ptr += it._overallLineLength - it._lineLength;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function goPrevious()                               [FaiLineStride Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TView>
+inline void
+goPrevious(Iter<TView, FaiLineStride> & it)
+{
+    --it._pos;
+    --it._ptr;
+    if (it._column-- == 0u)
+    {
+        it._column = it._lineLength - 1;
+        it._ptr -= it._overallLineLength - it._lineLength;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Arithmetic and Relational Operators                 [FaiLineStride Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TView, typename TIntegral>
+inline Iter<TView, FaiLineStride> &
+operator+=(Iter<TView, FaiLineStride> & it, TIntegral delta)
+{
+    _setPosition(it, it._pos + delta);
+    return it;
+}
+
+template <typename TView, typename TIntegral>
+inline Iter<TView, FaiLineStride> &
+operator-=(Iter<TView, FaiLineStride> & it, TIntegral delta)
+{
+    _setPosition(it, it._pos - delta);
+    return it;
+}
+
+template <typename TView, typename TIntegral>
+inline Iter<TView, FaiLineStride>
+operator+(Iter<TView, FaiLineStride> const & it, TIntegral delta)
+{
+    Iter<TView, FaiLineStride> result(it);
+    return result += delta;
+}
+
+template <typename TView, typename TIntegral>
+inline Iter<TView, FaiLineStride>
+operator-(Iter<TView, FaiLineStride> const & it, TIntegral delta)
+{
+    Iter<TView, FaiLineStride> result(it);
+    return result -= delta;
+}
+
+template <typename TView>
+inline __int64
+operator-(Iter<TView, FaiLineStride> const & left, Iter<TView, FaiLineStride> const & right)
+{
+    return (__int64)left._pos - (__int64)right._pos;
+}
+
+template <typename TView>
+inline bool
+operator==(Iter<TView, FaiLineStride> const & left, Iter<TView, FaiLineStride> const & right)
+{
+    return left._pos == right._pos;
+}
+
+template <typename TView>
+inline bool
+operator!=(Iter<TView, FaiLineStride> const & left, Iter<TView, FaiLineStride> const & right)
+{
+    return left._pos != right._pos;
+}
+
+template <typename TView>
+inline bool
+operator<(Iter<TView, FaiLineStride> const & left, Iter<TView, FaiLineStride> const & right)
+{
+    return left._pos < right._pos;
+}
+
+// ----------------------------------------------------------------------------
+// Function length()                                           [FaiRegionView]
+// ----------------------------------------------------------------------------
+
+inline __uint64
+length(FaiRegionView const & view)
+{
+    return view._endPos - view._beginPos;
+}
+
+// ----------------------------------------------------------------------------
+// Function empty()                                            [FaiRegionView]
+// ----------------------------------------------------------------------------
+
+inline bool
+empty(FaiRegionView const & view)
+{
+    return view._endPos == view._beginPos;
+}
+
+// ----------------------------------------------------------------------------
+// Function begin()                                            [FaiRegionView]
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline Iter<FaiRegionView const, FaiLineStride>
+begin(FaiRegionView const & view, Tag<TSpec> const /*tag*/)
+{
+    return Iter<FaiRegionView const, FaiLineStride>(view, view._beginPos);
+}
+
+template <typename TSpec>
+inline Iter<FaiRegionView const, FaiLineStride>
+begin(FaiRegionView & view, Tag<TSpec> const tag)
+{
+    return begin(static_cast<FaiRegionView const &>(view), tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function end()                                              [FaiRegionView]
+// ----------------------------------------------------------------------------
+
+template <typename TSpec>
+inline Iter<FaiRegionView const, FaiLineStride>
+end(FaiRegionView const & view, Tag<TSpec> const /*tag*/)
+{
+    return Iter<FaiRegionView const, FaiLineStride>(view, view._endPos);
+}
+
+template <typename TSpec>
+inline Iter<FaiRegionView const, FaiLineStride>
+end(FaiRegionView & view, Tag<TSpec> const tag)
+{
+    return end(static_cast<FaiRegionView const &>(view), tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function value()                                            [FaiRegionView]
+// ----------------------------------------------------------------------------
+
+template <typename TPos>
+inline char
+value(FaiRegionView const & view, TPos pos)
+{
+    SEQAN_ASSERT_LT((__uint64)pos, length(view));
+    __uint64 seqPos = view._beginPos + pos;
+    return view._seqBegin[(seqPos / view._lineLength) * view._overallLineLength + seqPos % view._lineLength];
+}
+
+template <typename TPos>
+inline char
+value(FaiRegionView & view, TPos pos)
+{
+    return value(static_cast<FaiRegionView const &>(view), pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function readRegion()                                       [FaiRegionView]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiIndex#readRegion
+ *
+ * @signature int readRegion(view, faiIndex, refId, beginPos, endPos);
+ *
+ * @param[out] view The @link FaiRegionView @endlink to point to the region.  No characters are copied.
+ */
+
+/**
+.Function.FaiIndex#readRegion
+..signature:readRegion(view, faiIndex, refId, beginPos, endPos)
+..param.view:The @Class.FaiRegionView@ to point to the region. No characters are copied.
+...type:Class.FaiRegionView
+*/
+
+inline int readRegion(FaiRegionView & view,
+                      FaiIndex const & index,
+                      unsigned refId,
+                      __uint64 beginPos,
+                      __uint64 endPos)
+{
+    if (refId >= length(index.indexEntryStore) || !index.mmapStringOpen)
+        return 1;
+
+    // Limit region to the sequence, make sure that beginPos <= endPos.
+    FaiIndexEntry_ const & entry = index.indexEntryStore[refId];
+    __uint64 seqLen = entry.sequenceLength;
+    view._seqBegin = begin(index.mmapString, Standard()) + entry.offset;
+    view._lineLength = _max(1u, entry.lineLength);
+    view._overallLineLength = _max(view._lineLength, entry.overallLineLength);
+    view._beginPos = _min(beginPos, seqLen);
+    view._endPos = _min(_max(view._beginPos, endPos), seqLen);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _cachedWindow()                            [FaiRegionCache]
+// ----------------------------------------------------------------------------
+
+// Return the decoded window, decode it into the least recently used slot on a miss.
+
+template <typename TSequence>
+inline TSequence const &
+_cachedWindow(FaiRegionCache<TSequence> & cache, unsigned refId, __uint64 windowNo)
+{
+    typedef typename FaiRegionCache<TSequence>::TKey TKey;
+
+    TKey key(refId, windowNo);
+    typename std::map<TKey, unsigned>::iterator itSlot = cache._slots.find(key);
+    if (itSlot != cache._slots.end())
+    {
+        unsigned slot = itSlot->second;
+        cache._lru.splice(cache._lru.begin(), cache._lru, cache._lruEntries[slot]);
+        return cache._windows[slot];
+    }
+
+    unsigned slot = length(cache._windows);
+    if (slot < cache._capacity)
+    {
+        resize(cache._windows, slot + 1);
+        resize(cache._keys, slot + 1);
+        cache._lru.push_front(slot);
+        appendValue(cache._lruEntries, cache._lru.begin());
+    }
+    else
+    {
+        slot = cache._lru.back();
+        cache._slots.erase(cache._keys[slot]);
+        cache._lru.splice(cache._lru.begin(), cache._lru, cache._lruEntries[slot]);
+    }
+    cache._keys[slot] = key;
+    cache._slots[key] = slot;
+
+    readRegion(cache._windows[slot], *cache._index, refId, windowNo * cache._windowSize,
+               (windowNo + 1) * cache._windowSize);
+    return cache._windows[slot];
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()                                           [FaiRegionCache]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiRegionCache#clear
+ * @brief Remove all windows from the cache.
+ *
+ * @signature void clear(cache);
+ *
+ * @param[in,out] cache The FaiRegionCache to clear.
+ */
+
+/**
+.Function.FaiRegionCache#clear
+..class:Class.FaiRegionCache
+..summary:Remove all windows from the cache.
+..signature:clear(cache)
+..param.cache:The @Class.FaiRegionCache@ to clear.
+...type:Class.FaiRegionCache
+..include:seqan/seq_io.h
+*/
+
+template <typename TSequence>
+inline void
+clear(FaiRegionCache<TSequence> & cache)
+{
+    clear(cache._windows);
+    clear(cache._keys);
+    cache._slots.clear();
+    cache._lru.clear();
+    clear(cache._lruEntries);
+}
+
+// ----------------------------------------------------------------------------
+// Function readRegion()                                      [FaiRegionCache]
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FaiRegionCache#readRegion
+ * @brief Load the infix of a sequence through the cache.
+ *
+ * @signature int readRegion(str, cache, refId, beginPos, endPos);
+ *
+ * @param[out]    str      The @link String @endlink to read the sequence into.
+ * @param[in,out] cache    The FaiRegionCache to read through.
+ * @param[in]     refId    The id of the reference to read.  Type: unsigned.
+ * @param[in]     beginPos The begin position of the region to read.
+ * @param[in]     endPos   The end position of the region to read.
+ *
+ * @return int 0 on success, 1 on errors.
+ */
+
+/**
+.Function.FaiRegionCache#readRegion
+..class:Class.FaiRegionCache
+..summary:Load the infix of a sequence through the cache.
+..signature:readRegion(str, cache, refId, beginPos, endPos)
+..param.str:The sequence infix is written into this string.
+...type:Class.String
+..param.cache:The @Class.FaiRegionCache@ to read through.
+...type:Class.FaiRegionCache
+..param.refId:The index of the reference in the file.
+...type:nolink:$unsigned$
+..param.beginPos:The begin position of the infix to write to $str$.
+..param.endPos:The end position of the infix to write to $str$.
+..return:Status code $int$, $0$ indicating success and $1$ an error.
+..include:seqan/seq_io.h
+*/
+
+template <typename TValue, typename TStrSpec, typename TSequence>
+inline int readRegion(String<TValue, TStrSpec> & str,
+                      FaiRegionCache<TSequence> & cache,
+                      unsigned refId,
+                      __uint64 beginPos,
+                      __uint64 endPos)
+{
+    FaiIndex const & index = *cache._index;
+    if (refId >= length(index.indexEntryStore))
+        return 1;
+
+    __uint64 seqLen = index.indexEntryStore[refId].sequenceLength;
+    beginPos = _min(beginPos, seqLen);
+    endPos = _min(_max(beginPos, endPos), seqLen);
+
+    clear(str);
+    reserve(str, endPos - beginPos, Exact());
+    for (__uint64 pos = beginPos; pos < endPos; )
+    {
+        __uint64 windowNo = pos / cache._windowSize;
+        __uint64 windowBegin = windowNo * cache._windowSize;
+        TSequence const & window = _cachedWindow(cache, refId, windowNo);
+        __uint64 windowEnd = _min(endPos, windowBegin + length(window));
+        append(str, infix(window, pos - windowBegin, windowEnd - windowBegin));
+        pos = windowEnd;
+    }
+    return 0;
+}
+
+}  // namespace seqan
+
+#endif  // CORE_INCLUDE_SEQAN_SEQ_IO_FAI_INDEX_VIEW_H_
@@ -207,6 +207,12 @@ private:
         _recordreader._stayInOneBuffer = true;
     }
 
+    inline void
+    _suspendRefill(SinglePass<ReadAhead> const & /* tag */)
+    {
+        _recordreader._stayInOneBuffer = true;
+    }
+
     inline void
     _suspendRefill(SinglePass<StringReader> const & /* tag */)
     {
@@ -232,6 +238,12 @@ private:
             _recordreader._current = _currentBeforeSuspend;
     }
 
+    inline void
+    _resumeRefillAndReset(SinglePass<ReadAhead> const & /* tag */)
+    {
+        _resumeRefillAndReset(SinglePass<void>());
+    }
+
     inline void
     _resumeRefillAndReset(DoublePass<void> const & /* tag */)
     {
@@ -71,11 +71,16 @@ namespace seqan {
  * 
  * @subsection Operation Mode
  * 
- * When reading, there are two operation modes: Normal reading and reading of "persistent" records.  When reading in
- * "persistent" mode, @link SequenceStream @endlink will scan over each record twice: once for determining its size and
- * once for actually reading the sequences.  After the first pass, we can allocate a buffer of the exact size we need.
- * This can save memory up to a factor of two, at the cost of scanning each record twice.  Note that this is only
- * possible for reading uncompressed files.
+ * When reading, there are three operation modes: Normal reading, reading of "persistent" records, and parallel
+ * reading.  When reading in "persistent" mode, @link SequenceStream @endlink will scan over each record twice: once
+ * for determining its size and once for actually reading the sequences.  After the first pass, we can allocate a
+ * buffer of the exact size we need.  This can save memory up to a factor of two, at the cost of scanning each record
+ * twice.  Note that this is only possible for reading uncompressed files.
+ *
+ * When reading in "parallel" mode, FASTA and FASTQ files are cut into large chunks that end on record boundaries.  One
+ * thread reads the next chunks while the other OpenMP threads parse the current chunks.  The records are returned in
+ * file order, so the result is the same as in normal mode.  This pays off for large and compressed files when reading
+ * many records at once with @link SequenceStream#readBatch @endlink or @link SequenceStream#readAll @endlink.
  * 
  * @subsection File Format and File Type
  * 
@@ -137,6 +142,10 @@ namespace seqan {
  * @var SequenceStream::OperationMode SequenceStream::READ_PERSISTENT;
  * @brief Open stream for reading, mark as "persisent reading".  See @link SequenceStream @endlink for more information
  *        on the difference between normal and persistent reading.
+ *
+ * @var SequenceStream::OperationMode SequenceStream::READ_PARALLEL;
+ * @brief Open stream for reading, parse FASTA and FASTQ chunks in parallel.  See @link SequenceStream @endlink for
+ *        more information on parallel reading.
  */
 
 /*!
@@ -193,13 +202,16 @@ Especially, the underlying @Class.Stream|stream layer@ and using @Class.RecordRe
 This is achieved by using dynamic polymorphism which comes at some performance cost.
 ..remarks:Operation Mode
 ..remarks.text:
-When reading, there are two operation modes:
-Normal reading and reading of "persistent" records.
+When reading, there are three operation modes:
+Normal reading, reading of "persistent" records, and parallel reading.
 When reading in "persistent" mode, @Class.SequenceStream@ will scan over each record twice:
 Once for determining its size and once for actually reading the sequences.
 After the first pass, we can allocate a buffer of the exact size we need.
 This can save memory up to a factor of two, at the cost of scanning each record twice.
 Note that this is only possible for reading uncompressed files.
+When reading in "parallel" mode, FASTA and FASTQ files are cut into large chunks that end on record boundaries.
+One thread reads the next chunks while the other OpenMP threads parse the current chunks.
+The records are returned in file order, so the result is the same as in normal mode.
 ..remarks:File Format and File Type
 ..remarks.text:
 The file type determines whether a file is stored as raw text or whether it is compressed.
@@ -246,6 +258,7 @@ Open a SequenceStream for writing and write two sequences to it.
 ..value.READ:Open stream for reading.
 ..value.READ_PERSISTENT:Open stream for reading, mark as "persisent reading". See @Class.SequenceStream@ for more information on the difference between normal and persistent reading.
 ..value.WRITE:Open stream for writing.
+..value.READ_PARALLEL:Open stream for reading, parse FASTA and FASTQ chunks in parallel. One thread reads the next chunks while the other OpenMP threads parse the current ones, the records are returned in file order.
 ..include:seqan/seq_io.h
 
 .Enum.SequenceStream\colon\colonFileFormat
@@ -280,7 +293,8 @@ public:
     {
         READ,
         READ_PERSISTENT,
-        WRITE
+        WRITE,
+        READ_PARALLEL
     };
 
     // This enum is used to select the file format.
@@ -379,7 +393,8 @@ public:
 
         bool isRead = (operationMode != WRITE);
         bool hintDoublePass = (operationMode == READ_PERSISTENT);
-        _impl.reset(new SequenceStreamImpl_(filename, _fileFormat, _fileType, isRead, hintDoublePass));
+        bool parallel = (operationMode == READ_PARALLEL);
+        _impl.reset(new SequenceStreamImpl_(filename, _fileFormat, _fileType, isRead, hintDoublePass, parallel));
         // Copy out, possibly detected/adjusted file type and format.
         _fileType = _impl->_fileType;
         _fileFormat = _impl->_fileFormat;
@@ -581,6 +596,77 @@ inline bool isGood(SequenceStream const & seqIO)
     return seqIO._isGood;
 }
 
+// ----------------------------------------------------------------------------
+// Function setParallelChunkSize()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn SequenceStream#setParallelChunkSize
+ * @brief Set the size of the chunks that are parsed by one thread in parallel reading mode.
+ *
+ * @signature void setParallelChunkSize(seqStream, chunkSize);
+ *
+ * @param[in,out] seqStream The SequenceStream to configure.
+ * @param[in]     chunkSize The chunk size in bytes, defaults to 4 MiB.  Records larger than a chunk are kept in one
+ *                          chunk.
+ *
+ * This has no effect if the stream is not opened in parallel reading mode.
+ */
+
+/**
+.Function.SequenceStream#setParallelChunkSize
+..class:Class.SequenceStream
+..summary:Set the size of the chunks that are parsed by one thread in parallel reading mode.
+..signature:setParallelChunkSize(seqIO, chunkSize)
+..param.seqIO:The @Class.SequenceStream@ object to configure.
+...type:Class.SequenceStream
+..param.chunkSize:The chunk size in bytes, defaults to 4 MiB. Records larger than a chunk are kept in one chunk.
+...type:nolink:$unsigned$
+..remarks:This has no effect if the stream is not opened in parallel reading mode.
+..include:seqan/seq_io.h
+*/
+
+inline void setParallelChunkSize(SequenceStream & seqIO, unsigned chunkSize)
+{
+    if (seqIO._impl.get() != 0)
+        seqIO._impl->_parallelState.chunkSize = _max(1u, chunkSize);
+}
+
+// ----------------------------------------------------------------------------
+// Function setParallelThreads()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn SequenceStream#setParallelThreads
+ * @brief Set the number of threads that parse chunks in parallel reading mode.
+ *
+ * @signature void setParallelThreads(seqStream, numThreads);
+ *
+ * @param[in,out] seqStream  The SequenceStream to configure.
+ * @param[in]     numThreads The number of threads, defaults to the number of OpenMP threads.
+ *
+ * This has no effect if the stream is not opened in parallel reading mode.
+ */
+
+/**
+.Function.SequenceStream#setParallelThreads
+..class:Class.SequenceStream
+..summary:Set the number of threads that parse chunks in parallel reading mode.
+..signature:setParallelThreads(seqIO, numThreads)
+..param.seqIO:The @Class.SequenceStream@ object to configure.
+...type:Class.SequenceStream
+..param.numThreads:The number of threads, defaults to the number of OpenMP threads.
+...type:nolink:$unsigned$
+..remarks:This has no effect if the stream is not opened in parallel reading mode.
+..include:seqan/seq_io.h
+*/
+
+inline void setParallelThreads(SequenceStream & seqIO, unsigned numThreads)
+{
+    if (seqIO._impl.get() != 0)
+        seqIO._impl->_parallelState.numThreads = _max(1u, numThreads);
+}
+
 // ----------------------------------------------------------------------------
 // Function readRecord()
 // ----------------------------------------------------------------------------
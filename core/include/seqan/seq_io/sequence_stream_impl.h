@@ -134,14 +134,19 @@ public:
     bool _isRead;
     // Whether or not to use double pass record reader.
     bool _hintDoublePass;
+    // Whether or not to parse chunks of the file in parallel.
+    bool _parallel;
+    // State of the parallel reader.
+    SequenceStreamParallelState_ _parallelState;
 
     SequenceStreamImpl_(CharString const & filename,
                         SeqIOFileFormat_::Type fileFormat,
                         SeqIOFileType_::Type fileType,
                         bool isRead,
-                        bool hintDoublePass = false) :
+                        bool hintDoublePass = false,
+                        bool parallel = false) :
             _filename(filename), _fileFormat(fileFormat), _fileType(fileType), _atEnd(false), _isGood(true),
-            _isRead(isRead), _hintDoublePass(hintDoublePass)
+            _isRead(isRead), _hintDoublePass(hintDoublePass), _parallel(parallel && !hintDoublePass)
     {
         // Guess file types.
         if (_isRead)
@@ -443,6 +448,9 @@ public:
     template <typename TId, typename TSequence, typename TQualities, typename TFormatTag>
     int readRecord(TId & id, TSequence & seq, TQualities & qual, TFormatTag const & tag)
     {
+        if (_parallel)
+            return _readRecordParallel(id, seq, qual, tag);
+
         int res = 0;
 
         switch (_fileType)
@@ -486,6 +494,12 @@ public:
     template <typename TId, typename TSequence, typename TFormatTag>
     int readRecord(TId & id, TSequence & seq, TFormatTag const & tag)
     {
+        if (_parallel)
+        {
+            Nothing qual;
+            return _readRecordParallel(id, seq, qual, tag);
+        }
+
         int res = 0;
 
         switch (_fileType)
@@ -517,6 +531,88 @@ public:
             _atEnd = seqan::atEnd(*_bz2Reader);
             break;      // end of case
 
+#endif  // #if SEQAN_HAS_BZIP2
+        default:
+            return 1;
+        }
+
+        _isGood = _isGood && (res == 0);
+        return res;
+    }
+
+    // -----------------------------------------------------------------------
+    // Function _readRecordParallel()
+    // -----------------------------------------------------------------------
+
+    // Read the next record with the parallel chunked reader, qual can be Nothing.
+
+    template <typename TId, typename TSequence, typename TQualities, typename TFormatTag>
+    int _readRecordParallel(TId & id, TSequence & seq, TQualities & qual, TFormatTag const & tag)
+    {
+        int res = 0;
+
+        switch (_fileType)
+        {
+        case SeqIOFileType_::FILE_TYPE_TEXT:
+            res = seqan::_readRecordParallel(id, seq, qual, _parallelState, *_mmapReaderSinglePass, tag);
+            _atEnd = _atEndParallel(_parallelState, *_mmapReaderSinglePass);
+            break;      // end of case
+
+#if SEQAN_HAS_ZLIB
+        case SeqIOFileType_::FILE_TYPE_GZ:
+        case SeqIOFileType_::FILE_TYPE_GZ_DIRECT:
+            res = seqan::_readRecordParallel(id, seq, qual, _parallelState, *_gzReader, tag);
+            _atEnd = _atEndParallel(_parallelState, *_gzReader);
+            break;      // end of case
+
+#endif  // #if SEQAN_HAS_ZLIB
+#if SEQAN_HAS_BZIP2
+        case SeqIOFileType_::FILE_TYPE_BZ2:
+            res = seqan::_readRecordParallel(id, seq, qual, _parallelState, *_bz2Reader, tag);
+            _atEnd = _atEndParallel(_parallelState, *_bz2Reader);
+            break;      // end of case
+
+#endif  // #if SEQAN_HAS_BZIP2
+        default:
+            return 1;
+        }
+
+        _isGood = _isGood && (res == 0);
+        return res;
+    }
+
+    // -----------------------------------------------------------------------
+    // Function _readBatchParallel()
+    // -----------------------------------------------------------------------
+
+    // Read up to num records with the parallel chunked reader, quals can be Nothing.
+
+    template <typename TIdSet, typename TSeqSet, typename TQualSet, typename TFormatTag>
+    int _readBatchParallel(TIdSet & ids, TSeqSet & seqs, TQualSet & quals, size_t num, TFormatTag const & tag)
+    {
+        int res = 0;
+
+        switch (_fileType)
+        {
+        case SeqIOFileType_::FILE_TYPE_TEXT:
+            res = seqan::_readBatchParallel(ids, seqs, quals, num, _parallelState, *_mmapReaderSinglePass, tag);
+            _atEnd = _atEndParallel(_parallelState, *_mmapReaderSinglePass);
+            break;      // end of case
+
+#if SEQAN_HAS_ZLIB
+        case SeqIOFileType_::FILE_TYPE_GZ:
+        case SeqIOFileType_::FILE_TYPE_GZ_DIRECT:
+            res = seqan::_readBatchParallel(ids, seqs, quals, num, _parallelState, *_gzReader, tag);
+            _atEnd = _atEndParallel(_parallelState, *_gzReader);
+            break;      // end of case
+
+#endif  // #if SEQAN_HAS_ZLIB
+#if SEQAN_HAS_BZIP2
+        case SeqIOFileType_::FILE_TYPE_BZ2:
+            res = seqan::_readBatchParallel(ids, seqs, quals, num, _parallelState, *_bz2Reader, tag);
+            _atEnd = _atEndParallel(_parallelState, *_bz2Reader);
+            break;      // end of case
+
 #endif  // #if SEQAN_HAS_BZIP2
         default:
             return 1;
@@ -544,6 +640,9 @@ public:
         clear(seqs);
         clear(quals);
 
+        if (_parallel)
+            return _readBatchParallel(ids, seqs, quals, num, tag);
+
         int res = 0;
         TId id;
         TSequence seq;
@@ -628,6 +727,12 @@ public:
         clear(ids);
         clear(seqs);
 
+        if (_parallel)
+        {
+            Nothing quals;
+            return _readBatchParallel(ids, seqs, quals, num, tag);
+        }
+
         int res = 0;
         TId id;
         TSequence seq;
@@ -715,6 +820,9 @@ public:
         clear(seqs);
         clear(quals);
 
+        if (_parallel)
+            return _readBatchParallel(ids, seqs, quals, MaxValue<size_t>::VALUE, tag);
+
         int res = 0;
         TId id;
         TSequence seq;
@@ -798,6 +906,12 @@ public:
         clear(ids);
         clear(seqs);
 
+        if (_parallel)
+        {
+            Nothing quals;
+            return _readBatchParallel(ids, seqs, quals, MaxValue<size_t>::VALUE, tag);
+        }
+
         int res = 0;
         TId id;
         TSequence seq;
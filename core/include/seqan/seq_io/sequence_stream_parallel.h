@@ -0,0 +1,484 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Parallel chunked reading of FASTA and FASTQ files for SequenceStream.
+//
+// The input is cut into large chunks that end on record boundaries.  The
+// chunks are parsed in parallel while one thread reads the next chunks and
+// the records are handed out in file order.
+// ==========================================================================
+
+#ifndef CORE_INCLUDE_SEQAN_SEQ_IO_SEQUENCE_STREAM_PARALLEL_H_
+#define CORE_INCLUDE_SEQAN_SEQ_IO_SEQUENCE_STREAM_PARALLEL_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class SequenceStreamParallelState_
+// ----------------------------------------------------------------------------
+
+// State of the parallel reader mode of SequenceStream.
+//
+// The records of the last parsed chunks are kept in a cache, one StringSet per chunk, and handed out from there.  The
+// next chunks are only parsed when the cache is empty.
+
+struct SequenceStreamParallelState_
+{
+    typedef StringSet<CharString, Owner<ConcatDirect<> > > TRecordSet;
+
+    // Size of the chunks that are parsed by one thread.
+    unsigned chunkSize;
+    // Number of chunks to parse at once, defaults to the number of OpenMP threads.
+    unsigned numThreads;
+    // Raw chunks in file order that have not been parsed yet, each one ends on a record boundary.
+    String<CharString> chunks;
+    // Bytes after the last record boundary of the last chunk.
+    CharString carry;
+    // Parsed records of the last chunks and the position of the next record to hand out.
+    String<TRecordSet> ids;
+    String<TRecordSet> seqs;
+    String<TRecordSet> quals;
+    unsigned cacheChunk;
+    size_t cacheRecord;
+
+    SequenceStreamParallelState_() :
+        chunkSize(4 * 1024 * 1024), numThreads(omp_get_max_threads()), cacheChunk(0), cacheRecord(0)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Function _appendFromRecordReader()
+// ----------------------------------------------------------------------------
+
+// Append up to maxBytes raw bytes from a record reader.
+
+template <typename TString, typename TStream, typename TPass>
+inline int
+_appendFromRecordReader(TString & buffer, RecordReader<TStream, TPass> & reader, size_t maxBytes)
+{
+    int res = readNChars(buffer, reader, maxBytes);
+    return (res == EOF_BEFORE_SUCCESS) ? 0 : res;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _lastRecordBegin()
+// ----------------------------------------------------------------------------
+
+// Returns the begin position of the last complete record in buffer or 0 if there is none after position 0.
+
+template <typename TString>
+inline size_t
+_lastRecordBegin(TString const & buffer, Fasta const & /*tag*/)
+{
+    for (size_t pos = length(buffer); pos > 1u; --pos)
+        if (buffer[pos - 1] == '>' && buffer[pos - 2] == '\n')
+            return pos - 1;
+    return 0;
+}
+
+// Returns the end of the line that begins at pos, excluding '\r', and sets pos to the begin of the next line.
+// Returns false if the line is not terminated.
+
+template <typename TString>
+inline bool
+_nextLine(size_t & lineBegin, size_t & lineEnd, size_t & pos, TString const & buffer)
+{
+    lineBegin = pos;
+    for (; pos < length(buffer); ++pos)
+        if (buffer[pos] == '\n')
+        {
+            lineEnd = (pos > lineBegin && buffer[pos - 1] == '\r') ? pos - 1 : pos;
+            ++pos;
+            return true;
+        }
+    return false;
+}
+
+// A '@' at the begin of a line can also be the first quality value.  A record begin is only accepted if it is
+// followed by a complete four-line record whose '+' line is empty or repeats the id and whose quality line has the
+// length of the sequence line.
+
+template <typename TString>
+inline bool
+_isFastqRecordBegin(TString const & buffer, size_t pos)
+{
+    size_t b[4], e[4];
+    for (unsigned i = 0; i < 4u; ++i)
+        if (!_nextLine(b[i], e[i], pos, buffer))
+            return false;
+    if (b[2] == e[2] || buffer[b[2]] != '+')
+        return false;
+    if (e[2] - b[2] > 1u)
+    {
+        if (e[2] - b[2] != e[0] - b[0])
+            return false;
+        for (size_t i = 1; i < e[0] - b[0]; ++i)
+            if (buffer[b[0] + i] != buffer[b[2] + i])
+                return false;
+    }
+    return e[1] - b[1] == e[3] - b[3];
+}
+
+template <typename TString>
+inline size_t
+_lastRecordBegin(TString const & buffer, Fastq const & /*tag*/)
+{
+    for (size_t pos = length(buffer); pos > 1u; --pos)
+        if (buffer[pos - 1] == '@' && buffer[pos - 2] == '\n' && _isFastqRecordBegin(buffer, pos - 1))
+            return pos - 1;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _readParallelChunk()
+// ----------------------------------------------------------------------------
+
+// Read the next chunk that ends on a record boundary.  Sets chunk to the empty string if there is no more input.
+
+template <typename TStream, typename TPass, typename TTag>
+inline int
+_readParallelChunk(CharString & chunk,
+                   SequenceStreamParallelState_ & state,
+                   RecordReader<TStream, TPass> & reader,
+                   TTag const & tag)
+{
+    clear(chunk);
+    swap(chunk, state.carry);
+
+    size_t targetSize = state.chunkSize;
+    while (true)
+    {
+        if (length(chunk) < targetSize)
+        {
+            int res = _appendFromRecordReader(chunk, reader, targetSize - length(chunk));
+            if (res != 0)
+                return res;
+        }
+        if (atEnd(reader))
+            return 0;
+
+        size_t pos = _lastRecordBegin(chunk, tag);
+        if (pos != 0u)
+        {
+            state.carry = suffix(chunk, pos);
+            resize(chunk, pos);
+            return 0;
+        }
+        // No record boundary, the record is larger than the chunk.
+        targetSize *= 2;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _parseParallelChunk()
+// ----------------------------------------------------------------------------
+
+// Parse all records of a chunk.
+
+template <typename TRecordSet, typename TTag>
+inline int
+_parseParallelChunk(TRecordSet & ids,
+                    TRecordSet & seqs,
+                    TRecordSet & quals,
+                    CharString & chunk,
+                    TTag const & tag)
+{
+    CharString id;
+    CharString seq;
+    CharString qual;
+
+    clear(ids);
+    clear(seqs);
+    clear(quals);
+
+    RecordReader<CharString, SinglePass<StringReader> > reader(chunk);
+    while (!atEnd(reader))
+    {
+        int res = readRecord(id, seq, qual, reader, tag);
+        if (res != 0)
+            return res;
+        appendValue(ids, id);
+        appendValue(seqs, seq);
+        appendValue(quals, qual);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _skipEmptyParallelChunks()
+// ----------------------------------------------------------------------------
+
+inline void
+_skipEmptyParallelChunks(SequenceStreamParallelState_ & state)
+{
+    while (state.cacheChunk < length(state.ids) && state.cacheRecord == length(state.ids[state.cacheChunk]))
+    {
+        ++state.cacheChunk;
+        state.cacheRecord = 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _parallelCacheEmpty()
+// ----------------------------------------------------------------------------
+
+inline bool
+_parallelCacheEmpty(SequenceStreamParallelState_ const & state)
+{
+    return state.cacheChunk >= length(state.ids);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _fillParallelCache()
+// ----------------------------------------------------------------------------
+
+// Parse the next chunks into the cache.  The cache stays empty at the end of the input.
+
+template <typename TStream, typename TPass, typename TTag>
+inline int
+_fillParallelCache(SequenceStreamParallelState_ & state,
+                   RecordReader<TStream, TPass> & reader,
+                   TTag const & tag)
+{
+    unsigned numThreads = _max(1u, state.numThreads);
+    int res = 0;
+
+    // Make sure that the chunks to parse are there, this only blocks if the read-ahead fell behind.
+    CharString chunk;
+    while (length(state.chunks) < numThreads)
+    {
+        if ((res = _readParallelChunk(chunk, state, reader, tag)) != 0)
+            return res;
+        if (empty(chunk))
+            break;
+        appendValue(state.chunks, chunk);
+    }
+    unsigned numChunks = _min(numThreads, (unsigned)length(state.chunks));
+
+    resize(state.ids, numChunks);
+    resize(state.seqs, numChunks);
+    resize(state.quals, numChunks);
+    state.cacheChunk = 0;
+    state.cacheRecord = 0;
+    if (numChunks == 0u)
+        return 0;
+
+    // One thread reads the next chunks while the others parse the current ones.
+    String<CharString> nextChunks;
+    String<int> chunkResults;
+    resize(chunkResults, numChunks, 0);
+    int readResult = 0;
+    SEQAN_OMP_PRAGMA(parallel num_threads(numThreads))
+    {
+        SEQAN_OMP_PRAGMA(single nowait)
+        {
+            CharString nextChunk;
+            for (unsigned i = numChunks; i < 2 * numThreads; ++i)
+            {
+                if ((readResult = _readParallelChunk(nextChunk, state, reader, tag)) != 0 || empty(nextChunk))
+                    break;
+                appendValue(nextChunks, nextChunk);
+            }
+        }
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic))
+        for (int i = 0; i < (int)numChunks; ++i)
+            chunkResults[i] = _parseParallelChunk(state.ids[i], state.seqs[i], state.quals[i], state.chunks[i], tag);
+    }
+
+    erase(state.chunks, 0, numChunks);
+    append(state.chunks, nextChunks);
+    for (unsigned i = 0; i < numChunks; ++i)
+        if (chunkResults[i] != 0)
+            return chunkResults[i];
+    _skipEmptyParallelChunks(state);
+    return readResult;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _assignParsedRecord()
+// ----------------------------------------------------------------------------
+
+// Copy the next cached record to id, seq and qual, qual can be Nothing.  In this case, the qualities are stored in
+// seq if its alphabet has qualities.
+
+template <typename TSeq, typename TQual>
+inline void
+_assignParsedQualities(TSeq & /*seq*/, TQual const & /*qual*/, False const & /*hasQualities*/)
+{}
+
+template <typename TSeq, typename TQual>
+inline void
+_assignParsedQualities(TSeq & seq, TQual const & qual, True const & /*hasQualities*/)
+{
+    assignQualities(seq, qual);
+}
+
+template <typename TId, typename TSeq, typename TQual>
+inline void
+_assignParsedRecord(TId & id, TSeq & seq, TQual & qual, SequenceStreamParallelState_ const & state)
+{
+    assign(id, state.ids[state.cacheChunk][state.cacheRecord]);
+    assign(seq, state.seqs[state.cacheChunk][state.cacheRecord]);
+    assign(qual, state.quals[state.cacheChunk][state.cacheRecord]);
+}
+
+template <typename TId, typename TSeq>
+inline void
+_assignParsedRecord(TId & id, TSeq & seq, Nothing & /*qual*/, SequenceStreamParallelState_ const & state)
+{
+    typedef typename HasQualities<typename Value<TSeq>::Type>::Type THasQualities;
+
+    assign(id, state.ids[state.cacheChunk][state.cacheRecord]);
+    assign(seq, state.seqs[state.cacheChunk][state.cacheRecord]);
+    _assignParsedQualities(seq, state.quals[state.cacheChunk][state.cacheRecord], THasQualities());
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _appendParsedRecord()
+// ----------------------------------------------------------------------------
+
+// Append the next cached record to ids, seqs and quals, quals can be Nothing.
+
+template <typename TIdSet, typename TSeqSet, typename TQualSet>
+inline void
+_appendParsedRecord(TIdSet & ids, TSeqSet & seqs, TQualSet & quals, SequenceStreamParallelState_ const & state)
+{
+    appendValue(ids, state.ids[state.cacheChunk][state.cacheRecord]);
+    appendValue(seqs, state.seqs[state.cacheChunk][state.cacheRecord]);
+    appendValue(quals, state.quals[state.cacheChunk][state.cacheRecord]);
+}
+
+template <typename TIdSet, typename TSeqSet>
+inline void
+_appendParsedRecord(TIdSet & ids, TSeqSet & seqs, Nothing & /*quals*/, SequenceStreamParallelState_ const & state)
+{
+    typedef typename HasQualities<typename Value<typename Value<TSeqSet>::Type>::Type>::Type THasQualities;
+
+    appendValue(ids, state.ids[state.cacheChunk][state.cacheRecord]);
+    appendValue(seqs, state.seqs[state.cacheChunk][state.cacheRecord]);
+    _assignParsedQualities(back(seqs), state.quals[state.cacheChunk][state.cacheRecord], THasQualities());
+}
+
+// ----------------------------------------------------------------------------
+// Function _readRecordParallel()
+// ----------------------------------------------------------------------------
+
+// Read the next record, qual can be Nothing.  Returns 1 at the end of the input.
+
+template <typename TId, typename TSeq, typename TQual, typename TStream, typename TPass, typename TTag>
+inline int
+_readRecordParallel(TId & id,
+                    TSeq & seq,
+                    TQual & qual,
+                    SequenceStreamParallelState_ & state,
+                    RecordReader<TStream, TPass> & reader,
+                    TTag const & tag)
+{
+    if (_parallelCacheEmpty(state))
+    {
+        int res = _fillParallelCache(state, reader, tag);
+        if (res != 0)
+            return res;
+        if (_parallelCacheEmpty(state))
+            return 1;
+    }
+    _assignParsedRecord(id, seq, qual, state);
+    ++state.cacheRecord;
+    _skipEmptyParallelChunks(state);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readBatchParallel()
+// ----------------------------------------------------------------------------
+
+// Read up to num records.  The records are appended to ids, seqs and quals, quals can be Nothing.
+
+template <typename TIdSet, typename TSeqSet, typename TQualSet, typename TStream, typename TPass, typename TTag>
+inline int
+_readBatchParallel(TIdSet & ids,
+                   TSeqSet & seqs,
+                   TQualSet & quals,
+                   size_t num,
+                   SequenceStreamParallelState_ & state,
+                   RecordReader<TStream, TPass> & reader,
+                   TTag const & tag)
+{
+    while (length(ids) < num)
+    {
+        if (_parallelCacheEmpty(state))
+        {
+            int res = _fillParallelCache(state, reader, tag);
+            if (res != 0)
+                return res;
+            if (_parallelCacheEmpty(state))
+                break;
+        }
+        _appendParsedRecord(ids, seqs, quals, state);
+        ++state.cacheRecord;
+        _skipEmptyParallelChunks(state);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _atEndParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TStream, typename TPass>
+inline bool
+_atEndParallel(SequenceStreamParallelState_ const & state, RecordReader<TStream, TPass> & reader)
+{
+    return _parallelCacheEmpty(state) && empty(state.chunks) && empty(state.carry) && atEnd(reader);
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef CORE_INCLUDE_SEQAN_SEQ_IO_SEQUENCE_STREAM_PARALLEL_H_
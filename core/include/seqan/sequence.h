@@ -104,6 +104,7 @@
 #include <seqan/sequence/string_cstyle.h>
 #include <seqan/sequence/string_block.h>
 #include <seqan/sequence/string_packed.h>
+#include <seqan/sequence/string_char_span.h>
 
 #include <seqan/sequence/sequence_shortcuts.h>
 
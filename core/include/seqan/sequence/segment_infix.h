@@ -176,6 +176,15 @@ SEQAN_CHECKPOINT
         _checkMemberVariables();
     }
 
+    SEQAN_HOST_DEVICE
+    Segment(Segment const & _other):
+        data_host(_other.data_host),
+        data_begin_position(_other.data_begin_position),
+        data_end_position(_other.data_end_position)
+    {
+SEQAN_CHECKPOINT
+    }
+
     template <typename THost2, typename TSpec2>
     SEQAN_HOST_DEVICE
     Segment(Segment<THost2, TSpec2> const & _other):
@@ -0,0 +1,259 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Appending spans of characters to strings, with a vectorized translation
+// of nucleotide characters and direct packing into Packed string words.
+// ==========================================================================
+
+#ifndef SEQAN_SEQUENCE_STRING_CHAR_SPAN_H_
+#define SEQAN_SEQUENCE_STRING_CHAR_SPAN_H_
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // #if defined(__SSE2__)
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction NucleotideCharCodes_
+// ----------------------------------------------------------------------------
+
+// The ordinal values of 'T'/'t', 'U'/'u' and all characters other than ACGTU in the nucleotide alphabets, as given
+// by the TranslateTableAsciiTo*_ tables.  'A', 'C' and 'G' always translate to 0, 1 and 2.
+
+template <typename TValue>
+struct NucleotideCharCodes_;
+
+template <>
+struct NucleotideCharCodes_<Dna>
+{
+    enum { T = 3, U = 3, OTHER = 0 };
+};
+
+template <>
+struct NucleotideCharCodes_<Dna5>
+{
+    enum { T = 3, U = 3, OTHER = 4 };
+};
+
+template <>
+struct NucleotideCharCodes_<Rna>
+{
+    enum { T = 0, U = 3, OTHER = 0 };
+};
+
+template <>
+struct NucleotideCharCodes_<Rna5>
+{
+    enum { T = 4, U = 3, OTHER = 4 };
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction HasNucleotideCharCodes_
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+struct HasNucleotideCharCodes_ : False {};
+
+template <>
+struct HasNucleotideCharCodes_<Dna> : True {};
+
+template <>
+struct HasNucleotideCharCodes_<Dna5> : True {};
+
+template <>
+struct HasNucleotideCharCodes_<Rna> : True {};
+
+template <>
+struct HasNucleotideCharCodes_<Rna5> : True {};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _translateCharSpan()
+// ----------------------------------------------------------------------------
+
+// Write the ordinal values of the characters in [it, itEnd) converted to TValue to target.
+
+template <typename TValue>
+inline void
+_translateCharSpan(unsigned char * target, char const * it, char const * itEnd, TValue const & /*tag*/,
+                   False const & /*nucleotideCodes*/)
+{
+    for (; it != itEnd; ++it, ++target)
+        *target = ordValue(TValue(*it));
+}
+
+template <typename TValue>
+inline void
+_translateCharSpan(unsigned char * target, char const * it, char const * itEnd, TValue const & /*tag*/,
+                   True const & /*nucleotideCodes*/)
+{
+    typedef NucleotideCharCodes_<TValue> TCodes;
+
+#if defined(__SSE2__)
+    // Translate 16 characters at once.  Clearing bit 5 maps lower case to upper case letters and no other character
+    // to one of ACGTU.
+    __m128i const caseMask = _mm_set1_epi8(static_cast<char>(0xdf));
+    __m128i const charA = _mm_set1_epi8('A');
+    __m128i const charC = _mm_set1_epi8('C');
+    __m128i const charG = _mm_set1_epi8('G');
+    __m128i const charT = _mm_set1_epi8('T');
+    __m128i const charU = _mm_set1_epi8('U');
+    __m128i const codeC = _mm_set1_epi8(1);
+    __m128i const codeG = _mm_set1_epi8(2);
+    __m128i const codeT = _mm_set1_epi8(TCodes::T);
+    __m128i const codeU = _mm_set1_epi8(TCodes::U);
+    __m128i const codeOther = _mm_set1_epi8(TCodes::OTHER);
+    for (; itEnd - it >= 16; it += 16, target += 16)
+    {
+        __m128i chars = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(it)), caseMask);
+        __m128i isA = _mm_cmpeq_epi8(chars, charA);
+        __m128i isC = _mm_cmpeq_epi8(chars, charC);
+        __m128i isG = _mm_cmpeq_epi8(chars, charG);
+        __m128i isT = _mm_cmpeq_epi8(chars, charT);
+        __m128i isU = _mm_cmpeq_epi8(chars, charU);
+        __m128i isKnown = _mm_or_si128(_mm_or_si128(isA, isC), _mm_or_si128(_mm_or_si128(isG, isT), isU));
+        __m128i codes = _mm_andnot_si128(isKnown, codeOther);
+        codes = _mm_or_si128(codes, _mm_and_si128(isC, codeC));
+        codes = _mm_or_si128(codes, _mm_and_si128(isG, codeG));
+        codes = _mm_or_si128(codes, _mm_and_si128(isT, codeT));
+        codes = _mm_or_si128(codes, _mm_and_si128(isU, codeU));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target), codes);
+    }
+#endif  // #if defined(__SSE2__)
+    for (; it != itEnd; ++it, ++target)
+        *target = ordValue(TValue(*it));
+}
+
+template <typename TValue>
+inline void
+_translateCharSpan(unsigned char * target, char const * it, char const * itEnd, TValue const & tag)
+{
+    _translateCharSpan(target, it, itEnd, tag, typename HasNucleotideCharCodes_<TValue>::Type());
+}
+
+// ----------------------------------------------------------------------------
+// Function _appendCharSpan()
+// ----------------------------------------------------------------------------
+
+// Append the characters in [it, itEnd) to target, converted to the target's alphabet.  The general case appends
+// character by character, strings with contiguous storage and packed strings of simple types are filled in bulk.
+
+template <typename TTarget>
+inline void
+_appendCharSpan(TTarget & target, char const * it, char const * itEnd)
+{
+    for (; it != itEnd; ++it)
+        appendValue(target, *it, Generous());
+}
+
+template <typename TValue, typename TSpec>
+inline void
+_appendCharSpan(String<TValue, Alloc<TSpec> > & target, char const * it, char const * itEnd)
+{
+    typename Size<String<TValue, Alloc<TSpec> > >::Type oldLength = length(target);
+    resize(target, oldLength + (itEnd - it), Generous());
+    std::copy(it, itEnd, begin(target, Standard()) + oldLength);
+}
+
+template <typename TValueSpec, typename TSpec>
+inline void
+_appendCharSpan(String<SimpleType<unsigned char, TValueSpec>, Alloc<TSpec> > & target,
+                char const * it,
+                char const * itEnd)
+{
+    typedef SimpleType<unsigned char, TValueSpec> TValue;
+
+    typename Size<String<TValue, Alloc<TSpec> > >::Type oldLength = length(target);
+    resize(target, oldLength + (itEnd - it), Generous());
+    // SimpleType<unsigned char, ...> consists of its ordinal value only.
+    _translateCharSpan(reinterpret_cast<unsigned char *>(begin(target, Standard()) + oldLength), it, itEnd, TValue());
+}
+
+template <typename TValueSpec, typename THostspec>
+inline void
+_appendCharSpan(String<SimpleType<unsigned char, TValueSpec>, Packed<THostspec> > & target,
+                char const * it,
+                char const * itEnd)
+{
+    typedef SimpleType<unsigned char, TValueSpec> TValue;
+    typedef String<TValue, Packed<THostspec> > TString;
+    typedef PackedTraits_<TString> TTraits;
+    typedef typename Size<TString>::Type TSize;
+    typedef typename Iterator<typename Host<TString>::Type, Standard>::Type THostIter;
+    typedef typename Value<typename Host<TString>::Type>::Type TTuple;
+    typedef typename TTuple::TBitVector TBitVector;
+
+    TSize pos = length(target);
+    resize(target, pos + (itEnd - it), Generous());
+
+    // Fill up the partially used word value by value.
+    for (; it != itEnd && pos % TTraits::VALUES_PER_HOST_VALUE != 0; ++it, ++pos)
+        assignValue(target, pos, TValue(*it));
+
+    // Translate and pack whole words, the first value goes to the most significant bits.
+    unsigned char ordValues[TTraits::VALUES_PER_HOST_VALUE];
+    THostIter itWord = begin(host(target), Standard()) + 1 + pos / TTraits::VALUES_PER_HOST_VALUE;
+    for (; itEnd - it >= (int)TTraits::VALUES_PER_HOST_VALUE; it += TTraits::VALUES_PER_HOST_VALUE, ++itWord)
+    {
+        _translateCharSpan(ordValues, it, it + TTraits::VALUES_PER_HOST_VALUE, TValue());
+        TBitVector word = 0;
+        for (unsigned k = 0; k < (unsigned)TTraits::VALUES_PER_HOST_VALUE; ++k)
+            word = (word << TTraits::BITS_PER_VALUE) | ordValues[k];
+        itWord->i = word;
+        pos += TTraits::VALUES_PER_HOST_VALUE;
+    }
+
+    // Remaining values of the last word.
+    for (; it != itEnd; ++it, ++pos)
+        assignValue(target, pos, TValue(*it));
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_SEQUENCE_STRING_CHAR_SPAN_H_
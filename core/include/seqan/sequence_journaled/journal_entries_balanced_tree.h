@@ -0,0 +1,696 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Journal entries implementation using a treap with implicit keys.  The
+// nodes store the length of their subtree's segments instead of absolute
+// virtual positions, so insertions and erasures only touch O(log n) nodes.
+// ==========================================================================
+
+#ifndef SEQAN_SEQUENCE_JOURNALED_JOURNAL_ENTRIES_BALANCED_TREE_H_
+#define SEQAN_SEQUENCE_JOURNALED_JOURNAL_ENTRIES_BALANCED_TREE_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes
+// ============================================================================
+
+/*!
+ * @tag JournaledString#BalancedTree
+ * @headerfile <seqan/sequence_journaled.h>
+ * @brief Journal spec with logarithmic time insertions, erasures and random access.
+ *
+ * @signature struct BalancedTree;
+ *
+ * The journal entries are stored in a randomized balanced binary tree (treap) that is ordered by the virtual
+ * position.  Each node stores the total length of the segments in its subtree, the virtual positions are computed
+ * on the way down and by the iterators.  <tt>insert</tt>, <tt>erase</tt> and <tt>value</tt> of a JournaledString
+ * take expected O(log n) time for n journal entries, compared to O(n) time for <tt>SortedArray</tt>.
+ */
+
+/**
+.Tag.BalancedTree
+..cat:Sequences
+..summary:Journal spec with logarithmic time insertions, erasures and random access.
+..signature:BalancedTree
+..remarks:The journal entries are stored in a randomized balanced binary tree (treap) that is ordered by the virtual position.
+Each node stores the total length of the segments in its subtree, the virtual positions are computed on the way down and by the iterators.
+$insert$, $erase$ and $value$ of a @Spec.Journaled String@ take expected O(log n) time for n journal entries, compared to O(n) time for $SortedArray$.
+..see:Spec.Journaled String
+..include:seqan/sequence_journaled.h
+ */
+
+struct BalancedTree {};
+
+
+template <typename TNode, typename TTreeSpec>
+class JournalEntries;
+
+
+template <typename TCargo>
+struct JournalEntriesBalancedTreeNode
+{
+    typedef typename Size<TCargo>::Type TSize;
+
+    // The journal entry, its virtualPosition is not maintained.
+    TCargo cargo;
+    // Left child, right child and parent, 0 for none.
+    unsigned left;
+    unsigned right;
+    unsigned parent;
+    // Heap priority of the treap.
+    unsigned priority;
+    // Sum of the entry lengths in the subtree.
+    TSize subtreeLength;
+
+    JournalEntriesBalancedTreeNode() : left(0), right(0), parent(0), priority(0), subtreeLength(0) {}
+
+    JournalEntriesBalancedTreeNode(TCargo const & _cargo, unsigned _priority)
+            : cargo(_cargo),
+              left(0),
+              right(0),
+              parent(0),
+              priority(_priority),
+              subtreeLength(_cargo.length) {}
+};
+
+
+template <typename TCargo_>
+class JournalEntries<TCargo_, BalancedTree>
+{
+public:
+    typedef TCargo_ TCargo;
+    typedef JournalEntriesBalancedTreeNode<TCargo> TNode;
+    typedef typename Position<TCargo>::Type TPos;
+    typedef typename Size<TCargo>::Type TSize;
+    typedef BalancedTree TSpec;
+
+    // The nodes, referenced by their position.  Node 0 is a sentinel for empty subtrees.
+    String<TNode> _nodes;
+    // Positions of erased nodes, reused by the next insertions.
+    String<unsigned> _freeNodes;
+    // The root node, 0 if the tree is empty.
+    unsigned _root;
+    // Number of journal entries.
+    unsigned _size;
+    // State of the random number generator for the priorities.
+    unsigned _rngState;
+    // Length of the underlying string.
+    TSize _originalStringLength;
+
+    JournalEntries() : _root(0), _size(0), _rngState(2463534242u), _originalStringLength(0)
+    {
+        resize(_nodes, 1);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+template <typename TCargo>
+struct Value<JournalEntries<TCargo, BalancedTree> >
+{
+    typedef TCargo Type;
+};
+
+template <typename TCargo>
+struct Value<JournalEntries<TCargo, BalancedTree> const>
+{
+    typedef TCargo const Type;
+};
+
+template <typename TCargo>
+struct Reference<JournalEntries<TCargo, BalancedTree> >
+{
+    typedef TCargo const & Type;
+};
+
+template <typename TCargo>
+struct Reference<JournalEntries<TCargo, BalancedTree> const>
+{
+    typedef TCargo const & Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+template <typename TStream, typename TCargo>
+inline
+TStream &
+operator<<(TStream & stream, JournalEntries<TCargo, BalancedTree> const & tree)
+{
+    typedef typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type TIterator;
+
+    stream << "JournalEntries(";
+    for (TIterator it = begin(tree, Standard()), itEnd = end(tree, Standard()); it != itEnd; ++it)
+    {
+        if (it != begin(tree, Standard()))
+            stream << ", ";
+        stream << value(it);
+    }
+    stream << ")";
+    return stream;
+}
+
+// ----------------------------------------------------------------------------
+// Tree helpers
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline unsigned
+_newNode(JournalEntries<TCargo, BalancedTree> & tree, TCargo const & cargo)
+{
+    typedef typename JournalEntries<TCargo, BalancedTree>::TNode TNode;
+
+    // xorshift32
+    tree._rngState ^= tree._rngState << 13;
+    tree._rngState ^= tree._rngState >> 17;
+    tree._rngState ^= tree._rngState << 5;
+
+    unsigned id;
+    if (empty(tree._freeNodes))
+    {
+        id = length(tree._nodes);
+        appendValue(tree._nodes, TNode(cargo, tree._rngState));
+    }
+    else
+    {
+        id = back(tree._freeNodes);
+        eraseBack(tree._freeNodes);
+        tree._nodes[id] = TNode(cargo, tree._rngState);
+    }
+    ++tree._size;
+    return id;
+}
+
+template <typename TCargo>
+inline void
+_deleteSubtree(JournalEntries<TCargo, BalancedTree> & tree, unsigned id)
+{
+    if (id == 0)
+        return;
+    _deleteSubtree(tree, tree._nodes[id].left);
+    _deleteSubtree(tree, tree._nodes[id].right);
+    appendValue(tree._freeNodes, id);
+    --tree._size;
+}
+
+// Recompute the subtree length of a node and link its children to it.
+template <typename TCargo>
+inline void
+_updateNode(JournalEntries<TCargo, BalancedTree> & tree, unsigned id)
+{
+    typedef typename JournalEntries<TCargo, BalancedTree>::TNode TNode;
+
+    TNode & node = tree._nodes[id];
+    node.subtreeLength = node.cargo.length;
+    if (node.left != 0)
+    {
+        node.subtreeLength += tree._nodes[node.left].subtreeLength;
+        tree._nodes[node.left].parent = id;
+    }
+    if (node.right != 0)
+    {
+        node.subtreeLength += tree._nodes[node.right].subtreeLength;
+        tree._nodes[node.right].parent = id;
+    }
+}
+
+// Split the subtree into the entries left of the virtual position pos and the entries right of it.  pos must be the
+// beginning of an entry.
+template <typename TCargo, typename TPos>
+inline void
+_splitTree(JournalEntries<TCargo, BalancedTree> & tree, unsigned id, TPos pos, unsigned & left, unsigned & right)
+{
+    if (id == 0)
+    {
+        left = right = 0;
+        return;
+    }
+    TPos leftLength = (tree._nodes[id].left != 0) ? tree._nodes[tree._nodes[id].left].subtreeLength : 0;
+    if (pos <= leftLength)
+    {
+        unsigned l = 0;
+        _splitTree(tree, tree._nodes[id].left, pos, left, l);
+        tree._nodes[id].left = l;
+        right = id;
+    }
+    else
+    {
+        SEQAN_ASSERT_GEQ(pos, leftLength + tree._nodes[id].cargo.length);
+        unsigned r = 0;
+        _splitTree(tree, tree._nodes[id].right, pos - leftLength - tree._nodes[id].cargo.length, r, right);
+        tree._nodes[id].right = r;
+        left = id;
+    }
+    _updateNode(tree, id);
+}
+
+// Concatenate two subtrees, all entries of left come before the ones of right.
+template <typename TCargo>
+inline unsigned
+_mergeTrees(JournalEntries<TCargo, BalancedTree> & tree, unsigned left, unsigned right)
+{
+    if (left == 0)
+        return right;
+    if (right == 0)
+        return left;
+    if (tree._nodes[left].priority > tree._nodes[right].priority)
+    {
+        unsigned r = _mergeTrees(tree, tree._nodes[left].right, right);
+        tree._nodes[left].right = r;
+        _updateNode(tree, left);
+        return left;
+    }
+    else
+    {
+        unsigned l = _mergeTrees(tree, left, tree._nodes[right].left);
+        tree._nodes[right].left = l;
+        _updateNode(tree, right);
+        return right;
+    }
+}
+
+template <typename TCargo>
+inline void
+_setRoot(JournalEntries<TCargo, BalancedTree> & tree, unsigned id)
+{
+    tree._root = id;
+    if (id != 0)
+        tree._nodes[id].parent = 0;
+}
+
+// Return the entry containing the virtual position pos, or the last entry if pos is behind the end.
+template <typename TCargo, typename TPos, typename TPos2>
+inline unsigned
+_findNode(JournalEntries<TCargo, BalancedTree> const & tree, TPos pos, TPos2 & nodeBegin)
+{
+    unsigned id = tree._root;
+    nodeBegin = 0;
+    if (id == 0)
+        return 0;
+    if ((TPos)tree._nodes[id].subtreeLength <= pos)
+    {
+        // Go to the last entry.
+        nodeBegin = tree._nodes[id].subtreeLength;
+        while (tree._nodes[id].right != 0)
+            id = tree._nodes[id].right;
+        nodeBegin -= tree._nodes[id].cargo.length;
+        return id;
+    }
+    while (true)
+    {
+        unsigned left = tree._nodes[id].left;
+        TPos leftLength = (left != 0) ? tree._nodes[left].subtreeLength : 0;
+        if (pos < nodeBegin + leftLength)
+        {
+            id = left;
+        }
+        else if (pos < nodeBegin + leftLength + tree._nodes[id].cargo.length)
+        {
+            nodeBegin += leftLength;
+            return id;
+        }
+        else
+        {
+            nodeBegin += leftLength + tree._nodes[id].cargo.length;
+            id = tree._nodes[id].right;
+        }
+    }
+}
+
+// Patches store the physical position of the closest original entry left of them.  Update the run of patches that
+// begins at the virtual position pos after the entries left of it changed.
+template <typename TCargo, typename TPos>
+inline void
+_updatePatchOrigins(JournalEntries<TCargo, BalancedTree> & tree, TPos pos)
+{
+    typedef typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type TIterator;
+
+    if (tree._root == 0 || pos >= (TPos)tree._nodes[tree._root].subtreeLength)
+        return;
+    TPos nodeBegin = 0;
+    TPos physicalOriginPos = 0;
+    if (pos > 0)
+        physicalOriginPos = tree._nodes[_findNode(tree, pos - 1, nodeBegin)].cargo.physicalOriginPosition;
+    for (TIterator it = findInJournalEntries(tree, pos);
+         !atEnd(it) && tree._nodes[it._nodeId].cargo.segmentSource == SOURCE_PATCH; ++it)
+        tree._nodes[it._nodeId].cargo.physicalOriginPosition = physicalOriginPos;
+}
+
+// Make the virtual position pos the beginning of an entry by splitting the entry containing it.
+template <typename TCargo, typename TPos>
+inline void
+_splitEntryAt(JournalEntries<TCargo, BalancedTree> & tree, TPos pos)
+{
+    if (tree._root == 0 || pos == 0 || pos >= (TPos)tree._nodes[tree._root].subtreeLength)
+        return;
+    TPos nodeBegin = 0;
+    unsigned id = _findNode(tree, pos, nodeBegin);
+    if (nodeBegin == pos)
+        return;
+
+    // Shorten the entry to the prefix.
+    TCargo & entry = tree._nodes[id].cargo;
+    TPos offset = pos - nodeBegin;
+    TPos physicalOriginPos = entry.physicalOriginPosition;
+    if (entry.segmentSource == SOURCE_ORIGINAL)
+        physicalOriginPos += offset;
+    TCargo suffix(entry.segmentSource, entry.physicalPosition + offset, 0, physicalOriginPos, entry.length - offset);
+    entry.length = offset;
+    for (unsigned i = id; i != 0; i = tree._nodes[i].parent)
+        tree._nodes[i].subtreeLength -= suffix.length;
+
+    // Insert the suffix behind it.
+    unsigned left = 0, right = 0;
+    _splitTree(tree, tree._root, pos, left, right);
+    unsigned node = _newNode(tree, suffix);
+    _setRoot(tree, _mergeTrees(tree, _mergeTrees(tree, left, node), right));
+    if (suffix.segmentSource == SOURCE_ORIGINAL)
+        _updatePatchOrigins(tree, pos + suffix.length);
+}
+
+// Build the subtree lengths and parent links bottom-up.
+template <typename TCargo>
+inline void
+_updateSubtree(JournalEntries<TCargo, BalancedTree> & tree, unsigned id)
+{
+    if (id == 0)
+        return;
+    _updateSubtree(tree, tree._nodes[id].left);
+    _updateSubtree(tree, tree._nodes[id].right);
+    _updateNode(tree, id);
+}
+
+// ----------------------------------------------------------------------------
+// Function _bulkLoadJournalEntries()
+// ----------------------------------------------------------------------------
+
+// Replace the entries of the tree by the given entries, sorted by virtual position, in linear time.  The priorities
+// are drawn as for single insertions and the treap is built as the Cartesian tree of the entries.
+template <typename TCargo, typename TSpec>
+inline void
+_bulkLoadJournalEntries(JournalEntries<TCargo, BalancedTree> & tree, String<TCargo, TSpec> const & entries)
+{
+    typedef typename Position<TCargo>::Type TPos;
+    typedef typename Iterator<String<TCargo, TSpec> const, Standard>::Type TIterator;
+
+    resize(tree._nodes, 1);
+    reserve(tree._nodes, length(entries) + 1, Exact());
+    clear(tree._freeNodes);
+    tree._size = 0;
+
+    String<unsigned> rightSpine;
+    TPos physicalOriginPos = 0;
+    for (TIterator it = begin(entries, Standard()), itEnd = end(entries, Standard()); it != itEnd; ++it)
+    {
+        unsigned id = _newNode(tree, *it);
+        if (it->segmentSource == SOURCE_ORIGINAL)
+            physicalOriginPos = it->physicalPosition;
+        tree._nodes[id].cargo.physicalOriginPosition = physicalOriginPos;
+
+        unsigned last = 0;
+        while (!empty(rightSpine) && tree._nodes[back(rightSpine)].priority < tree._nodes[id].priority)
+        {
+            last = back(rightSpine);
+            eraseBack(rightSpine);
+        }
+        tree._nodes[id].left = last;
+        if (!empty(rightSpine))
+            tree._nodes[back(rightSpine)].right = id;
+        appendValue(rightSpine, id);
+    }
+
+    _setRoot(tree, empty(rightSpine) ? 0u : rightSpine[0]);
+    _updateSubtree(tree, tree._root);
+}
+
+// ----------------------------------------------------------------------------
+// Function reinit()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline
+void reinit(JournalEntries<TCargo, BalancedTree> & tree,
+            typename Size<TCargo>::Type originalStringLength)
+{
+    SEQAN_CHECKPOINT;
+    clear(tree);
+    tree._originalStringLength = originalStringLength;
+    _setRoot(tree, _newNode(tree, TCargo(SOURCE_ORIGINAL, 0, 0, 0, originalStringLength)));
+}
+
+// ----------------------------------------------------------------------------
+// Function findInJournalEntries()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo, typename TPos>
+inline
+typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type
+findInJournalEntries(JournalEntries<TCargo, BalancedTree> const & journalEntries,
+                     TPos pos)
+{
+    typedef typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type TIterator;
+
+    typename Position<TCargo>::Type nodeBegin = 0;
+    unsigned id = _findNode(journalEntries, pos, nodeBegin);
+    TIterator result;
+    _initJournalEntriesIterator(result, journalEntries, id, nodeBegin);
+    return result;
+}
+
+template <typename TCargo, typename TPos>
+inline
+typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type
+findInJournalEntries(JournalEntries<TCargo, BalancedTree> & journalEntries,
+                     TPos pos)
+{
+    typedef typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type TIterator;
+
+    typename Position<TCargo>::Type nodeBegin = 0;
+    unsigned id = _findNode(journalEntries, pos, nodeBegin);
+    TIterator result;
+    _initJournalEntriesIterator(result, journalEntries, id, nodeBegin);
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function findJournalEntry()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo, typename TPos>
+inline
+TCargo
+findJournalEntry(JournalEntries<TCargo, BalancedTree> const & journalEntries,
+                 TPos pos)
+{
+    return value(findInJournalEntries(journalEntries, pos));
+}
+
+// ----------------------------------------------------------------------------
+// Function recordInsertion()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline
+void recordInsertion(JournalEntries<TCargo, BalancedTree> & tree,
+                     typename Position<TCargo>::Type virtualPosition,
+                     typename Position<TCargo>::Type physicalBeginPos,
+                     typename Size<TCargo>::Type len)
+{
+    typedef typename Position<TCargo>::Type TPos;
+
+    if (len == 0)
+        return;
+
+    // Handle special case that the entry list is empty or only holds the empty entry of an empty host.
+    if (tree._root != 0 && tree._nodes[tree._root].subtreeLength == 0u)
+    {
+        _deleteSubtree(tree, tree._root);
+        _setRoot(tree, 0);
+    }
+    if (tree._root == 0)
+    {
+        SEQAN_ASSERT_EQ(virtualPosition, 0u);
+        _setRoot(tree, _newNode(tree, TCargo(SOURCE_PATCH, physicalBeginPos, virtualPosition, 0, len)));
+        return;
+    }
+    SEQAN_ASSERT_LEQ(virtualPosition, (TPos)tree._nodes[tree._root].subtreeLength);
+
+    _splitEntryAt(tree, virtualPosition);
+
+    // A patch inherits the origin position of the entry left of it.
+    TPos physicalOriginPos = 0;
+    if (virtualPosition > 0)
+    {
+        TPos nodeBegin = 0;
+        physicalOriginPos = tree._nodes[_findNode(tree, virtualPosition - 1, nodeBegin)].cargo.physicalOriginPosition;
+    }
+
+    unsigned left = 0, right = 0;
+    _splitTree(tree, tree._root, virtualPosition, left, right);
+    unsigned node = _newNode(tree, TCargo(SOURCE_PATCH, physicalBeginPos, 0, physicalOriginPos, len));
+    _setRoot(tree, _mergeTrees(tree, _mergeTrees(tree, left, node), right));
+}
+
+// ----------------------------------------------------------------------------
+// Function recordErase()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline
+void recordErase(JournalEntries<TCargo, BalancedTree> & tree,
+                 typename Position<TCargo>::Type pos,
+                 typename Position<TCargo>::Type posEnd)
+{
+    typedef typename Position<TCargo>::Type TPos;
+
+    // Handle case of an empty journal.
+    if (tree._root == 0)
+    {
+        SEQAN_ASSERT_EQ(pos, 0u);
+        SEQAN_ASSERT_EQ(posEnd, 0u);
+        return;
+    }
+    SEQAN_ASSERT_LEQ(pos, posEnd);
+    SEQAN_ASSERT_LEQ(posEnd, (TPos)tree._nodes[tree._root].subtreeLength);
+    if (pos == posEnd)
+        return;
+
+    _splitEntryAt(tree, pos);
+    _splitEntryAt(tree, posEnd);
+
+    unsigned left = 0, middle = 0, right = 0;
+    _splitTree(tree, tree._root, pos, left, right);
+    _splitTree(tree, right, posEnd - pos, middle, right);
+    _deleteSubtree(tree, middle);
+    _setRoot(tree, _mergeTrees(tree, left, right));
+
+    // The patches right of the erased range inherit a new origin position.
+    _updatePatchOrigins(tree, pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function hostToVirtualPosition()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo, typename TPos>
+inline
+typename Position<TCargo>::Type
+hostToVirtualPosition(JournalEntries<TCargo, BalancedTree> const & journalEntries, TPos const & hostPos)
+{
+    typedef JournalEntries<TCargo, BalancedTree> const TJournalEntries;
+    typedef typename Iterator<TJournalEntries, Standard>::Type TIterator;
+    typedef typename Position<TCargo>::Type TCargoPos;
+
+    if (journalEntries._root == 0)
+        return 0;
+
+    TCargoPos result = journalEntries._originalStringLength;
+
+    // Find the first entry with a physical origin position greater than hostPos, the origin positions are sorted.
+    unsigned id = journalEntries._root;
+    unsigned upperBound = 0;
+    TCargoPos nodeBegin = 0;
+    TCargoPos upperBoundBegin = 0;
+    while (id != 0)
+    {
+        unsigned left = journalEntries._nodes[id].left;
+        TCargoPos leftLength = (left != 0) ? journalEntries._nodes[left].subtreeLength : 0;
+        if ((TCargoPos)hostPos < journalEntries._nodes[id].cargo.physicalOriginPosition)
+        {
+            upperBound = id;
+            upperBoundBegin = nodeBegin + leftLength;
+            id = left;
+        }
+        else
+        {
+            nodeBegin += leftLength + journalEntries._nodes[id].cargo.length;
+            id = journalEntries._nodes[id].right;
+        }
+    }
+    TIterator it;
+    if (upperBound != 0)
+        _initJournalEntriesIterator(it, journalEntries, upperBound, upperBoundBegin);
+    else
+        it = end(journalEntries, Standard());
+
+    // From here on, this is the same as for SortedArray.
+    if (!atEnd(it) && value(it).segmentSource == SOURCE_PATCH)
+        return result;
+    if (!atEnd(it))
+        result = value(it).virtualPosition;
+    if (it == begin(journalEntries, Standard()))
+        return result;
+
+    --it;
+    while (it != begin(journalEntries, Standard()) && value(it).segmentSource == SOURCE_PATCH)
+        --it;
+    if (value(it).segmentSource == SOURCE_PATCH)
+        return result;
+    if ((TCargoPos)hostPos >= (TCargoPos)(value(it).physicalPosition + value(it).length))
+        return result;
+    return value(it).virtualPosition + (hostPos - value(it).physicalPosition);
+}
+
+// ----------------------------------------------------------------------------
+// Function length()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline unsigned
+length(JournalEntries<TCargo, BalancedTree> const & journalEntries)
+{
+    return journalEntries._size;
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline void
+clear(JournalEntries<TCargo, BalancedTree> & journalEntries)
+{
+    resize(journalEntries._nodes, 1);
+    clear(journalEntries._freeNodes);
+    journalEntries._root = 0;
+    journalEntries._size = 0;
+    journalEntries._originalStringLength = 0u;
+}
+
+}  // namespace seqan
+
+#endif  // SEQAN_SEQUENCE_JOURNALED_JOURNAL_ENTRIES_BALANCED_TREE_H_
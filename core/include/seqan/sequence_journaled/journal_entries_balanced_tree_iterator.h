@@ -0,0 +1,397 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Iterator for JournalEntries<TCargo, BalancedTree>.  The iterator keeps a
+// copy of the current entry with its virtual position filled in.
+// ==========================================================================
+
+#ifndef SEQAN_SEQUENCE_JOURNALED_JOURNAL_ENTRIES_BALANCED_TREE_ITERATOR_H_
+#define SEQAN_SEQUENCE_JOURNALED_JOURNAL_ENTRIES_BALANCED_TREE_ITERATOR_H_
+
+namespace seqan {
+
+// ============================================================================
+// Tags, Classes
+// ============================================================================
+
+template <typename TJournalEntriesSpec>
+struct JournalEntriesIterSpec;
+
+
+template <typename TJournalEntries>
+class Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> >
+{
+public:
+    typedef Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > TIter;
+    typedef typename TJournalEntries::TCargo TCargo;
+
+    // The iterated tree.
+    TJournalEntries * _journalEntries;
+    // The current node, 0 for the end.
+    unsigned _nodeId;
+    // The current entry, including its virtual position.
+    TCargo _cargo;
+
+    Iter() : _journalEntries(0), _nodeId(0) {}
+
+    Iter(TIter const & other)
+            : _journalEntries(other._journalEntries),
+              _nodeId(other._nodeId),
+              _cargo(other._cargo)
+    {}
+
+    Iter(typename IterComplementConst<TIter>::Type const & other)
+            : _journalEntries(other._journalEntries),
+              _nodeId(other._nodeId),
+              _cargo(other._cargo)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+template <typename TCargo>
+struct Iterator<JournalEntries<TCargo, BalancedTree>, Standard>
+{
+    typedef Iter<JournalEntries<TCargo, BalancedTree>, JournalEntriesIterSpec<BalancedTree> > Type;
+};
+
+template <typename TCargo>
+struct Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>
+{
+    typedef Iter<JournalEntries<TCargo, BalancedTree> const, JournalEntriesIterSpec<BalancedTree> > Type;
+};
+
+template <typename TJournalEntries>
+struct Value<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >
+{
+    typedef typename TJournalEntries::TCargo Type;
+};
+
+template <typename TJournalEntries>
+struct GetValue<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >
+{
+    typedef typename TJournalEntries::TCargo Type;
+};
+
+// The entries cannot be modified through the iterator.
+template <typename TJournalEntries>
+struct Reference<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >
+{
+    typedef typename TJournalEntries::TCargo const & Type;
+};
+
+template <typename TJournalEntries>
+struct Reference<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const>
+{
+    typedef typename TJournalEntries::TCargo const & Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// Point the iterator to the node id that begins at the virtual position virtualPos.
+template <typename TJournalEntries, typename TPos>
+inline void
+_initJournalEntriesIterator(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator,
+                            TJournalEntries & tree,
+                            unsigned id,
+                            TPos virtualPos)
+{
+    iterator._journalEntries = &tree;
+    iterator._nodeId = id;
+    if (id != 0)
+    {
+        iterator._cargo = tree._nodes[id].cargo;
+        iterator._cargo.virtualPosition = virtualPos;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function begin()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline
+typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type
+begin(JournalEntries<TCargo, BalancedTree> const & journalTree, Standard const &)
+{
+    typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type result;
+    unsigned id = journalTree._root;
+    if (id != 0)
+        while (journalTree._nodes[id].left != 0)
+            id = journalTree._nodes[id].left;
+    _initJournalEntriesIterator(result, journalTree, id, 0u);
+    return result;
+}
+
+template <typename TCargo>
+inline
+typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type
+begin(JournalEntries<TCargo, BalancedTree> & journalTree, Standard const &)
+{
+    typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type result;
+    unsigned id = journalTree._root;
+    if (id != 0)
+        while (journalTree._nodes[id].left != 0)
+            id = journalTree._nodes[id].left;
+    _initJournalEntriesIterator(result, journalTree, id, 0u);
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function end()
+// ----------------------------------------------------------------------------
+
+template <typename TCargo>
+inline
+typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type
+end(JournalEntries<TCargo, BalancedTree> const & journalTree, Standard const &)
+{
+    typename Iterator<JournalEntries<TCargo, BalancedTree> const, Standard>::Type result;
+    _initJournalEntriesIterator(result, journalTree, 0u, 0u);
+    return result;
+}
+
+template <typename TCargo>
+inline
+typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type
+end(JournalEntries<TCargo, BalancedTree> & journalTree, Standard const &)
+{
+    typename Iterator<JournalEntries<TCargo, BalancedTree>, Standard>::Type result;
+    _initJournalEntriesIterator(result, journalTree, 0u, 0u);
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function value()
+// ----------------------------------------------------------------------------
+
+template <typename TJournalEntries>
+inline
+typename Reference<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >::Type
+value(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator)
+{
+    SEQAN_ASSERT_NEQ(iterator._nodeId, 0u);
+    return iterator._cargo;
+}
+
+template <typename TJournalEntries>
+inline
+typename Reference<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const>::Type
+value(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & iterator)
+{
+    SEQAN_ASSERT_NEQ(iterator._nodeId, 0u);
+    return iterator._cargo;
+}
+
+template <typename TJournalEntries>
+inline
+typename Reference<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >::Type
+operator*(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator)
+{
+    return iterator._cargo;
+}
+
+template <typename TJournalEntries>
+inline
+typename Reference<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const>::Type
+operator*(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & iterator)
+{
+    return iterator._cargo;
+}
+
+// ----------------------------------------------------------------------------
+// Function atEnd()
+// ----------------------------------------------------------------------------
+
+template <typename TJournalEntries>
+inline
+bool
+atEnd(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & iterator)
+{
+    return iterator._nodeId == 0;
+}
+
+template <typename TJournalEntries>
+inline
+bool
+atEnd(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator)
+{
+    return iterator._nodeId == 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function operator++()
+// ----------------------------------------------------------------------------
+
+template <typename TJournalEntries>
+inline
+Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > &
+operator++(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator)
+{
+    SEQAN_ASSERT_NEQ(iterator._nodeId, 0u);
+    TJournalEntries & tree = *iterator._journalEntries;
+    unsigned id = iterator._nodeId;
+    if (tree._nodes[id].right != 0)
+    {
+        // Leftmost node of the right subtree.
+        id = tree._nodes[id].right;
+        while (tree._nodes[id].left != 0)
+            id = tree._nodes[id].left;
+    }
+    else
+    {
+        // First ancestor that has us in its left subtree.
+        unsigned child = id;
+        id = tree._nodes[id].parent;
+        while (id != 0 && tree._nodes[id].right == child)
+        {
+            child = id;
+            id = tree._nodes[id].parent;
+        }
+    }
+    _initJournalEntriesIterator(iterator, tree, id, iterator._cargo.virtualPosition + iterator._cargo.length);
+    return iterator;
+}
+
+template <typename TJournalEntries>
+inline
+Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> >
+operator++(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator, int /*postfix*/)
+{
+    Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > temp(iterator);
+    ++iterator;
+    return temp;
+}
+
+// ----------------------------------------------------------------------------
+// Function operator--()
+// ----------------------------------------------------------------------------
+
+template <typename TJournalEntries>
+inline
+Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > &
+operator--(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator)
+{
+    TJournalEntries & tree = *iterator._journalEntries;
+    unsigned id = iterator._nodeId;
+    if (id == 0)
+    {
+        // The last entry.
+        id = tree._root;
+        SEQAN_ASSERT_NEQ(id, 0u);
+        while (tree._nodes[id].right != 0)
+            id = tree._nodes[id].right;
+        _initJournalEntriesIterator(iterator, tree, id,
+                                    tree._nodes[tree._root].subtreeLength - tree._nodes[id].cargo.length);
+        return iterator;
+    }
+    if (tree._nodes[id].left != 0)
+    {
+        // Rightmost node of the left subtree.
+        id = tree._nodes[id].left;
+        while (tree._nodes[id].right != 0)
+            id = tree._nodes[id].right;
+    }
+    else
+    {
+        // First ancestor that has us in its right subtree.
+        unsigned child = id;
+        id = tree._nodes[id].parent;
+        while (id != 0 && tree._nodes[id].left == child)
+        {
+            child = id;
+            id = tree._nodes[id].parent;
+        }
+        SEQAN_ASSERT_NEQ(id, 0u);
+    }
+    _initJournalEntriesIterator(iterator, tree, id, iterator._cargo.virtualPosition - tree._nodes[id].cargo.length);
+    return iterator;
+}
+
+template <typename TJournalEntries>
+inline
+Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> >
+operator--(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > & iterator, int /*postfix*/)
+{
+    Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > temp(iterator);
+    --iterator;
+    return temp;
+}
+
+// ----------------------------------------------------------------------------
+// Function operator==()
+// ----------------------------------------------------------------------------
+
+template <typename TJournalEntries>
+inline
+bool
+operator==(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & a,
+           Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & b)
+{
+    return a._nodeId == b._nodeId;
+}
+
+template <typename TJournalEntries>
+inline
+bool
+operator==(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & a,
+           typename IterComplementConst<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >::Type const & b)
+{
+    return a._nodeId == b._nodeId;
+}
+
+template <typename TJournalEntries>
+inline
+bool
+operator!=(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & a,
+           Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & b)
+{
+    return a._nodeId != b._nodeId;
+}
+
+template <typename TJournalEntries>
+inline
+bool
+operator!=(Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > const & a,
+           typename IterComplementConst<Iter<TJournalEntries, JournalEntriesIterSpec<BalancedTree> > >::Type const & b)
+{
+    return a._nodeId != b._nodeId;
+}
+
+}  // namespace seqan
+
+#endif  // SEQAN_SEQUENCE_JOURNALED_JOURNAL_ENTRIES_BALANCED_TREE_ITERATOR_H_
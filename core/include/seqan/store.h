@@ -40,6 +40,7 @@
 #include <seqan/parallel.h>
 #include <seqan/bam_io.h>
 #include <seqan/misc/misc_name_store_cache.h>
+#include <seqan/misc/misc_implicit_interval_tree.h>
 
 #include <sstream>
 #include <algorithm>
@@ -66,7 +67,9 @@
 
 #include <seqan/store/store_io.h>
 #include <seqan/store/store_io_sam.h>
+#include <seqan/store/store_io_bam_region.h>
 #include <seqan/store/store_io_gff.h>
 #include <seqan/store/store_io_ucsc.h>
+#include <seqan/store/store_io_snapshot.h>
 
 #endif //#ifndef SEQAN_HEADER_...
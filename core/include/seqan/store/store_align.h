@@ -704,6 +704,225 @@ sortAlignedReads(TAlign const & alignStore, TFunctorLess const &less)
 		less);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// Parallel sorting
+//////////////////////////////////////////////////////////////////////////////
+
+// Extract the member to sort by, the sort is done on compact (key, position) pairs instead of whole elements.
+
+template <typename TAlignedRead, typename TTag>
+struct _KeyAlignedRead;
+
+template <typename TAlignedRead>
+struct _KeyAlignedRead<TAlignedRead, SortId>
+{
+	typedef typename Id<TAlignedRead>::Type Type;
+
+	inline Type
+	operator() (TAlignedRead const & a) const {
+		return a.id;
+	}
+};
+
+template <typename TAlignedRead>
+struct _KeyAlignedRead<TAlignedRead, SortContigId>
+{
+	typedef typename Id<TAlignedRead>::Type Type;
+
+	inline Type
+	operator() (TAlignedRead const & a) const {
+		return a.contigId;
+	}
+};
+
+template <typename TAlignedRead>
+struct _KeyAlignedRead<TAlignedRead, SortBeginPos>
+{
+	typedef typename TAlignedRead::TPos Type;
+
+	inline Type
+	operator() (TAlignedRead const & a) const {
+		return _min(a.beginPos, a.endPos);
+	}
+};
+
+template <typename TAlignedRead>
+struct _KeyAlignedRead<TAlignedRead, SortEndPos>
+{
+	typedef typename TAlignedRead::TPos Type;
+
+	inline Type
+	operator() (TAlignedRead const & a) const {
+		return _max(a.beginPos, a.endPos);
+	}
+};
+
+template <typename TAlignedRead>
+struct _KeyAlignedRead<TAlignedRead, SortPairMatchId>
+{
+	typedef typename Id<TAlignedRead>::Type Type;
+
+	inline Type
+	operator() (TAlignedRead const & a) const {
+		return a.pairMatchId;
+	}
+};
+
+template <typename TAlignedRead>
+struct _KeyAlignedRead<TAlignedRead, SortReadId>
+{
+	typedef typename Id<TAlignedRead>::Type Type;
+
+	inline Type
+	operator() (TAlignedRead const & a) const {
+		return a.readId;
+	}
+};
+
+// Sort the keys in one slice per thread and merge the slices pairwise.  The positions make all keys distinct, so the
+// resulting order is stable.
+template <typename TKeys>
+inline void
+_sortAlignedReadKeys(TKeys & keys, Parallel)
+{
+	typedef typename Size<TKeys>::Type				TSize;
+	typedef typename Iterator<TKeys, Standard>::Type	TIter;
+
+	TSize const minSliceLength = 1 << 14;
+	int numSlices = _max(1, _min(omp_get_max_threads(), (int)(length(keys) / minSliceLength)));
+	String<TSize> splitters;
+	computeSplitters(splitters, length(keys), numSlices);
+
+	TIter it = begin(keys, Standard());
+	SEQAN_OMP_PRAGMA(parallel for schedule(static, 1))
+	for (int i = 0; i < numSlices; ++i)
+		std::sort(it + splitters[i], it + splitters[i + 1]);
+
+	for (int width = 1; width < numSlices; width *= 2)
+	{
+		SEQAN_OMP_PRAGMA(parallel for schedule(static, 1))
+		for (int i = 0; i < numSlices - width; i += 2 * width)
+			std::inplace_merge(it + splitters[i], it + splitters[i + width],
+							   it + splitters[_min(i + 2 * width, numSlices)]);
+	}
+}
+
+/*!
+ * @fn orderAlignedReads
+ * @headerfile <seqan/store.h>
+ * @brief Compute the stable sort order of read alignments in parallel.
+ *
+ * @signature void orderAlignedReads(perm, alignStore, sortTag, Parallel());
+ *
+ * @param[out] perm       A @link String @endlink of positions.  Afterwards, <tt>alignStore[perm[0]]</tt>,
+ *                        <tt>alignStore[perm[1]]</tt>, ... is the sorted sequence.
+ * @param[in]  alignStore The @link SequenceConcept sequence @endlink of @link AlignedReadStoreElement @endlink to
+ *                        order, e.g. @link FragmentStore::alignedReadStore @endlink.
+ * @param[in]  sortTag    Tag for selecting the member to sort by.  See @link SortAlignedReadTags @endlink.
+ *
+ * The alignments are not moved.  Only pairs of the sort key and the position are sorted, which keeps the sort cache
+ * friendly.  The permutation can be applied to the store and to other strings indexed by position with @link
+ * permuteAlignedReads @endlink.
+ *
+ * @see sortAlignedReads
+ * @see permuteAlignedReads
+ */
+
+/*!
+ * @fn permuteAlignedReads
+ * @headerfile <seqan/store.h>
+ * @brief Reorder a sequence in parallel by a permutation.
+ *
+ * @signature void permuteAlignedReads(seq, perm, Parallel());
+ *
+ * @param[in,out] seq  The @link SequenceConcept sequence @endlink to reorder, e.g. @link
+ *                     FragmentStore::alignedReadStore @endlink.
+ * @param[in]     perm A @link String @endlink of positions in <tt>seq</tt>, e.g. computed by @link orderAlignedReads
+ *                     @endlink.  Afterwards, <tt>seq[i]</tt> is the former <tt>seq[perm[i]]</tt>.
+ *
+ * The elements are swapped into place, members such as the gap anchors are not copied.
+ *
+ * @see orderAlignedReads
+ */
+
+/**
+.Function.orderAlignedReads
+..summary:Compute the stable sort order of aligned reads in parallel.
+..cat:Fragment Store
+..signature:orderAlignedReads(perm, alignStore, sortTag, Parallel())
+..param.perm:A string of positions.
+Afterwards, $alignStore[perm[0]]$, $alignStore[perm[1]]$, ... is the sorted sequence.
+...type:Class.String
+..param.alignStore:A sequence of @Class.AlignedReadStoreElement@ to be ordered, e.g. @Memvar.FragmentStore#alignedReadStore@.
+..param.sortTag:Selects the field to sort by.
+...type:Tag.sortAlignedRead Tags
+..remarks:The alignments are not moved.
+Only pairs of the sort key and the position are sorted, which keeps the sort cache friendly.
+The permutation can be applied to the store and to other strings indexed by position with @Function.permuteAlignedReads@.
+..include:seqan/store.h
+..see:Function.sortAlignedReads
+..see:Function.permuteAlignedReads
+
+.Function.permuteAlignedReads
+..summary:Reorder a sequence in parallel by a permutation.
+..cat:Fragment Store
+..signature:permuteAlignedReads(seq, perm, Parallel())
+..param.seq:The sequence to reorder, e.g. @Memvar.FragmentStore#alignedReadStore@.
+..param.perm:A string of positions in $seq$, e.g. computed by @Function.orderAlignedReads@.
+Afterwards, $seq[i]$ is the former $seq[perm[i]]$.
+...type:Class.String
+..remarks:The elements are swapped into place, members such as the gap anchors are not copied.
+..include:seqan/store.h
+..see:Function.orderAlignedReads
+*/
+
+template <typename TPos, typename TPosSpec, typename TAlign, typename TSortSpec>
+inline void
+orderAlignedReads(String<TPos, TPosSpec> & perm, TAlign const & alignStore, Tag<TSortSpec> const &, Parallel)
+{
+	typedef typename Value<TAlign>::Type							TAlignedRead;
+	typedef _KeyAlignedRead<TAlignedRead, Tag<TSortSpec> const>		TKeyFunctor;
+	typedef Pair<typename TKeyFunctor::Type, TPos>					TKey;
+
+	TKeyFunctor getKey;
+	String<TKey> keys;
+	resize(keys, length(alignStore), Exact());
+	SEQAN_OMP_PRAGMA(parallel for schedule(static))
+	for (__int64 i = 0; i < (__int64)length(keys); ++i)
+		keys[i] = TKey(getKey(alignStore[i]), i);
+
+	_sortAlignedReadKeys(keys, Parallel());
+
+	resize(perm, length(keys), Exact());
+	SEQAN_OMP_PRAGMA(parallel for schedule(static))
+	for (__int64 i = 0; i < (__int64)length(keys); ++i)
+		perm[i] = keys[i].i2;
+}
+
+template <typename TSequence, typename TPos, typename TPosSpec>
+inline void
+permuteAlignedReads(TSequence & seq, String<TPos, TPosSpec> const & perm, Parallel)
+{
+	using std::swap;
+
+	SEQAN_ASSERT_EQ(length(seq), length(perm));
+	TSequence result;
+	resize(result, length(perm), Exact());
+	SEQAN_OMP_PRAGMA(parallel for schedule(static))
+	for (__int64 i = 0; i < (__int64)length(perm); ++i)
+		swap(result[i], seq[perm[i]]);
+	swap(seq, result);
+}
+
+template <typename TAlign, typename TSortSpec>
+inline void
+sortAlignedReads(TAlign & alignStore, Tag<TSortSpec> const & sortTag, Parallel)
+{
+	String<typename Size<TAlign>::Type> perm;
+	orderAlignedReads(perm, alignStore, sortTag, Parallel());
+	permuteAlignedReads(alignStore, perm, Parallel());
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 
 template <typename TAlign, typename TSearchValue>
@@ -2061,8 +2061,8 @@ void layoutAlignment(AlignedReadLayout &layout, FragmentStore<TSpec, TConfig> &s
 	typedef typename Iterator<TRows>::Type							TRowsIter;
 	
 	// sort matches by increasing begin positions
-	sortAlignedReads(store.alignedReadStore, SortBeginPos());
-	sortAlignedReads(store.alignedReadStore, SortContigId());
+	sortAlignedReads(store.alignedReadStore, SortBeginPos(), Parallel());
+	sortAlignedReads(store.alignedReadStore, SortContigId(), Parallel());
 
 	clear(layout.contigRows);
 	TAlignedReadIter it = begin(store.alignedReadStore, Standard());
@@ -2358,8 +2358,8 @@ void convertMatchesToGlobalAlignment(FragmentStore<TSpec, TConfig> &store, TScor
         resize(store.alignQualityStore, length(store.alignedReadStore));
 	
 	// sort matches by increasing begin positions
-	sortAlignedReads(store.alignedReadStore, SortBeginPos());
-	sortAlignedReads(store.alignedReadStore, SortContigId());
+	sortAlignedReads(store.alignedReadStore, SortBeginPos(), Parallel());
+	sortAlignedReads(store.alignedReadStore, SortContigId(), Parallel());
 
 	TReadSeq readSeq;
 	TId lastContigId = TAlignedRead::INVALID_ID;
@@ -2713,8 +2713,8 @@ void convertPairWiseToGlobalAlignment(FragmentStore<TSpec, TConfig> &store, TCon
 	typedef typename Iterator<TReadGaps>::Type										TReadIter;
 
 	// sort matches by increasing begin positions
-	sortAlignedReads(store.alignedReadStore, SortBeginPos());
-	sortAlignedReads(store.alignedReadStore, SortContigId());
+	sortAlignedReads(store.alignedReadStore, SortBeginPos(), Parallel());
+	sortAlignedReads(store.alignedReadStore, SortContigId(), Parallel());
 
 	TReadSeq readSeq;
 	TId lastContigId = TAlignedRead::INVALID_ID;
@@ -188,6 +188,261 @@ findIntervalsForInterval(String<TCargo> & result, TIntervalTree & intervalTree,
 
 
 
+//////////////////////////////////////////////////////////////////////////////
+// Overlap join of aligned reads and annotations
+//////////////////////////////////////////////////////////////////////////////
+
+// Orders positions in the alignedReadStore by contig and left-most position.
+template <typename TAlignedReadStore>
+struct AlignedReadContigPosLess_
+{
+    TAlignedReadStore const & alignedReadStore;
+
+    AlignedReadContigPosLess_(TAlignedReadStore const & _alignedReadStore) :
+        alignedReadStore(_alignedReadStore)
+    {}
+
+    template <typename TPos>
+    inline bool operator() (TPos a, TPos b) const
+    {
+        typename Value<TAlignedReadStore>::Type const & alignA = alignedReadStore[a];
+        typename Value<TAlignedReadStore>::Type const & alignB = alignedReadStore[b];
+        if (alignA.contigId != alignB.contigId)
+            return alignA.contigId < alignB.contigId;
+        return std::min(alignA.beginPos, alignA.endPos) < std::min(alignB.beginPos, alignB.endPos);
+    }
+};
+
+// Collects (alignment, annotation) pairs per chunk, so that the chunks can be filled in parallel.
+template <typename TPair>
+struct AnnotationOverlapPairs_
+{
+    String<String<TPair> > chunkPairs;
+
+    inline void init(unsigned numChunks)
+    {
+        resize(chunkPairs, numChunks, Exact());
+    }
+
+    template <typename TAlignPos, typename THits>
+    inline void operator() (unsigned chunk, TAlignPos alignPos, THits const & hits)
+    {
+        for (unsigned i = 0; i < length(hits); ++i)
+            appendValue(chunkPairs[chunk], TPair(alignPos, hits[i]), Generous());
+    }
+};
+
+// Counts the alignments overlapping each annotation.
+template <typename TCount>
+struct AnnotationOverlapCounts_
+{
+    String<TCount> & counts;
+
+    AnnotationOverlapCounts_(String<TCount> & _counts) :
+        counts(_counts)
+    {}
+
+    inline void init(unsigned /*numChunks*/)
+    {}
+
+    template <typename TAlignPos, typename THits>
+    inline void operator() (unsigned /*chunk*/, TAlignPos /*alignPos*/, THits const & hits)
+    {
+        for (unsigned i = 0; i < length(hits); ++i)
+            atomicInc(counts[hits[i]]);
+    }
+};
+
+// Partitions the alignments by contig and position and reports the annotations overlapping each alignment to
+// delegate.  The partitions are processed in parallel, each by one sweep over its alignments and the annotations of
+// its contig.
+template <typename TSpec, typename TConfig, typename TDelegate>
+inline void
+_joinAnnotationOverlaps(FragmentStore<TSpec, TConfig> const & store, TDelegate & delegate)
+{
+    typedef FragmentStore<TSpec, TConfig>                       TFragmentStore;
+    typedef typename TFragmentStore::TContigPos                 TContigPos;
+    typedef typename TFragmentStore::TAnnotationStore           TAnnotationStore;
+    typedef typename Value<TAnnotationStore>::Type              TAnnotation;
+    typedef typename TAnnotation::TId                           TAnnoId;
+    typedef typename TFragmentStore::TAlignedReadStore          TAlignedReadStore;
+    typedef typename Value<TAlignedReadStore>::Type             TAlignedRead;
+    typedef typename TAlignedRead::TId                          TContigId;
+    typedef typename Size<TAlignedReadStore>::Type              TSize;
+    typedef ImplicitIntervalTree<TContigPos, TAnnoId>           TTree;
+    typedef IntervalAndCargo<TContigPos, TAnnoId>               TInterval;
+    typedef Pair<TSize>                                         TChunk;
+    typedef StringSet<String<TAnnoId>, Owner<ConcatDirect<> > > THits;
+
+    TAnnotationStore const & annotationStore = store.annotationStore;
+    TAlignedReadStore const & alignedReadStore = store.alignedReadStore;
+
+    // Collect the annotation intervals of each contig, regardless of their strand.
+    String<String<TInterval> > contigIntervals;
+    for (TAnnoId id = 0; id < (TAnnoId)length(annotationStore); ++id)
+    {
+        TAnnotation const & anno = annotationStore[id];
+        if (anno.contigId == TAnnotation::INVALID_ID || anno.beginPos == TAnnotation::INVALID_POS)
+            continue;
+        if (length(contigIntervals) <= anno.contigId)
+            resize(contigIntervals, anno.contigId + 1, Generous());
+        appendValue(contigIntervals[anno.contigId],
+                    TInterval(std::min(anno.beginPos, anno.endPos), std::max(anno.beginPos, anno.endPos), id),
+                    Generous());
+    }
+
+    String<TTree> trees;
+    resize(trees, length(contigIntervals), Exact());
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int contigId = 0; contigId < (int)length(trees); ++contigId)
+    {
+        createIntervalTree(trees[contigId], contigIntervals[contigId]);
+        clear(contigIntervals[contigId]);
+    }
+
+    // Order the alignments on contigs with annotations by contig and position.  Stores sorted by sortAlignedReads()
+    // are usually in this order already.
+    String<TSize> order;
+    reserve(order, length(alignedReadStore), Exact());
+    for (TSize i = 0; i < length(alignedReadStore); ++i)
+        if (alignedReadStore[i].contigId < (TContigId)length(trees))
+            appendValue(order, i);
+
+    AlignedReadContigPosLess_<TAlignedReadStore> less(alignedReadStore);
+    bool sorted = true;
+    for (TSize i = 1; i < length(order) && sorted; ++i)
+        sorted = !less(order[i], order[i - 1]);
+    if (!sorted)
+        std::sort(begin(order, Standard()), end(order, Standard()), less);
+
+    // Partition the alignments into chunks within one contig, several per thread to balance the load.
+    TSize chunkSize = std::max((TSize)4096, (TSize)(length(order) / (16 * omp_get_max_threads()) + 1));
+    String<TChunk> chunks;
+    for (TSize i = 0; i < length(order);)
+    {
+        TContigId contigId = alignedReadStore[order[i]].contigId;
+        TSize j = i + 1;
+        while (j < length(order) && j - i < chunkSize && alignedReadStore[order[j]].contigId == contigId)
+            ++j;
+        appendValue(chunks, TChunk(i, j));
+        i = j;
+    }
+
+    delegate.init(length(chunks));
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int chunk = 0; chunk < (int)length(chunks); ++chunk)
+    {
+        TChunk const & range = chunks[chunk];
+        String<TContigPos> queryBegins;
+        String<TContigPos> queryEnds;
+        reserve(queryBegins, range.i2 - range.i1, Exact());
+        reserve(queryEnds, range.i2 - range.i1, Exact());
+        for (TSize i = range.i1; i < range.i2; ++i)
+        {
+            TAlignedRead const & align = alignedReadStore[order[i]];
+            appendValue(queryBegins, std::min(align.beginPos, align.endPos));
+            appendValue(queryEnds, std::max(align.beginPos, align.endPos));
+        }
+
+        THits hits;
+        findIntervals(trees[alignedReadStore[order[range.i1]].contigId], queryBegins, queryEnds, hits);
+        for (TSize i = range.i1; i < range.i2; ++i)
+            delegate(chunk, order[i], hits[i - range.i1]);
+    }
+}
+
+/*!
+ * @fn FragmentStore#findAnnotationOverlaps
+ * @brief Join the aligned reads with the annotations they overlap.
+ *
+ * @signature void findAnnotationOverlaps(pairs, store);
+ *
+ * @param[out] pairs A @link String @endlink of @link Pair @endlink objects.  Each pair consists of a position in
+ *                   the @link FragmentStore::alignedReadStore @endlink and the id of an annotation in the
+ *                   @link FragmentStore::annotationStore @endlink that overlaps the alignment.
+ * @param[in]  store The FragmentStore.
+ *
+ * Alignments and annotations overlap if they share at least one position on the same contig, regardless of
+ * their strands.  The alignments are partitioned by contig and position and the partitions are joined in parallel
+ * by a sweep over their alignments and the annotations of the contig.  The pairs are ordered by the contig and
+ * left-most position of the alignment and then by the left-most position of the annotation.
+ *
+ * @fn FragmentStore#countAnnotationOverlaps
+ * @brief Count the aligned reads that overlap each annotation.
+ *
+ * @signature void countAnnotationOverlaps(counts, store);
+ *
+ * @param[out] counts A @link String @endlink with the number of overlapping alignments for each annotation.
+ * @param[in]  store  The FragmentStore.
+ *
+ * See @link FragmentStore#findAnnotationOverlaps @endlink for details.
+ */
+
+/**
+.Function.findAnnotationOverlaps
+..class:Class.FragmentStore
+..summary:Join the aligned reads with the annotations they overlap.
+..cat:Fragment Store
+..signature:findAnnotationOverlaps(pairs, store)
+..param.pairs:A string of pairs of an alignment position in the @Memvar.FragmentStore#alignedReadStore@ and the id of an overlapping annotation.
+...type:Class.String
+..param.store:The fragment store.
+...type:Class.FragmentStore
+..remarks:Alignments and annotations overlap if they share at least one position on the same contig, regardless of their strands.
+The alignments are partitioned by contig and position and the partitions are joined in parallel.
+The pairs are ordered by contig and left-most position of the alignment and then by left-most position of the annotation.
+..see:Function.countAnnotationOverlaps
+..include:seqan/store.h
+
+.Function.countAnnotationOverlaps
+..class:Class.FragmentStore
+..summary:Count the aligned reads that overlap each annotation.
+..cat:Fragment Store
+..signature:countAnnotationOverlaps(counts, store)
+..param.counts:A string with the number of overlapping alignments for each annotation id.
+...type:Class.String
+..param.store:The fragment store.
+...type:Class.FragmentStore
+..see:Function.findAnnotationOverlaps
+..include:seqan/store.h
+*/
+
+template <typename TAlignId, typename TAnnoId, typename TPairSpec, typename TStringSpec, typename TSpec, typename TConfig>
+inline void
+findAnnotationOverlaps(String<Pair<TAlignId, TAnnoId, TPairSpec>, TStringSpec> & pairs,
+                       FragmentStore<TSpec, TConfig> const & store)
+{
+    typedef Pair<TAlignId, TAnnoId, TPairSpec> TPair;
+
+    AnnotationOverlapPairs_<TPair> delegate;
+    _joinAnnotationOverlaps(store, delegate);
+
+    // Concatenate the chunk results in parallel.
+    String<__uint64> offsets;
+    resize(offsets, length(delegate.chunkPairs) + 1, Exact());
+    offsets[0] = 0;
+    for (unsigned chunk = 0; chunk < length(delegate.chunkPairs); ++chunk)
+        offsets[chunk + 1] = offsets[chunk] + length(delegate.chunkPairs[chunk]);
+
+    clear(pairs);
+    resize(pairs, back(offsets), Exact());
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int chunk = 0; chunk < (int)length(delegate.chunkPairs); ++chunk)
+        for (unsigned i = 0; i < length(delegate.chunkPairs[chunk]); ++i)
+            pairs[offsets[chunk] + i] = delegate.chunkPairs[chunk][i];
+}
+
+template <typename TCount, typename TSpec, typename TConfig>
+inline void
+countAnnotationOverlaps(String<TCount> & counts, FragmentStore<TSpec, TConfig> const & store)
+{
+    clear(counts);
+    resize(counts, length(store.annotationStore), 0, Exact());
+
+    AnnotationOverlapCounts_<TCount> delegate(counts);
+    _joinAnnotationOverlaps(store, delegate);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -0,0 +1,445 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Loading the alignments of a genomic window from an indexed BAM file.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_STORE_IO_BAM_REGION_H
+#define SEQAN_HEADER_STORE_IO_BAM_REGION_H
+
+#if SEQAN_HAS_ZLIB
+
+namespace SEQAN_NAMESPACE_MAIN
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class FragStoreRegionLoader
+// ----------------------------------------------------------------------------
+
+/*!
+ * @class FragStoreRegionLoader
+ * @headerfile <seqan/store.h>
+ * @brief Loads the alignments of a genomic window from an indexed BAM file into a FragmentStore.
+ *
+ * @signature template <typename TFragmentStore>
+ *            class FragStoreRegionLoader;
+ *
+ * @tparam TFragmentStore The type of the FragmentStore to fill.
+ *
+ * The loader owns the reads, mate-pairs and alignments of the store.  Each call of @link
+ * FragStoreRegionLoader#loadRegion @endlink leaves exactly the alignments overlapping the requested window in the
+ * store, together with the reads they refer to.  Alignments and reads that are no longer needed are evicted, so
+ * whole-genome data sets can be processed in memory bounded by the window size.  Windows that move forward on the
+ * same reference only read the BAM records that start behind the previous window.
+ *
+ * The contigs should be loaded before the loader is constructed.
+ *
+ * @section Examples
+ *
+ * @code{.cpp}
+ * FragmentStore<> store;
+ * loadContigs(store, "ref.fa");
+ *
+ * BamStream bamIO("reads.bam");
+ * BamIndex<Bai> baiIndex;
+ * read(baiIndex, "reads.bam.bai");
+ *
+ * FragStoreRegionLoader<FragmentStore<> > loader(store, bamIO, baiIndex);
+ * for (__int32 pos = 0; pos < 1000000; pos += 10000)
+ *     if (loadRegion(loader, 0, pos, pos + 10000))
+ *         processWindow(store);
+ * @endcode
+ */
+
+/*!
+ * @fn FragStoreRegionLoader::FragStoreRegionLoader
+ * @brief Constructor.
+ *
+ * @signature FragStoreRegionLoader::FragStoreRegionLoader(store, bamIO, index[, importFlags]);
+ *
+ * @param[in,out] store       The FragmentStore to fill.
+ * @param[in,out] bamIO       The @link BamStream @endlink to read from, opened on a coordinate-sorted BAM file.
+ * @param[in]     index       The @link BamIndex @endlink of the BAM file.
+ * @param[in]     importFlags The FragStoreImportFlags to use.  Reads and alignments are always imported.
+ */
+
+/**
+.Class.FragStoreRegionLoader
+..cat:Fragment Store
+..summary:Loads the alignments of a genomic window from an indexed BAM file into a fragment store.
+..signature:FragStoreRegionLoader<TFragmentStore>
+..param.TFragmentStore:The type of the fragment store to fill.
+...type:Class.FragmentStore
+..remarks:The loader owns the reads, mate-pairs and alignments of the store.
+Each call of @Function.FragStoreRegionLoader#loadRegion@ leaves exactly the alignments overlapping the requested window in the store, together with the reads they refer to.
+Alignments and reads that are no longer needed are evicted, so whole-genome data sets can be processed in memory bounded by the window size.
+Windows that move forward on the same reference only read the BAM records that start behind the previous window.
+..remarks:The contigs should be loaded before the loader is constructed.
+..include:seqan/store.h
+
+.Memfunc.FragStoreRegionLoader#FragStoreRegionLoader
+..class:Class.FragStoreRegionLoader
+..summary:Constructor.
+..signature:FragStoreRegionLoader(store, bamIO, index[, importFlags])
+..param.store:The fragment store to fill.
+...type:Class.FragmentStore
+..param.bamIO:The BAM stream to read from, opened on a coordinate-sorted BAM file.
+...type:Class.BamStream
+..param.index:The index of the BAM file.
+...type:Class.BamIndex
+..param.importFlags:The import flags to use. Reads and alignments are always imported.
+*/
+
+template <typename TFragmentStore>
+class FragStoreRegionLoader
+{
+public:
+    typedef typename Id<TFragmentStore>::Type                                   TId;
+    typedef typename TFragmentStore::TContigPos                                 TContigPos;
+    typedef typename Value<typename TFragmentStore::TAlignedReadStore>::Type    TAlignedRead;
+    typedef typename TAlignedRead::TGapAnchors                                  TReadGapAnchors;
+    typedef StringSet<TReadGapAnchors, Owner<ConcatDirect<> > >                 TReadAnchorGaps;
+    typedef StringSet<String<typename TFragmentStore::TContigGapAnchor>, Owner<ConcatDirect<> > > TContigAnchorGaps;
+    typedef MatchMateInfo_<TContigPos, TId>                                     TMatchMateInfo;
+
+    TFragmentStore *        store;
+    BamStream *             bamIO;
+    BamIndex<Bai> const *   index;
+    FragStoreImportFlags    importFlags;
+
+    // The current window [beginPos, endPos) on the BAM reference rID and the corresponding contig.
+    __int32                 rID;
+    __int32                 beginPos;
+    __int32                 endPos;
+    TId                     contigId;
+
+    // The pairwise alignments of the aligned reads in the store, indexed by alignment id.  The store holds them
+    // converted into a multiple alignment of the window, which is rebuilt after each window change.
+    String<Pair<__int32> >      recordRanges;
+    String<Pair<TContigPos> >   pairwisePos;
+    TReadAnchorGaps             readAnchorGaps;
+    TContigAnchorGaps           contigAnchorGaps;
+    String<TMatchMateInfo>      matchMateInfos;
+
+    FragStoreSAMContext<TFragmentStore> contextSAM;
+
+    FragStoreRegionLoader(TFragmentStore & _store, BamStream & _bamIO, BamIndex<Bai> const & _index,
+                          FragStoreImportFlags const & _importFlags = FragStoreImportFlags()) :
+        store(&_store), bamIO(&_bamIO), index(&_index), importFlags(_importFlags),
+        rID(BamAlignmentRecord::INVALID_REFID), beginPos(0), endPos(0), contigId(TAlignedRead::INVALID_ID)
+    {
+        importFlags.importRead = true;
+        importFlags.importReadAlignment = true;
+        refresh(_store.contigNameStoreCache);
+        refresh(_store.readNameStoreCache);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _evictRegion()
+// ----------------------------------------------------------------------------
+
+// Keep only the alignments on contigId that overlap [beginPos, endPos) and the reads and mate-pairs they refer to.
+// The kept alignments and reads are renumbered in their current order and get back their pairwise alignments.
+template <typename TFragmentStore, typename TId>
+inline void
+_evictRegion(FragStoreRegionLoader<TFragmentStore> & loader, TId contigId, __int32 beginPos, __int32 endPos)
+{
+    typedef FragStoreRegionLoader<TFragmentStore>                           TLoader;
+    typedef typename TLoader::TAlignedRead                                  TAlignedRead;
+    typedef typename TLoader::TMatchMateInfo                                TMatchMateInfo;
+    typedef typename Value<typename TFragmentStore::TReadStore>::Type       TRead;
+    typedef typename Value<typename TFragmentStore::TMatePairStore>::Type   TMatePair;
+    typedef typename Size<typename TFragmentStore::TAlignedReadStore>::Type TSize;
+
+    TFragmentStore & store = *loader.store;
+    TId const INVALID_ID = TAlignedRead::INVALID_ID;
+
+    String<TId> alignMap;
+    String<TId> readMap;
+    String<TId> matePairMap;
+    resize(alignMap, length(store.alignedReadStore), INVALID_ID, Exact());
+    resize(readMap, length(store.readStore), INVALID_ID, Exact());
+    resize(matePairMap, length(store.matePairStore), INVALID_ID, Exact());
+
+    // Select the alignments to keep, mark their reads and mate-pairs.
+    TSize numAligns = 0;
+    for (TSize i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        TAlignedRead const & align = store.alignedReadStore[i];
+        Pair<__int32> const & range = loader.recordRanges[align.id];
+        if (align.contigId != contigId || range.i1 >= endPos || range.i2 <= beginPos)
+            continue;
+        alignMap[align.id] = numAligns++;
+        readMap[align.readId] = 0;
+        if (store.readStore[align.readId].matePairId != INVALID_ID)
+            matePairMap[store.readStore[align.readId].matePairId] = 0;
+    }
+
+    TSize numReads = 0;
+    for (TSize i = 0; i < length(readMap); ++i)
+        if (readMap[i] != INVALID_ID)
+            readMap[i] = numReads++;
+    TSize numMatePairs = 0;
+    for (TSize i = 0; i < length(matePairMap); ++i)
+        if (matePairMap[i] != INVALID_ID)
+            matePairMap[i] = numMatePairs++;
+
+    // Compact the reads and mate-pairs, both keep their order so this can be done in-place.
+    typename TFragmentStore::TReadSeqStore readSeqStore;
+    typename TFragmentStore::TReadNameStore readNameStore;
+    for (TSize i = 0; i < length(readMap); ++i)
+    {
+        if (readMap[i] == INVALID_ID)
+            continue;
+        TRead read = store.readStore[i];
+        if (read.matePairId != INVALID_ID)
+            read.matePairId = matePairMap[read.matePairId];
+        store.readStore[readMap[i]] = read;
+        appendValue(readSeqStore, store.readSeqStore[i]);
+        appendValue(readNameStore, store.readNameStore[i]);
+    }
+    resize(store.readStore, numReads);
+    swap(store.readSeqStore, readSeqStore);
+    swap(store.readNameStore, readNameStore);
+    refresh(store.readNameStoreCache);
+
+    for (TSize i = 0; i < length(matePairMap); ++i)
+    {
+        if (matePairMap[i] == INVALID_ID)
+            continue;
+        TMatePair matePair = store.matePairStore[i];
+        for (unsigned j = 0; j < 2; ++j)
+            if (matePair.readId[j] != INVALID_ID)
+                matePair.readId[j] = readMap[matePair.readId[j]];
+        store.matePairStore[matePairMap[i]] = matePair;
+    }
+    resize(store.matePairStore, numMatePairs);
+
+    // Compact the alignments and the per-alignment stores and restore the pairwise alignments.
+    typename TFragmentStore::TAlignQualityStore alignQualityStore;
+    typename TFragmentStore::TAlignedReadTagStore alignedReadTagStore;
+    String<Pair<__int32> > recordRanges;
+    String<Pair<typename TLoader::TContigPos> > pairwisePos;
+    typename TLoader::TReadAnchorGaps readAnchorGaps;
+    typename TLoader::TContigAnchorGaps contigAnchorGaps;
+    numAligns = 0;
+    for (TSize i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        TAlignedRead & align = store.alignedReadStore[i];
+        TId oldId = align.id;
+        if (alignMap[oldId] == INVALID_ID)
+            continue;
+
+        align.id = numAligns;
+        align.readId = readMap[align.readId];
+        align.pairMatchId = INVALID_ID;
+        align.beginPos = loader.pairwisePos[oldId].i1;
+        align.endPos = loader.pairwisePos[oldId].i2;
+        assign(align.gaps, loader.readAnchorGaps[oldId]);
+        if (numAligns != i)
+            store.alignedReadStore[numAligns] = align;
+        ++numAligns;
+
+        if (oldId < length(store.alignQualityStore))
+            appendValue(alignQualityStore, store.alignQualityStore[oldId]);
+        if (oldId < length(store.alignedReadTagStore))
+            appendValue(alignedReadTagStore, store.alignedReadTagStore[oldId]);
+        appendValue(recordRanges, loader.recordRanges[oldId]);
+        appendValue(pairwisePos, loader.pairwisePos[oldId]);
+        appendValue(readAnchorGaps, loader.readAnchorGaps[oldId]);
+        appendValue(contigAnchorGaps, loader.contigAnchorGaps[oldId]);
+    }
+    resize(store.alignedReadStore, numAligns);
+    swap(store.alignQualityStore, alignQualityStore);
+    swap(store.alignedReadTagStore, alignedReadTagStore);
+    swap(loader.recordRanges, recordRanges);
+    swap(loader.pairwisePos, pairwisePos);
+    swap(loader.readAnchorGaps, readAnchorGaps);
+    swap(loader.contigAnchorGaps, contigAnchorGaps);
+
+    // Keep the mate information of the kept alignments to link them with mates in later windows.
+    TSize numInfos = 0;
+    for (TSize i = 0; i < length(loader.matchMateInfos); ++i)
+    {
+        TMatchMateInfo info = loader.matchMateInfos[i];
+        if (alignMap[info.pairMatchId] == INVALID_ID)
+            continue;
+        info.pairMatchId = alignMap[info.pairMatchId];
+        info.readId = readMap[info.readId];
+        if (info.matePairId != INVALID_ID)
+            info.matePairId = matePairMap[info.matePairId];
+        loader.matchMateInfos[numInfos++] = info;
+    }
+    resize(loader.matchMateInfos, numInfos);
+}
+
+// ----------------------------------------------------------------------------
+// Function loadRegion()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FragStoreRegionLoader#loadRegion
+ * @brief Load the alignments overlapping a genomic window.
+ *
+ * @signature bool loadRegion(loader, rID, beginPos, endPos);
+ *
+ * @param[in,out] loader   The FragStoreRegionLoader to use.
+ * @param[in]     rID      The id of the reference in the BAM file.  Type: <tt>__int32</tt>.
+ * @param[in]     beginPos The begin of the window on the reference.  Type: <tt>__int32</tt>.
+ * @param[in]     endPos   The end of the window on the reference, exclusive.  Type: <tt>__int32</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> if the window is invalid or reading failed.
+ *
+ * Afterwards, the store contains the alignments overlapping <tt>[beginPos, endPos)</tt> as a multiple alignment of
+ * the window, the reads they refer to and their mate-pairs.  Only mates within the window are linked.
+ */
+
+/**
+.Function.FragStoreRegionLoader#loadRegion
+..class:Class.FragStoreRegionLoader
+..cat:Fragment Store
+..summary:Load the alignments overlapping a genomic window.
+..signature:loadRegion(loader, rID, beginPos, endPos)
+..param.loader:The region loader to use.
+...type:Class.FragStoreRegionLoader
+..param.rID:The id of the reference in the BAM file.
+...type:nolink:$__int32$
+..param.beginPos:The begin of the window on the reference.
+...type:nolink:$__int32$
+..param.endPos:The end of the window on the reference, exclusive.
+...type:nolink:$__int32$
+..returns:$true$ on success, $false$ if the window is invalid or reading failed.
+..remarks:Afterwards, the store contains the alignments overlapping $[beginPos, endPos)$ as a multiple alignment of the window, the reads they refer to and their mate-pairs.
+Only mates within the window are linked.
+..include:seqan/store.h
+*/
+
+template <typename TFragmentStore>
+inline bool
+loadRegion(FragStoreRegionLoader<TFragmentStore> & loader, __int32 rID, __int32 beginPos, __int32 endPos)
+{
+    typedef FragStoreRegionLoader<TFragmentStore>                           TLoader;
+    typedef typename TLoader::TId                                           TId;
+    typedef typename TLoader::TAlignedRead                                  TAlignedRead;
+    typedef typename TLoader::TContigPos                                    TContigPos;
+    typedef typename Size<typename TFragmentStore::TAlignedReadStore>::Type TSize;
+
+    TFragmentStore & store = *loader.store;
+    BamIOContext<StringSet<CharString> > & bamIOContext = loader.bamIO->bamIOContext;
+
+    if (rID < 0 || rID >= (__int32)length(nameStore(bamIOContext)) || beginPos >= endPos)
+        return false;
+    bool hasAlignments = false;
+    if (!jumpToRegion(*loader.bamIO, hasAlignments, rID, beginPos, endPos, *loader.index))
+        return false;
+
+    // If the window moves forward on the same reference, the records starting before the end of the previous
+    // window overlap both windows and are already in the store.  Otherwise, the store is refilled.
+    bool forward = (rID == loader.rID && beginPos >= loader.beginPos);
+    __int32 loadedEnd = forward ? loader.endPos : MinValue<__int32>::VALUE;
+
+    TId contigId = 0;
+    _storeAppendContig(store, contigId, nameStore(bamIOContext)[rID]);
+    if (loader.contigId != TAlignedRead::INVALID_ID)
+        clear(store.contigStore[loader.contigId].gaps);
+    clear(store.contigStore[contigId].gaps);
+    _evictRegion(loader, forward ? contigId : (TId)TAlignedRead::INVALID_ID, beginPos, endPos);
+
+    loader.rID = rID;
+    loader.beginPos = beginPos;
+    loader.endPos = endPos;
+    loader.contigId = contigId;
+
+    // Append the new records overlapping the window.
+    bool result = true;
+    BamAlignmentRecord & record = loader.contextSAM.bamRecord;
+    while (hasAlignments && !atEnd(*loader.bamIO))
+    {
+        if (readRecord(record, *loader.bamIO) != 0)
+        {
+            result = false;
+            break;
+        }
+        if (record.rID != rID || record.beginPos >= endPos)
+            break;
+        __int32 recordEnd = record.beginPos + _max((__int32)getAlignmentLengthInRef(record), (__int32)1);
+        if (record.beginPos < loadedEnd || recordEnd <= beginPos || empty(record.cigar))
+            continue;
+
+        TSize numAligns = length(store.alignedReadStore);
+        _importOneAlignment(bamIOContext, store, loader.contigAnchorGaps, loader.matchMateInfos, loader.contextSAM,
+                            loader.importFlags);
+        if (length(store.alignedReadStore) == numAligns)
+            continue;
+
+        TAlignedRead const & align = back(store.alignedReadStore);
+        appendValue(loader.recordRanges, Pair<__int32>(record.beginPos, recordEnd));
+        appendValue(loader.pairwisePos, Pair<TContigPos>(align.beginPos, align.endPos));
+        appendValue(loader.readAnchorGaps, align.gaps);
+    }
+    // After a read error the next window is loaded from scratch.
+    if (!result)
+        loader.rID = BamAlignmentRecord::INVALID_REFID;
+
+    // Link the mates and convert the pairwise alignments into a multiple alignment of the window.  The alignment ids
+    // are their positions at this point.
+    for (TSize i = 0; i < length(loader.matchMateInfos); ++i)
+        store.alignedReadStore[loader.matchMateInfos[i].pairMatchId].pairMatchId = loader.matchMateInfos[i].pairMatchId;
+    _generatePairMatchIds(store, loader.matchMateInfos);
+    convertPairWiseToGlobalAlignment(store, loader.contigAnchorGaps);
+
+    return result;
+}
+
+}  // namespace SEQAN_NAMESPACE_MAIN
+
+#endif  // #if SEQAN_HAS_ZLIB
+
+#endif  // #ifndef SEQAN_HEADER_STORE_IO_BAM_REGION_H
@@ -651,30 +651,26 @@ namespace SEQAN_NAMESPACE_MAIN
     }
 
 //////////////////////////////////////////////////////////////////////////////
-// _readOneAlignment
+// _importOneAlignment
 //
-// reads in one alignement section from a Sam file
+// imports the BamAlignmentRecord in contextSAM.bamRecord into the fragment store
     
     template <
-        typename TStreamOrReader,
         typename TNameStore,
         typename TNameStoreCache,
         typename TSpec,
         typename TConfig,
         typename TContigAnchorGaps,
         typename TMatchMateInfos,
-        typename TFragStore,
-        typename TTag>
+        typename TFragStore>
     inline void
-    _readOneAlignment(
-        TStreamOrReader & streamOrReader,
+    _importOneAlignment(
         BamIOContext<TNameStore, TNameStoreCache> & bamIOContext,
         FragmentStore<TSpec, TConfig> & fragStore,
         TContigAnchorGaps & contigAnchorGaps,
         TMatchMateInfos & matchMateInfos,
         FragStoreSAMContext<TFragStore> & contextSAM,
-        FragStoreImportFlags const & importFlags,
-        TTag const & tag)
+        FragStoreImportFlags const & importFlags)
     {
         // Basic types
         typedef FragmentStore<TSpec, TConfig>                                       TFragmentStore;
@@ -699,12 +695,7 @@ namespace SEQAN_NAMESPACE_MAIN
         // Type to temporarily store information about match mates
         typedef typename Value<TMatchMateInfos>::Type                               TMatchMateInfo;
 
-        // Read next BamAlignmentRecord and get shortcut.
-        if (readRecord(contextSAM.bamRecord, bamIOContext, streamOrReader, tag) != 0)
-        {
-            std::cerr << "ERROR: Problem reading SAM/BAM record.\n";
-            return;
-        }
+        // Get shortcut to the current BamAlignmentRecord.
         BamAlignmentRecord & record = contextSAM.bamRecord;
 
         // Get element of align quality store.
@@ -837,6 +828,41 @@ namespace SEQAN_NAMESPACE_MAIN
         }
     }
 
+//////////////////////////////////////////////////////////////////////////////
+// _readOneAlignment
+//
+// reads in one alignement section from a Sam file
+    
+    template <
+        typename TStreamOrReader,
+        typename TNameStore,
+        typename TNameStoreCache,
+        typename TSpec,
+        typename TConfig,
+        typename TContigAnchorGaps,
+        typename TMatchMateInfos,
+        typename TFragStore,
+        typename TTag>
+    inline void
+    _readOneAlignment(
+        TStreamOrReader & streamOrReader,
+        BamIOContext<TNameStore, TNameStoreCache> & bamIOContext,
+        FragmentStore<TSpec, TConfig> & fragStore,
+        TContigAnchorGaps & contigAnchorGaps,
+        TMatchMateInfos & matchMateInfos,
+        FragStoreSAMContext<TFragStore> & contextSAM,
+        FragStoreImportFlags const & importFlags,
+        TTag const & tag)
+    {
+        // Read next BamAlignmentRecord.
+        if (readRecord(contextSAM.bamRecord, bamIOContext, streamOrReader, tag) != 0)
+        {
+            std::cerr << "ERROR: Problem reading SAM/BAM record.\n";
+            return;
+        }
+        _importOneAlignment(bamIOContext, fragStore, contigAnchorGaps, matchMateInfos, contextSAM, importFlags);
+    }
+
 
 //////////////////////////////////////////////////////////////////////////////
 // write functions for Sam
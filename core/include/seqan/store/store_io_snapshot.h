@@ -0,0 +1,754 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Binary snapshots of a FragmentStore, one memory-mappable file per column.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_STORE_IO_SNAPSHOT_H
+#define SEQAN_HEADER_STORE_IO_SNAPSHOT_H
+
+namespace SEQAN_NAMESPACE_MAIN
+{
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Snapshot rows
+// ----------------------------------------------------------------------------
+
+// The members of the store elements that are neither strings nor runtime state are written as fixed-size rows.
+// Strings members (gaps, sequences, annotation values) are written as separate concatenation and limits files.
+
+template <typename TId, typename TPos>
+struct ContigSnapshotRow_
+{
+    TId     fileId;
+    TPos    fileBeginPos;
+    TPos    fileEndPos;
+};
+
+template <typename TId>
+struct ContigFileSnapshotRow_
+{
+    __int64 format;
+    TId     firstContigId;
+};
+
+template <typename TId, typename TPos>
+struct AlignedReadSnapshotRow_
+{
+    TId     id;
+    TId     readId;
+    TId     contigId;
+    TId     pairMatchId;
+    TPos    beginPos;
+    TPos    endPos;
+};
+
+template <typename TId, typename TPos>
+struct AnnotationSnapshotRow_
+{
+    TId     parentId;
+    TId     contigId;
+    TId     countId;
+    TId     typeId;
+    TPos    beginPos;
+    TPos    endPos;
+    TId     lastChildId;
+    TId     nextSiblingId;
+};
+
+// ----------------------------------------------------------------------------
+// Class SnapshotStrings_
+// ----------------------------------------------------------------------------
+
+// A mapped string column, the i-th string is concat[limits[i], limits[i + 1]).
+template <typename TValue>
+struct SnapshotStrings_
+{
+    String<__uint64, MMap<> > limits;
+    String<TValue, MMap<> > concat;
+};
+
+// ----------------------------------------------------------------------------
+// Snapshot string accessors
+// ----------------------------------------------------------------------------
+
+// Return the i-th string of a column to be written.
+
+template <typename TStrings>
+struct SnapshotElements_
+{
+    TStrings const & strings;
+
+    SnapshotElements_(TStrings const & _strings) : strings(_strings) {}
+
+    inline typename Size<TStrings>::Type size() const
+    {
+        return length(strings);
+    }
+
+    template <typename TPos>
+    inline typename Reference<TStrings const>::Type operator() (TPos i) const
+    {
+        return strings[i];
+    }
+};
+
+template <typename TElements, typename TMember>
+struct SnapshotMembers_
+{
+    TElements const & elements;
+    TMember Value<TElements>::Type::* member;
+
+    SnapshotMembers_(TElements const & _elements, TMember Value<TElements>::Type::* _member) :
+        elements(_elements), member(_member)
+    {}
+
+    inline typename Size<TElements>::Type size() const
+    {
+        return length(elements);
+    }
+
+    template <typename TPos>
+    inline TMember const & operator() (TPos i) const
+    {
+        return elements[i].*member;
+    }
+};
+
+template <typename TAnnotationStore>
+struct SnapshotAnnotationValues_
+{
+    typedef typename Value<TAnnotationStore>::Type::TValues TValues;
+
+    TAnnotationStore const & annotationStore;
+
+    SnapshotAnnotationValues_(TAnnotationStore const & _annotationStore) : annotationStore(_annotationStore) {}
+
+    inline typename Size<TAnnotationStore>::Type size() const
+    {
+        return length(annotationStore);
+    }
+
+    template <typename TPos>
+    inline typename Concatenator<TValues>::Type const & operator() (TPos i) const
+    {
+        return annotationStore[i].values.concat;
+    }
+};
+
+template <typename TAnnotationStore>
+struct SnapshotAnnotationValueLimits_
+{
+    typedef typename Value<TAnnotationStore>::Type::TValues TValues;
+
+    TAnnotationStore const & annotationStore;
+
+    SnapshotAnnotationValueLimits_(TAnnotationStore const & _annotationStore) : annotationStore(_annotationStore) {}
+
+    inline typename Size<TAnnotationStore>::Type size() const
+    {
+        return length(annotationStore);
+    }
+
+    template <typename TPos>
+    inline typename StringSetLimits<TValues>::Type const & operator() (TPos i) const
+    {
+        return annotationStore[i].values.limits;
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _fragmentStoreSnapshotInfo()
+// ----------------------------------------------------------------------------
+
+// The info file identifies the layout version and the sizes of all raw values, so that snapshots of stores with
+// another configuration or from another platform are rejected instead of misread.
+template <typename TSpec, typename TConfig>
+inline void
+_fragmentStoreSnapshotInfo(String<__uint64> & info, FragmentStore<TSpec, TConfig> const & /*store*/)
+{
+    typedef FragmentStore<TSpec, TConfig>                               TFragmentStore;
+    typedef typename Value<typename TFragmentStore::TContigStore>::Type TContig;
+    typedef typename Value<typename TFragmentStore::TAlignedReadStore>::Type TAlignedRead;
+    typedef typename TFragmentStore::TAnnotationStoreElement            TAnnotation;
+    typedef typename Value<typename TFragmentStore::TContigFileStore>::Type TContigFile;
+
+    clear(info);
+    appendValue(info, 0x31534653414e4553ull);  // "SEQANFS1"
+    appendValue(info, 1u);                      // layout version
+    appendValue(info, sizeof(typename Value<typename TFragmentStore::TReadStore>::Type));
+    appendValue(info, sizeof(typename Value<typename TFragmentStore::TMatePairStore>::Type));
+    appendValue(info, sizeof(typename Value<typename TFragmentStore::TLibraryStore>::Type));
+    appendValue(info, sizeof(typename Value<typename TFragmentStore::TAlignQualityStore>::Type));
+    appendValue(info, sizeof(ContigSnapshotRow_<typename TContig::TId, typename TContig::TPos>));
+    appendValue(info, sizeof(ContigFileSnapshotRow_<typename TContigFile::TId>));
+    appendValue(info, sizeof(AlignedReadSnapshotRow_<typename TAlignedRead::TId, typename TAlignedRead::TPos>));
+    appendValue(info, sizeof(AnnotationSnapshotRow_<typename TAnnotation::TId, typename TAnnotation::TPos>));
+    appendValue(info, sizeof(typename Value<typename TFragmentStore::TReadSeq>::Type));
+    appendValue(info, sizeof(typename Value<typename TFragmentStore::TContigSeq>::Type));
+    appendValue(info, sizeof(typename Value<typename TContig::TGapAnchors>::Type));
+    appendValue(info, sizeof(typename Value<typename TAlignedRead::TGapAnchors>::Type));
+    appendValue(info, sizeof(typename Value<typename StringSetLimits<typename TAnnotation::TValues>::Type>::Type));
+}
+
+// ----------------------------------------------------------------------------
+// Function _saveSnapshotColumn()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+inline bool
+_saveSnapshotColumn(String<TValue, TSpec> const & column, CharString const & fileName)
+{
+    String<TValue, MMap<> > file;
+    if (!open(file, toCString(fileName), OPEN_RDWR | OPEN_CREATE))
+        return false;
+    resize(file, length(column), Exact());
+    std::copy(begin(column, Standard()), end(column, Standard()), begin(file, Standard()));
+    return close(file);
+}
+
+// ----------------------------------------------------------------------------
+// Function _saveSnapshotStrings()
+// ----------------------------------------------------------------------------
+
+// Writes the strings of a column into <fileName>.concat and their limits into <fileName>.limits.
+template <typename TValue, typename TAccessor>
+inline bool
+_saveSnapshotStrings(TAccessor const & strings, CharString const & fileName)
+{
+    typedef typename Iterator<String<TValue, MMap<> >, Standard>::Type TIter;
+
+    CharString name = fileName;
+    append(name, ".limits");
+    String<__uint64, MMap<> > limits;
+    if (!open(limits, toCString(name), OPEN_RDWR | OPEN_CREATE))
+        return false;
+    resize(limits, strings.size() + 1, Exact());
+    limits[0] = 0;
+    for (__uint64 i = 0; i < strings.size(); ++i)
+        limits[i + 1] = limits[i] + length(strings(i));
+
+    name = fileName;
+    append(name, ".concat");
+    String<TValue, MMap<> > concat;
+    if (!open(concat, toCString(name), OPEN_RDWR | OPEN_CREATE))
+        return false;
+    resize(concat, back(limits), Exact());
+    TIter it = begin(concat, Standard());
+    for (__uint64 i = 0; i < strings.size(); ++i)
+        it = std::copy(begin(strings(i), Standard()), end(strings(i), Standard()), it);
+
+    return close(limits) && close(concat);
+}
+
+// ----------------------------------------------------------------------------
+// Function _openSnapshotColumn()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+inline bool
+_openSnapshotColumn(String<TValue, TSpec> & column, CharString const & fileName)
+{
+    String<TValue, MMap<> > file;
+    if (!open(file, toCString(fileName), OPEN_RDONLY))
+        return false;
+    assign(column, file, Exact());
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _openSnapshotStrings()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline bool
+_openSnapshotStrings(SnapshotStrings_<TValue> & strings, CharString const & fileName)
+{
+    CharString name = fileName;
+    append(name, ".limits");
+    if (!open(strings.limits, toCString(name), OPEN_RDONLY) || empty(strings.limits))
+        return false;
+    name = fileName;
+    append(name, ".concat");
+    if (!open(strings.concat, toCString(name), OPEN_RDONLY))
+        return false;
+    return back(strings.limits) == length(strings.concat);
+}
+
+template <typename TValue, typename TPos>
+inline typename Infix<String<TValue, MMap<> > const>::Type
+_snapshotString(SnapshotStrings_<TValue> const & strings, TPos i)
+{
+    return infix(strings.concat, strings.limits[i], strings.limits[i + 1]);
+}
+
+template <typename TString, typename TSSSpec>
+inline bool
+_openSnapshotStrings(StringSet<TString, TSSSpec> & stringSet, CharString const & fileName)
+{
+    SnapshotStrings_<typename Value<TString>::Type> strings;
+    if (!_openSnapshotStrings(strings, fileName))
+        return false;
+    clear(stringSet);
+    resize(stringSet, length(strings.limits) - 1, Exact());
+    for (unsigned i = 0; i + 1 < length(strings.limits); ++i)
+        assign(stringSet[i], _snapshotString(strings, i));
+    return true;
+}
+
+template <typename TString, typename TSSSpec>
+inline bool
+_openSnapshotStrings(StringSet<TString, Owner<ConcatDirect<TSSSpec> > > & stringSet, CharString const & fileName)
+{
+    SnapshotStrings_<typename Value<TString>::Type> strings;
+    if (!_openSnapshotStrings(strings, fileName))
+        return false;
+    assign(stringSet.concat, strings.concat, Exact());
+    assign(stringSet.limits, strings.limits, Exact());
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function save()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FragmentStore#save
+ * @brief Save a FragmentStore as a binary snapshot.
+ *
+ * @signature bool save(store, fileName);
+ *
+ * @param[in] store    The FragmentStore to save.
+ * @param[in] fileName The prefix of the snapshot files.  Type: <tt>char const *</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> on errors.
+ *
+ * A snapshot consists of one file per column of the store, named <tt>fileName</tt> plus an extension.  Each file is
+ * a plain array of the column values that can be mapped into memory without parsing, strings are stored as a
+ * <tt>.concat</tt> and a <tt>.limits</tt> file.  The file <tt>fileName.info</tt> records the layout version and the
+ * sizes of the values.  The interval tree stores and the contig usage counters are not saved.
+ *
+ * @see FragmentStore#open
+ */
+
+/**
+.Function.FragmentStore#save
+..class:Class.FragmentStore
+..summary:Save a fragment store as a binary snapshot.
+..cat:Fragment Store
+..signature:save(store, fileName)
+..param.store:The fragment store.
+...type:Class.FragmentStore
+..param.fileName:The prefix of the snapshot files.
+..returns:$true$ on success, $false$ on errors.
+..remarks:A snapshot consists of one file per column of the store, named $fileName$ plus an extension.
+Each file is a plain array of the column values that can be mapped into memory without parsing,
+strings are stored as a $.concat$ and a $.limits$ file.
+The file $fileName.info$ records the layout version and the sizes of the values.
+The interval tree stores and the contig usage counters are not saved.
+..see:Function.FragmentStore#open
+..include:seqan/store.h
+*/
+
+template <typename TSpec, typename TConfig>
+inline bool
+save(FragmentStore<TSpec, TConfig> const & store, const char * fileName)
+{
+    typedef FragmentStore<TSpec, TConfig>                               TFragmentStore;
+    typedef typename TFragmentStore::TContigStore                       TContigStore;
+    typedef typename Value<TContigStore>::Type                          TContig;
+    typedef typename TFragmentStore::TContigFileStore                   TContigFileStore;
+    typedef typename Value<TContigFileStore>::Type                      TContigFile;
+    typedef typename TFragmentStore::TAlignedReadStore                  TAlignedReadStore;
+    typedef typename Value<TAlignedReadStore>::Type                     TAlignedRead;
+    typedef typename TFragmentStore::TAnnotationStore                   TAnnotationStore;
+    typedef typename TFragmentStore::TAnnotationStoreElement            TAnnotation;
+    typedef typename TAnnotation::TValues                               TValues;
+    typedef ContigSnapshotRow_<typename TContig::TId, typename TContig::TPos>                   TContigRow;
+    typedef ContigFileSnapshotRow_<typename TContigFile::TId>                                   TContigFileRow;
+    typedef AlignedReadSnapshotRow_<typename TAlignedRead::TId, typename TAlignedRead::TPos>    TAlignedReadRow;
+    typedef AnnotationSnapshotRow_<typename TAnnotation::TId, typename TAnnotation::TPos>       TAnnotationRow;
+
+    CharString prefix = fileName;
+    CharString name;
+    bool result = true;
+
+    String<__uint64> info;
+    _fragmentStoreSnapshotInfo(info, store);
+    name = prefix;  append(name, ".info");
+    result &= _saveSnapshotColumn(info, name);
+
+    // Reads, mate-pairs and libraries.
+    name = prefix;  append(name, ".reads");
+    result &= _saveSnapshotColumn(store.readStore, name);
+    name = prefix;  append(name, ".readseq");
+    result &= _saveSnapshotStrings<typename Value<typename TFragmentStore::TReadSeq>::Type>(
+            SnapshotElements_<typename TFragmentStore::TReadSeqStore>(store.readSeqStore), name);
+    name = prefix;  append(name, ".readname");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TReadNameStore>(store.readNameStore), name);
+    name = prefix;  append(name, ".matepairs");
+    result &= _saveSnapshotColumn(store.matePairStore, name);
+    name = prefix;  append(name, ".matepairname");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TNameStore>(store.matePairNameStore), name);
+    name = prefix;  append(name, ".libs");
+    result &= _saveSnapshotColumn(store.libraryStore, name);
+    name = prefix;  append(name, ".libname");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TNameStore>(store.libraryNameStore), name);
+
+    // Contigs and contig files.
+    String<TContigRow> contigRows;
+    resize(contigRows, length(store.contigStore), Exact());
+    for (unsigned i = 0; i < length(store.contigStore); ++i)
+    {
+        contigRows[i].fileId = store.contigStore[i].fileId;
+        contigRows[i].fileBeginPos = store.contigStore[i].fileBeginPos;
+        contigRows[i].fileEndPos = store.contigStore[i].fileEndPos;
+    }
+    name = prefix;  append(name, ".contigs");
+    result &= _saveSnapshotColumn(contigRows, name);
+    name = prefix;  append(name, ".contigseq");
+    result &= _saveSnapshotStrings<typename Value<typename TFragmentStore::TContigSeq>::Type>(
+            SnapshotMembers_<TContigStore, typename TContig::TContigSeq>(store.contigStore, &TContig::seq), name);
+    name = prefix;  append(name, ".contiggaps");
+    result &= _saveSnapshotStrings<typename Value<typename TContig::TGapAnchors>::Type>(
+            SnapshotMembers_<TContigStore, typename TContig::TGapAnchors>(store.contigStore, &TContig::gaps), name);
+    name = prefix;  append(name, ".contigname");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TNameStore>(store.contigNameStore), name);
+
+    String<TContigFileRow> contigFileRows;
+    resize(contigFileRows, length(store.contigFileStore), Exact());
+    for (unsigned i = 0; i < length(store.contigFileStore); ++i)
+    {
+        contigFileRows[i].format = store.contigFileStore[i].format.tagId;
+        contigFileRows[i].firstContigId = store.contigFileStore[i].firstContigId;
+    }
+    name = prefix;  append(name, ".contigfiles");
+    result &= _saveSnapshotColumn(contigFileRows, name);
+    name = prefix;  append(name, ".contigfilename");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotMembers_<TContigFileStore, CharString>(store.contigFileStore, &TContigFile::fileName), name);
+
+    // Aligned reads.
+    String<TAlignedReadRow> alignRows;
+    resize(alignRows, length(store.alignedReadStore), Exact());
+    for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        TAlignedRead const & align = store.alignedReadStore[i];
+        alignRows[i].id = align.id;
+        alignRows[i].readId = align.readId;
+        alignRows[i].contigId = align.contigId;
+        alignRows[i].pairMatchId = align.pairMatchId;
+        alignRows[i].beginPos = align.beginPos;
+        alignRows[i].endPos = align.endPos;
+    }
+    name = prefix;  append(name, ".aligns");
+    result &= _saveSnapshotColumn(alignRows, name);
+    name = prefix;  append(name, ".aligngaps");
+    result &= _saveSnapshotStrings<typename Value<typename TAlignedRead::TGapAnchors>::Type>(
+            SnapshotMembers_<TAlignedReadStore, typename TAlignedRead::TGapAnchors>(store.alignedReadStore,
+                                                                                    &TAlignedRead::gaps), name);
+    name = prefix;  append(name, ".alignqual");
+    result &= _saveSnapshotColumn(store.alignQualityStore, name);
+    name = prefix;  append(name, ".aligntags");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TAlignedReadTagStore>(store.alignedReadTagStore), name);
+
+    // Annotations.
+    String<TAnnotationRow> annoRows;
+    resize(annoRows, length(store.annotationStore), Exact());
+    for (unsigned i = 0; i < length(store.annotationStore); ++i)
+    {
+        TAnnotation const & anno = store.annotationStore[i];
+        annoRows[i].parentId = anno.parentId;
+        annoRows[i].contigId = anno.contigId;
+        annoRows[i].countId = anno.countId;
+        annoRows[i].typeId = anno.typeId;
+        annoRows[i].beginPos = anno.beginPos;
+        annoRows[i].endPos = anno.endPos;
+        annoRows[i].lastChildId = anno.lastChildId;
+        annoRows[i].nextSiblingId = anno.nextSiblingId;
+    }
+    name = prefix;  append(name, ".annos");
+    result &= _saveSnapshotColumn(annoRows, name);
+    name = prefix;  append(name, ".annovalues");
+    result &= _saveSnapshotStrings<typename Value<typename Concatenator<TValues>::Type>::Type>(
+            SnapshotAnnotationValues_<TAnnotationStore>(store.annotationStore), name);
+    name = prefix;  append(name, ".annovaluelimits");
+    result &= _saveSnapshotStrings<typename Value<typename StringSetLimits<TValues>::Type>::Type>(
+            SnapshotAnnotationValueLimits_<TAnnotationStore>(store.annotationStore), name);
+    name = prefix;  append(name, ".annoname");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TNameStore>(store.annotationNameStore), name);
+    name = prefix;  append(name, ".annotype");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TNameStore>(store.annotationTypeStore), name);
+    name = prefix;  append(name, ".annokey");
+    result &= _saveSnapshotStrings<char>(
+            SnapshotElements_<typename TFragmentStore::TNameStore>(store.annotationKeyStore), name);
+
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function open()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn FragmentStore#open
+ * @brief Load a FragmentStore from a binary snapshot.
+ *
+ * @signature bool open(store, fileName);
+ *
+ * @param[out] store    The FragmentStore to load.  Its previous content is replaced.
+ * @param[in]  fileName The prefix of the snapshot files.  Type: <tt>char const *</tt>.
+ *
+ * @return bool <tt>true</tt> on success, <tt>false</tt> if a file is missing or the snapshot was written with
+ *              another layout version or store configuration.
+ *
+ * The snapshot files are mapped into memory and copied column-wise into the store, nothing is parsed.
+ *
+ * @see FragmentStore#save
+ */
+
+/**
+.Function.FragmentStore#open
+..class:Class.FragmentStore
+..summary:Load a fragment store from a binary snapshot.
+..cat:Fragment Store
+..signature:open(store, fileName)
+..param.store:The fragment store, its previous content is replaced.
+...type:Class.FragmentStore
+..param.fileName:The prefix of the snapshot files.
+..returns:$true$ on success, $false$ if a file is missing or the snapshot was written with another layout version or store configuration.
+..remarks:The snapshot files are mapped into memory and copied column-wise into the store, nothing is parsed.
+..see:Function.FragmentStore#save
+..include:seqan/store.h
+*/
+
+template <typename TSpec, typename TConfig>
+inline bool
+open(FragmentStore<TSpec, TConfig> & store, const char * fileName)
+{
+    typedef FragmentStore<TSpec, TConfig>                               TFragmentStore;
+    typedef typename TFragmentStore::TContigStore                       TContigStore;
+    typedef typename Value<TContigStore>::Type                          TContig;
+    typedef typename TFragmentStore::TContigFileStore                   TContigFileStore;
+    typedef typename Value<TContigFileStore>::Type                      TContigFile;
+    typedef typename TFragmentStore::TAlignedReadStore                  TAlignedReadStore;
+    typedef typename Value<TAlignedReadStore>::Type                     TAlignedRead;
+    typedef typename TFragmentStore::TAnnotationStoreElement            TAnnotation;
+    typedef typename TAnnotation::TValues                               TValues;
+    typedef ContigSnapshotRow_<typename TContig::TId, typename TContig::TPos>                   TContigRow;
+    typedef ContigFileSnapshotRow_<typename TContigFile::TId>                                   TContigFileRow;
+    typedef AlignedReadSnapshotRow_<typename TAlignedRead::TId, typename TAlignedRead::TPos>    TAlignedReadRow;
+    typedef AnnotationSnapshotRow_<typename TAnnotation::TId, typename TAnnotation::TPos>       TAnnotationRow;
+
+    CharString prefix = fileName;
+    CharString name;
+
+    String<__uint64> expectedInfo, info;
+    _fragmentStoreSnapshotInfo(expectedInfo, store);
+    name = prefix;  append(name, ".info");
+    if (!_openSnapshotColumn(info, name) || info != expectedInfo)
+        return false;
+
+    // Reads, mate-pairs and libraries.
+    name = prefix;  append(name, ".reads");
+    if (!_openSnapshotColumn(store.readStore, name))
+        return false;
+    name = prefix;  append(name, ".readseq");
+    if (!_openSnapshotStrings(store.readSeqStore, name))
+        return false;
+    name = prefix;  append(name, ".readname");
+    if (!_openSnapshotStrings(store.readNameStore, name))
+        return false;
+    name = prefix;  append(name, ".matepairs");
+    if (!_openSnapshotColumn(store.matePairStore, name))
+        return false;
+    name = prefix;  append(name, ".matepairname");
+    if (!_openSnapshotStrings(store.matePairNameStore, name))
+        return false;
+    name = prefix;  append(name, ".libs");
+    if (!_openSnapshotColumn(store.libraryStore, name))
+        return false;
+    name = prefix;  append(name, ".libname");
+    if (!_openSnapshotStrings(store.libraryNameStore, name))
+        return false;
+
+    // Contigs and contig files.
+    String<TContigRow> contigRows;
+    SnapshotStrings_<typename Value<typename TFragmentStore::TContigSeq>::Type> contigSeqs;
+    SnapshotStrings_<typename Value<typename TContig::TGapAnchors>::Type> contigGaps;
+    name = prefix;  append(name, ".contigs");
+    if (!_openSnapshotColumn(contigRows, name))
+        return false;
+    name = prefix;  append(name, ".contigseq");
+    if (!_openSnapshotStrings(contigSeqs, name) || length(contigSeqs.limits) != length(contigRows) + 1)
+        return false;
+    name = prefix;  append(name, ".contiggaps");
+    if (!_openSnapshotStrings(contigGaps, name) || length(contigGaps.limits) != length(contigRows) + 1)
+        return false;
+    resize(store.contigStore, length(contigRows), Exact());
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int i = 0; i < (int)length(contigRows); ++i)
+    {
+        TContig & contig = store.contigStore[i];
+        assign(contig.seq, _snapshotString(contigSeqs, i));
+        assign(contig.gaps, _snapshotString(contigGaps, i));
+        contig.fileId = contigRows[i].fileId;
+        contig.fileBeginPos = contigRows[i].fileBeginPos;
+        contig.fileEndPos = contigRows[i].fileEndPos;
+    }
+    name = prefix;  append(name, ".contigname");
+    if (!_openSnapshotStrings(store.contigNameStore, name))
+        return false;
+
+    String<TContigFileRow> contigFileRows;
+    StringSet<CharString> contigFileNames;
+    name = prefix;  append(name, ".contigfiles");
+    if (!_openSnapshotColumn(contigFileRows, name))
+        return false;
+    name = prefix;  append(name, ".contigfilename");
+    if (!_openSnapshotStrings(contigFileNames, name) || length(contigFileNames) != length(contigFileRows))
+        return false;
+    resize(store.contigFileStore, length(contigFileRows), Exact());
+    for (unsigned i = 0; i < length(contigFileRows); ++i)
+    {
+        store.contigFileStore[i].fileName = contigFileNames[i];
+        store.contigFileStore[i].format.tagId = contigFileRows[i].format;
+        store.contigFileStore[i].firstContigId = contigFileRows[i].firstContigId;
+    }
+
+    // Aligned reads.
+    String<TAlignedReadRow, MMap<> > alignRows;
+    SnapshotStrings_<typename Value<typename TAlignedRead::TGapAnchors>::Type> alignGaps;
+    name = prefix;  append(name, ".aligns");
+    if (!open(alignRows, toCString(name), OPEN_RDONLY))
+        return false;
+    name = prefix;  append(name, ".aligngaps");
+    if (!_openSnapshotStrings(alignGaps, name) || length(alignGaps.limits) != length(alignRows) + 1)
+        return false;
+    resize(store.alignedReadStore, length(alignRows), Exact());
+    SEQAN_OMP_PRAGMA(parallel for schedule(static, 4096))
+    for (__int64 i = 0; i < (__int64)length(alignRows); ++i)
+    {
+        TAlignedRead & align = store.alignedReadStore[i];
+        TAlignedReadRow const & row = alignRows[i];
+        align.id = row.id;
+        align.readId = row.readId;
+        align.contigId = row.contigId;
+        align.pairMatchId = row.pairMatchId;
+        align.beginPos = row.beginPos;
+        align.endPos = row.endPos;
+        assign(align.gaps, _snapshotString(alignGaps, i));
+    }
+    name = prefix;  append(name, ".alignqual");
+    if (!_openSnapshotColumn(store.alignQualityStore, name))
+        return false;
+    name = prefix;  append(name, ".aligntags");
+    if (!_openSnapshotStrings(store.alignedReadTagStore, name))
+        return false;
+
+    // Annotations.
+    String<TAnnotationRow> annoRows;
+    SnapshotStrings_<typename Value<typename Concatenator<TValues>::Type>::Type> annoValues;
+    SnapshotStrings_<typename Value<typename StringSetLimits<TValues>::Type>::Type> annoValueLimits;
+    name = prefix;  append(name, ".annos");
+    if (!_openSnapshotColumn(annoRows, name))
+        return false;
+    name = prefix;  append(name, ".annovalues");
+    if (!_openSnapshotStrings(annoValues, name) || length(annoValues.limits) != length(annoRows) + 1)
+        return false;
+    name = prefix;  append(name, ".annovaluelimits");
+    if (!_openSnapshotStrings(annoValueLimits, name) || length(annoValueLimits.limits) != length(annoRows) + 1)
+        return false;
+    resize(store.annotationStore, length(annoRows), Exact());
+    for (unsigned i = 0; i < length(annoRows); ++i)
+    {
+        TAnnotation & anno = store.annotationStore[i];
+        anno.parentId = annoRows[i].parentId;
+        anno.contigId = annoRows[i].contigId;
+        anno.countId = annoRows[i].countId;
+        anno.typeId = annoRows[i].typeId;
+        anno.beginPos = annoRows[i].beginPos;
+        anno.endPos = annoRows[i].endPos;
+        anno.lastChildId = annoRows[i].lastChildId;
+        anno.nextSiblingId = annoRows[i].nextSiblingId;
+        assign(anno.values.concat, _snapshotString(annoValues, i));
+        assign(anno.values.limits, _snapshotString(annoValueLimits, i));
+    }
+    name = prefix;  append(name, ".annoname");
+    if (!_openSnapshotStrings(store.annotationNameStore, name))
+        return false;
+    name = prefix;  append(name, ".annotype");
+    if (!_openSnapshotStrings(store.annotationTypeStore, name))
+        return false;
+    name = prefix;  append(name, ".annokey");
+    if (!_openSnapshotStrings(store.annotationKeyStore, name))
+        return false;
+
+    // The interval trees refer to the previous annotations and are rebuilt on demand.
+    clear(store.intervalTreeStore_F);
+    clear(store.intervalTreeStore_R);
+
+    refresh(store.readNameStoreCache);
+    refresh(store.contigNameStoreCache);
+    refresh(store.annotationNameStoreCache);
+    refresh(store.annotationTypeStoreCache);
+    refresh(store.annotationKeyStoreCache);
+    return true;
+}
+
+}  // namespace SEQAN_NAMESPACE_MAIN
+
+#endif  // #ifndef SEQAN_HEADER_STORE_IO_SNAPSHOT_H
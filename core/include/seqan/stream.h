@@ -120,6 +120,7 @@
 
 #include <seqan/stream/record_reader_base.h>
 #include <seqan/stream/record_reader_single.h>
+#include <seqan/stream/record_reader_single_read_ahead.h>
 #include <seqan/stream/record_reader_single_mmap.h>
 #include <seqan/stream/record_reader_double.h>
 #include <seqan/stream/record_reader_double_mmap.h>
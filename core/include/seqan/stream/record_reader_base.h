@@ -48,6 +48,9 @@ namespace seqan {
 struct StringReader_;
 typedef Tag<StringReader_> StringReader;
 
+struct ReadAhead_;
+typedef Tag<ReadAhead_> ReadAhead;
+
 template <typename TSpec = void>
 struct SinglePass {};
 
@@ -0,0 +1,372 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: Manuel Holtgrewe <manuel.holtgrewe@fu-berlin.de>
+// ==========================================================================
+// Single-Pass Record Reader specialization that reads the next block of the
+// stream in a background thread while the current one is tokenized.
+// ==========================================================================
+
+#ifndef SEQAN_STREAM_RECORD_READER_SINGLE_READ_AHEAD_H_
+#define SEQAN_STREAM_RECORD_READER_SINGLE_READ_AHEAD_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+template <typename TFile>
+class RecordReader<TFile, SinglePass<ReadAhead> >;
+
+template <typename TFile>
+inline bool
+_refillBuffer(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader);
+
+template <typename TFile>
+inline void
+_readAheadBlock(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader);
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// Worker of the background thread, reads the next block into the back buffer of the RecordReader.
+
+template <typename TFile>
+struct ReadAheadWorker_
+{
+    RecordReader<TFile, SinglePass<ReadAhead> > * _reader;
+
+    ReadAheadWorker_(RecordReader<TFile, SinglePass<ReadAhead> > & reader) : _reader(&reader)
+    {}
+
+    template <typename TThread>
+    void run(TThread * /*thread*/)
+    {
+        _readAheadBlock(*_reader);
+    }
+};
+
+/*!
+ * @class ReadAheadSinglePassRecordReader
+ * @extends SinglePassRecordReader
+ * @headerfile <seqan/stream.h>
+ * @brief Single-pass RecordReader that fills the next buffer in a background thread.
+ *
+ * @signature template <typename TStream>
+ *            class RecordReader<TStream, SinglePass<ReadAhead> >;
+ *
+ * @tparam TStream The @link StreamConcept @endlink to work on.
+ *
+ * @section Remarks
+ *
+ * The reader holds two buffers of 4 MiB by default.  While the records in the current buffer are tokenized, a
+ * background thread reads the next block of the stream into the second buffer.  This hides the latency of network
+ * file systems and of decompressing streams such as gzip files.
+ *
+ * The stream must not be accessed by other code while the reader exists.  Is neither default nor copy constructable.
+ */
+
+/**
+.Spec.Read-Ahead Single-Pass RecordReader
+..cat:Input/Output
+..general:Spec.Single-Pass RecordReader
+..summary:Single-pass record reader that fills the next buffer in a background thread.
+..signature:RecordReader<TStream, SinglePass<ReadAhead> >
+..param.TStream:The @Concept.StreamConcept@ type to work on.
+..remarks:The reader holds two buffers of 4 MiB by default.  While the current buffer is tokenized, a background thread reads the next block of the stream into the second buffer.
+..remarks:The stream must not be accessed by other code while the reader exists.
+..remarks:Is not default or copy constructable.
+..include:seqan/stream.h
+ */
+
+template <typename TFile>
+class RecordReader<TFile, SinglePass<ReadAhead> >
+{
+public:
+    TFile & _file;
+    unsigned _bufferSize;
+    CharString _buffer;
+    typedef typename Iterator<CharString, Standard>::Type TIter;
+    TIter _current, _end;
+    int _resultCode;
+    bool _stayInOneBuffer;
+    // True if the stream was at its end after reading the current buffer.  The stream itself must not be queried while
+    // the background thread reads from it.
+    bool _eof;
+    typedef typename Position<TFile>::Type TPosition;
+    TPosition _position;  // Position in file.
+
+    // The back buffer and the result of reading into it, written by the background thread.
+    CharString _nextBuffer;
+    bool _nextReady;
+    size_t _nextBytesRead;
+    int _nextResultCode;
+    bool _nextEof;
+    TPosition _nextPosition;
+    Thread<ReadAheadWorker_<TFile> > _thread;
+
+    enum {
+        OK = 0,
+        INVALID_FORMAT
+    };
+
+    static const unsigned DEFAULT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+    RecordReader(TFile & file)
+            : _file(file), _bufferSize(DEFAULT_BUFFER_SIZE), _current(0), _end(0), _resultCode(0),
+              _stayInOneBuffer(false), _eof(false), _position(0), _nextReady(false), _nextBytesRead(0),
+              _nextResultCode(0), _nextEof(false), _nextPosition(0), _thread(*this)
+    {
+        _init();
+    }
+
+    RecordReader(TFile & file, unsigned bufferSize)
+            : _file(file), _bufferSize(bufferSize), _current(0), _end(0), _resultCode(0),
+              _stayInOneBuffer(false), _eof(false), _position(0), _nextReady(false), _nextBytesRead(0),
+              _nextResultCode(0), _nextEof(false), _nextPosition(0), _thread(*this)
+    {
+        _init();
+    }
+
+    ~RecordReader()
+    {
+        // Never leave the background thread running on the stream.
+        if (_thread)
+            _thread.wait();
+    }
+
+private:
+    // No default or copy constructor.
+    RecordReader(RecordReader const & other) : _file(other._file) {}
+
+    void _init()
+    {
+        resize(_buffer, _bufferSize);
+        resize(_nextBuffer, _bufferSize);
+        _refillBuffer(*this);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Function _readAheadBlock()
+// ----------------------------------------------------------------------------
+
+// Read the next block into the back buffer, called in the background thread or directly if there is none.
+
+template <typename TFile>
+inline void
+_readAheadBlock(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    recordReader._nextPosition = streamTell(recordReader._file);
+    recordReader._nextBytesRead = streamReadBlock(begin(recordReader._nextBuffer, Standard()), recordReader._file,
+                                                  recordReader._bufferSize);
+    recordReader._nextResultCode = 0;
+    // If we read fewer characters and the stream is not at its end then there was an error reading the file.
+    if (recordReader._nextBytesRead != recordReader._bufferSize)
+        recordReader._nextResultCode = streamError(recordReader._file);
+    recordReader._nextEof = streamEof(recordReader._file);
+    recordReader._nextReady = true;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _waitReadAhead()
+// ----------------------------------------------------------------------------
+
+// Wait for the background thread to finish reading into the back buffer.
+
+template <typename TFile>
+inline void
+_waitReadAhead(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    if (recordReader._thread)
+        recordReader._thread.wait();
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _startReadAhead()
+// ----------------------------------------------------------------------------
+
+// Start reading the next block in the background, falls back to reading it on demand if no thread can be started.
+
+template <typename TFile>
+inline void
+_startReadAhead(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    SEQAN_ASSERT_NOT(recordReader._thread);
+    recordReader._nextReady = false;
+    if (recordReader._eof || recordReader._resultCode != 0)
+        return;
+    recordReader._thread.open();
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _refillBuffer()
+// ----------------------------------------------------------------------------
+
+template <typename TFile>
+inline bool
+_refillBuffer(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    if (recordReader._stayInOneBuffer && recordReader._end != 0)
+        // e.g. file format detection; if end==0 there hasnt yet been a buffer
+        return false;
+    if (recordReader._eof)
+        return false;
+
+    // Take over the back buffer, reading it now if it has not been read ahead.
+    _waitReadAhead(recordReader);
+    if (!recordReader._nextReady)
+        _readAheadBlock(recordReader);
+    swap(recordReader._buffer, recordReader._nextBuffer);
+
+    recordReader._current = begin(recordReader._buffer, Standard());
+    // Add the size in place, fpos + size_t is ambiguous for std::fstream positions.
+    recordReader._position = recordReader._nextPosition;
+    recordReader._position += recordReader._nextBytesRead;
+    recordReader._eof = recordReader._nextEof;
+    recordReader._resultCode = recordReader._nextResultCode;
+    if (recordReader._resultCode != 0)
+    {
+        recordReader._end = recordReader._current;
+        recordReader._nextReady = false;
+        return false;
+    }
+    recordReader._end = recordReader._current + recordReader._nextBytesRead;
+
+    // Fill the back buffer while the caller tokenizes this one.
+    _startReadAhead(recordReader);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function position()
+// ----------------------------------------------------------------------------
+
+template <typename TFile>
+inline typename Position<TFile>::Type
+position(RecordReader<TFile, SinglePass<ReadAhead> > const & recordReader)
+{
+    typename Position<TFile>::Type bufferedUnread = recordReader._end - recordReader._current;
+    return recordReader._position - bufferedUnread;
+}
+
+// ----------------------------------------------------------------------------
+// Function setPosition()
+// ----------------------------------------------------------------------------
+
+template <typename TFile, typename TPosition>
+inline int
+setPosition(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader, TPosition pos)
+{
+    // The block read ahead is discarded.
+    _waitReadAhead(recordReader);
+    recordReader._nextReady = false;
+    int res = streamSeek(recordReader._file, pos, SEEK_SET);
+    if (res != 0)
+        return res;
+    recordReader._eof = false;
+    _refillBuffer(recordReader);
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function atEnd()
+// ----------------------------------------------------------------------------
+
+template <typename TFile>
+inline bool
+atEnd(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    // There is more data if the buffer is not exhausted.
+    if (recordReader._current != recordReader._end)
+        return false;
+    // There is no more data if the buffer is exhausted and the stream was at its end after the last block or there
+    // previously was an error reading the file.
+    if (recordReader._eof || recordReader._resultCode != 0)
+        return true;
+    return !_refillBuffer(recordReader);
+}
+
+// ----------------------------------------------------------------------------
+// Function resultCode()
+// ----------------------------------------------------------------------------
+
+template <typename TFile>
+inline int
+resultCode(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    return recordReader._resultCode;
+}
+
+// ----------------------------------------------------------------------------
+// Function goNext()
+// ----------------------------------------------------------------------------
+
+template <typename TFile>
+inline bool
+goNext(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    SEQAN_ASSERT(recordReader._current != recordReader._end);
+
+    recordReader._current += 1;
+    // If there is more data in the buffer then we're done.
+    if (recordReader._current != recordReader._end)
+        return false;  // Has more data.
+
+    // Otherwise, try to load some data.
+    return !_refillBuffer(recordReader);
+}
+
+// ----------------------------------------------------------------------------
+// Function value()
+// ----------------------------------------------------------------------------
+
+template <typename TFile>
+inline char
+value(RecordReader<TFile, SinglePass<ReadAhead> > & recordReader)
+{
+    SEQAN_ASSERT(recordReader._current != recordReader._end);
+    return *recordReader._current;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_STREAM_RECORD_READER_SINGLE_READ_AHEAD_H_
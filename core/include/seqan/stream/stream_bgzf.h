@@ -598,13 +598,16 @@ _bgzfReadBlock(Stream<Bgzf> & stream)
 }
 
 // ----------------------------------------------------------------------------
-// Helper Function _bgzfDeflateBlock()
+// Helper Function _bgzfCompressBlock()
 // ----------------------------------------------------------------------------
 
-// Deflate from uncompressed block to compressed block.  Also add extra field that stores the compressed block length.
+// Compress srcLength bytes from src into one BGZF block at dst, including the gzip header with the extra field that
+// stores the compressed block length and the CRC footer.  Returns the length of the block, or -1 if the block does not
+// fit into dstCapacity bytes or compression failed.  Does not touch any stream state so that independent blocks can be
+// compressed concurrently.
 
 inline int
-_bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
+_bgzfCompressBlock(char * dst, int dstCapacity, char const * src, int srcLength, int compressLevel)
 {
     const int BLOCK_HEADER_LENGTH = 18;
     const int BLOCK_FOOTER_LENGTH = 8;
@@ -624,85 +627,94 @@ _bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
 
     const int MAX_BLOCK_SIZE = 64 * 1024;
 
-    // Make sure there is enough space in the buffer for compressed and uncompressed data.
-    resize(stream._compressedBlock, MAX_BLOCK_SIZE);
-    resize(stream._uncompressedBlock, MAX_BLOCK_SIZE);
-
-    char * buffer = &stream._compressedBlock[0];
-    int bufferSize = length(stream._compressedBlock);
+    if (dstCapacity < BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH)
+        return -1;
 
     // Init gzip header
-    buffer[0] = GZIP_ID1;
-    buffer[1] = GZIP_ID2;
-    buffer[2] = CM_DEFLATE;
-    buffer[3] = FLG_FEXTRA;
-    buffer[4] = 0;  // mtime
-    buffer[5] = 0;
-    buffer[6] = 0;
-    buffer[7] = 0;
-    buffer[8] = 0;
-    buffer[9] = OS_UNKNOWN;
-    buffer[10] = BGZF_XLEN;
-    buffer[11] = 0;
-    buffer[12] = BGZF_ID1;
-    buffer[13] = BGZF_ID2;
-    buffer[14] = BGZF_LEN;
-    buffer[15] = 0;
-    buffer[16] = 0;  // Placeholder for block length.
-    buffer[17] = 0;
-
-    // Loop to retry for blocks that do not compress enough.
-    int inputLength = blockLength;
-    int compressedLength = 0;
-    while (true)
-    {
-        z_stream zs;
-        zs.zalloc = NULL;
-        zs.zfree = NULL;
-        zs.next_in = static_cast<Bytef *>(static_cast<void *>(&stream._uncompressedBlock[0]));
-        zs.avail_in = inputLength;
-        zs.next_out = static_cast<Bytef *>(static_cast<void *>(&buffer[BLOCK_HEADER_LENGTH]));
-        zs.avail_out = bufferSize - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
-
-        int status = deflateInit2(&zs, stream._compressLevel, Z_DEFLATED,
-                                  GZIP_WINDOW_BITS, Z_DEFAULT_MEM_LEVEL, Z_DEFAULT_STRATEGY);
-        if (status != Z_OK)
-            return -1;  // deflateInit2() failed.
-
-        status = deflate(&zs, Z_FINISH);
-        if (status != Z_STREAM_END)
-        {
-            status = deflateEnd(&zs);
-            if (status == Z_OK)
-            {
-                // Not enough space in buffer.  This can happen in the rare case the input doesn't compress enough.  We
-                // try to resolve this by reducing the amount of input until it fits.
-                inputLength -= 1024;
-                if (inputLength <= 0)
-                    return -1;  // Input reduction failed.
-                continue;
-            }
-            return -1;  // Deflate failed.
-        }
+    dst[0] = GZIP_ID1;
+    dst[1] = GZIP_ID2;
+    dst[2] = CM_DEFLATE;
+    dst[3] = FLG_FEXTRA;
+    dst[4] = 0;  // mtime
+    dst[5] = 0;
+    dst[6] = 0;
+    dst[7] = 0;
+    dst[8] = 0;
+    dst[9] = OS_UNKNOWN;
+    dst[10] = BGZF_XLEN;
+    dst[11] = 0;
+    dst[12] = BGZF_ID1;
+    dst[13] = BGZF_ID2;
+    dst[14] = BGZF_LEN;
+    dst[15] = 0;
+    dst[16] = 0;  // Placeholder for block length.
+    dst[17] = 0;
 
-        status = deflateEnd(&zs);
-        if (status != Z_OK)
-            return -1;  // Deflate end failed.
+    z_stream zs;
+    zs.zalloc = NULL;
+    zs.zfree = NULL;
+    zs.next_in = static_cast<Bytef *>(static_cast<void *>(const_cast<char *>(src)));
+    zs.avail_in = srcLength;
+    zs.next_out = static_cast<Bytef *>(static_cast<void *>(&dst[BLOCK_HEADER_LENGTH]));
+    zs.avail_out = dstCapacity - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
 
-        compressedLength = zs.total_out;
-        compressedLength += BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH;
-        if (compressedLength > MAX_BLOCK_SIZE)
-            return -1;  // Deflate overflow, should never happen.
+    int status = deflateInit2(&zs, compressLevel, Z_DEFLATED, GZIP_WINDOW_BITS, Z_DEFAULT_MEM_LEVEL,
+                              Z_DEFAULT_STRATEGY);
+    if (status != Z_OK)
+        return -1;  // deflateInit2() failed.
 
-        break;
+    status = deflate(&zs, Z_FINISH);
+    if (status != Z_STREAM_END)
+    {
+        deflateEnd(&zs);
+        return -1;  // Not enough space in buffer or deflate failed.
     }
 
+    status = deflateEnd(&zs);
+    if (status != Z_OK)
+        return -1;  // Deflate end failed.
+
+    int compressedLength = zs.total_out + BLOCK_HEADER_LENGTH + BLOCK_FOOTER_LENGTH;
+    if (compressedLength > MAX_BLOCK_SIZE)
+        return -1;  // Deflate overflow, should never happen.
+
     // Set compressed length into buffer, compute CRC and write CRC into buffer.
-    _bgzfPackInt16((unsigned char*)&buffer[16], compressedLength - 1);
+    _bgzfPackInt16((unsigned char*)&dst[16], compressedLength - 1);
     __uint32 crc = crc32(0L, NULL, 0L);
-    crc = crc32(crc, static_cast<Bytef *>(static_cast<void *>(&stream._uncompressedBlock[0])), inputLength);
-    _bgzfPackInt32((unsigned char*)&buffer[compressedLength - 8], crc);
-    _bgzfPackInt32((unsigned char*)&buffer[compressedLength - 4], inputLength);
+    crc = crc32(crc, static_cast<Bytef const *>(static_cast<void const *>(src)), srcLength);
+    _bgzfPackInt32((unsigned char*)&dst[compressedLength - 8], crc);
+    _bgzfPackInt32((unsigned char*)&dst[compressedLength - 4], srcLength);
+
+    return compressedLength;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfDeflateBlock()
+// ----------------------------------------------------------------------------
+
+// Deflate from uncompressed block to compressed block.  Also add extra field that stores the compressed block length.
+
+inline int
+_bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
+{
+    const int MAX_BLOCK_SIZE = 64 * 1024;
+
+    // Make sure there is enough space in the buffer for compressed and uncompressed data.
+    resize(stream._compressedBlock, MAX_BLOCK_SIZE);
+    resize(stream._uncompressedBlock, MAX_BLOCK_SIZE);
+
+    // Loop to retry for blocks that do not compress enough.  This can happen in the rare case the input doesn't
+    // compress enough.  We try to resolve this by reducing the amount of input until it fits.
+    int inputLength = blockLength;
+    int compressedLength = 0;
+    while ((compressedLength = _bgzfCompressBlock(&stream._compressedBlock[0], length(stream._compressedBlock),
+                                                  &stream._uncompressedBlock[0], inputLength,
+                                                  stream._compressLevel)) < 0)
+    {
+        inputLength -= 1024;
+        if (inputLength <= 0)
+            return -1;  // Input reduction failed.
+    }
 
     // Copy data that did not fit into the compressed block forward in the uncompressed data buffer.
     int remaining = blockLength - inputLength;
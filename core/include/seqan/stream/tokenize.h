@@ -41,6 +41,12 @@
 
 #include <cctype>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // #if defined(__AVX2__)
+
 namespace seqan {
 
 // ==========================================================================
@@ -346,21 +352,327 @@ _charCompare(int const c, TabOrLineBreak_ const & /* tag*/)
 
 //TODO(h4nn3s): add for AminoAcid and Rna-tags
 
+// ----------------------------------------------------------------------------
+// Class TokenizeCharSet_
+// ----------------------------------------------------------------------------
+
+// A small set of stop characters for scanning the buffer of a RecordReader.  The scan stops on the first character
+// that is in the set (stopInSet == true) or that is not in the set (stopInSet == false).
+
+struct TokenizeCharSet_
+{
+    char chars[6];
+    unsigned size;
+    bool stopInSet;
+
+    TokenizeCharSet_() : size(0), stopInSet(true)
+    {}
+
+    TokenizeCharSet_(char c1, bool stopInSet_ = true) : size(1), stopInSet(stopInSet_)
+    {
+        chars[0] = c1;
+    }
+};
+
+inline void
+_addChar(TokenizeCharSet_ & set, char c)
+{
+    SEQAN_ASSERT_LT(set.size, 6u);
+    set.chars[set.size++] = c;
+}
+
+// ----------------------------------------------------------------------------
+// Metafunction HasTokenizeCharSet_
+// ----------------------------------------------------------------------------
+
+// True for the character classes that can be written as a TokenizeCharSet_.
+
+template <typename TTag>
+struct HasTokenizeCharSet_ : False {};
+
+template <>
+struct HasTokenizeCharSet_<Whitespace_> : True {};
+
+template <>
+struct HasTokenizeCharSet_<Blank_> : True {};
+
+template <>
+struct HasTokenizeCharSet_<UnixEOL_> : True {};
+
+template <>
+struct HasTokenizeCharSet_<BackslashR_> : True {};
+
+template <>
+struct HasTokenizeCharSet_<TabOrLineBreak_> : True {};
+
+// ----------------------------------------------------------------------------
+// Metafunction HasTokenizeBuffer_
+// ----------------------------------------------------------------------------
+
+// True for the RecordReaders that keep the next characters in one contiguous char buffer between _current and _end.
+
+template <typename TRecordReader>
+struct HasTokenizeBuffer_ : False {};
+
+template <typename TFile>
+struct HasTokenizeBuffer_<RecordReader<TFile, SinglePass<void> > > : True {};
+
+template <typename TFile>
+struct HasTokenizeBuffer_<RecordReader<TFile, SinglePass<ReadAhead> > > : True {};
+
+template <typename TString>
+struct HasTokenizeBuffer_<RecordReader<TString, SinglePass<StringReader> > > :
+    IsSameType<typename Iterator<TString, Standard>::Type, char *> {};
+
+// ----------------------------------------------------------------------------
+// Function _tokenizeCharSet()
+// ----------------------------------------------------------------------------
+
+inline TokenizeCharSet_
+_tokenizeCharSet(Whitespace_ const & /*tag*/, bool stopInSet)
+{
+    // The characters for which isspace() is true in the C locale.
+    TokenizeCharSet_ set(' ', stopInSet);
+    _addChar(set, '\t');
+    _addChar(set, '\n');
+    _addChar(set, '\v');
+    _addChar(set, '\f');
+    _addChar(set, '\r');
+    return set;
+}
+
+inline TokenizeCharSet_
+_tokenizeCharSet(Blank_ const & /*tag*/, bool stopInSet)
+{
+    TokenizeCharSet_ set(' ', stopInSet);
+    _addChar(set, '\t');
+    return set;
+}
+
+inline TokenizeCharSet_
+_tokenizeCharSet(UnixEOL_ const & /*tag*/, bool stopInSet)
+{
+    return TokenizeCharSet_('\n', stopInSet);
+}
+
+inline TokenizeCharSet_
+_tokenizeCharSet(BackslashR_ const & /*tag*/, bool stopInSet)
+{
+    return TokenizeCharSet_('\r', stopInSet);
+}
+
+inline TokenizeCharSet_
+_tokenizeCharSet(TabOrLineBreak_ const & /*tag*/, bool stopInSet)
+{
+    TokenizeCharSet_ set('\t', stopInSet);
+    _addChar(set, '\r');
+    _addChar(set, '\n');
+    return set;
+}
+
+// ----------------------------------------------------------------------------
+// Function _tokenizeFind()
+// ----------------------------------------------------------------------------
+
+// Returns the first position in [it, itEnd) where the scan of the character set stops or itEnd.
+
+inline bool
+_tokenizeStopsAt(TokenizeCharSet_ const & set, char c)
+{
+    bool inSet = false;
+    for (unsigned i = 0; i < set.size; ++i)
+        inSet |= (set.chars[i] == c);
+    return inSet == set.stopInSet;
+}
+
+inline unsigned
+_tokenizeLowestBit(unsigned mask)
+{
+#if defined(_MSC_VER)
+    unsigned long pos;
+    _BitScanForward(&pos, mask);
+    return pos;
+#else  // #if defined(_MSC_VER)
+    return __builtin_ctz(mask);
+#endif  // #if defined(_MSC_VER)
+}
+
+inline char const *
+_tokenizeFind(char const * it, char const * itEnd, TokenizeCharSet_ const & set)
+{
+#if defined(__AVX2__)
+    // Compare 32 characters at once with all characters of the set.
+    __m256i needles[6];
+    for (unsigned i = 0; i < set.size; ++i)
+        needles[i] = _mm256_set1_epi8(set.chars[i]);
+    for (; itEnd - it >= 32; it += 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(it));
+        __m256i hits = _mm256_cmpeq_epi8(block, needles[0]);
+        for (unsigned i = 1; i < set.size; ++i)
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, needles[i]));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hits));
+        if (!set.stopInSet)
+            mask = ~mask;
+        if (mask != 0u)
+            return it + _tokenizeLowestBit(mask);
+    }
+#elif defined(__SSE2__)
+    // Compare 16 characters at once with all characters of the set.
+    __m128i needles[6];
+    for (unsigned i = 0; i < set.size; ++i)
+        needles[i] = _mm_set1_epi8(set.chars[i]);
+    for (; itEnd - it >= 16; it += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(it));
+        __m128i hits = _mm_cmpeq_epi8(block, needles[0]);
+        for (unsigned i = 1; i < set.size; ++i)
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, needles[i]));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if (!set.stopInSet)
+            mask = ~mask & 0xffffu;
+        if (mask != 0u)
+            return it + _tokenizeLowestBit(mask);
+    }
+#endif  // #if defined(__AVX2__)
+    for (; it != itEnd; ++it)
+        if (_tokenizeStopsAt(set, *it))
+            return it;
+    return itEnd;
+}
+
+// ----------------------------------------------------------------------------
+// Function _tokenizeFindNonAlnum()
+// ----------------------------------------------------------------------------
+
+// Returns the first position in [it, itEnd) that holds no alphanumeric character or itEnd.
+
+inline char const *
+_tokenizeFindNonAlnum(char const * it, char const * itEnd)
+{
+#if defined(__SSE2__)
+    // Bytes >= 0x80 are negative in the signed comparisons and thus never in the ranges.
+    __m128i const lowerCaseBit = _mm_set1_epi8(0x20);
+    __m128i const beforeA = _mm_set1_epi8('a' - 1);
+    __m128i const afterZ = _mm_set1_epi8('z' + 1);
+    __m128i const before0 = _mm_set1_epi8('0' - 1);
+    __m128i const after9 = _mm_set1_epi8('9' + 1);
+    for (; itEnd - it >= 16; it += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(it));
+        __m128i lower = _mm_or_si128(block, lowerCaseBit);
+        __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(lower, beforeA), _mm_cmplt_epi8(lower, afterZ));
+        __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(block, before0), _mm_cmplt_epi8(block, after9));
+        unsigned mask = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(isAlpha, isDigit))) & 0xffffu;
+        if (mask != 0u)
+            return it + _tokenizeLowestBit(mask);
+    }
+#endif  // #if defined(__SSE2__)
+    for (; it != itEnd; ++it)
+        if (!_charCompare(*it, AlphaNum_()))
+            return it;
+    return itEnd;
+}
+
+// ----------------------------------------------------------------------------
+// Function _appendCharSpan()
+// ----------------------------------------------------------------------------
+
+// The overloads for strings are in seqan/sequence/string_char_span.h, skipping characters appends nothing.
+
+inline void
+_appendCharSpan(Nothing & /*buffer*/, char const * /*it*/, char const * /*itEnd*/)
+{}
+
+// ----------------------------------------------------------------------------
+// Function _tokenizeScan()
+// ----------------------------------------------------------------------------
+
+// Scan the buffer of the RecordReader for the stop character and append the characters before it to buffer.  The
+// reader is left on the stop character.  Only used for readers with HasTokenizeBuffer_.
+
+template <typename TBuffer, typename TRecordReader>
+inline int
+_tokenizeScan(TBuffer & buffer, TRecordReader & reader, TokenizeCharSet_ const & set)
+{
+    while (!atEnd(reader))
+    {
+        char const * it = reader._current;
+        char const * itEnd = reader._end;
+        char const * hit = _tokenizeFind(it, itEnd, set);
+        _appendCharSpan(buffer, it, hit);
+        reader._current += hit - it;
+        if (hit != itEnd)
+            return 0;
+    }
+    if (resultCode(reader) != 0)
+        return resultCode(reader);
+    return EOF_BEFORE_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------
+// Function _readUntilCharSet()
+// ----------------------------------------------------------------------------
+
+template <typename TBuffer>
+inline void
+_appendTokenizeChar(TBuffer & buffer, char c)
+{
+    appendValue(buffer, c, Generous());
+}
+
+inline void
+_appendTokenizeChar(Nothing & /*buffer*/, char /*c*/)
+{}
+
+template <typename TBuffer, typename TRecordReader>
+inline int
+_readUntilCharSet(TBuffer & buffer, TRecordReader & reader, TokenizeCharSet_ const & set, True const & /*tokenizeBuffer*/)
+{
+    return _tokenizeScan(buffer, reader, set);
+}
+
+template <typename TBuffer, typename TRecordReader>
+inline int
+_readUntilCharSet(TBuffer & buffer, TRecordReader & reader, TokenizeCharSet_ const & set, False const & /*tokenizeBuffer*/)
+{
+    while (!atEnd(reader))
+    {
+        char c = value(reader);
+        if (_tokenizeStopsAt(set, c))
+            return 0;
+        _appendTokenizeChar(buffer, c);
+        goNext(reader);
+        if (resultCode(reader) != 0)
+            return resultCode(reader);
+    }
+    return EOF_BEFORE_SUCCESS;
+}
 
 // ----------------------------------------------------------------------------
 // Function _readHelper() [other read functions use this]
 // ----------------------------------------------------------------------------
 
-// read chars from record reader depending on condition
-template <typename TTagSpec, // specialization of character comparison
-          typename TRecordReader, // record reader
-          typename TBuffer> // usually charstring, but maybe DnaString or so
+// read chars from record reader depending on condition, vectorized scan of the reader's buffer
+template <typename TTagSpec, typename TRecordReader, typename TBuffer>
 inline int
 _readHelper(TBuffer & buffer,
             TRecordReader & reader,
             Tag<TTagSpec> const & tag,
-            bool const desiredOutcomeOfComparison) 
-/*   desired behaviour of loop -> "readUntil()" or "readwhile()"  */
+            bool const desiredOutcomeOfComparison,
+            True const & /*tokenizeBuffer*/)
+{
+    return _tokenizeScan(buffer, reader, _tokenizeCharSet(tag, desiredOutcomeOfComparison));
+}
+
+// read chars from record reader depending on condition, character by character
+template <typename TTagSpec, typename TRecordReader, typename TBuffer>
+inline int
+_readHelper(TBuffer & buffer,
+            TRecordReader & reader,
+            Tag<TTagSpec> const & tag,
+            bool const desiredOutcomeOfComparison,
+            False const & /*tokenizeBuffer*/)
 {
     typedef char TChar;
 
@@ -377,6 +689,21 @@ _readHelper(TBuffer & buffer,
     return EOF_BEFORE_SUCCESS;
 }
 
+// read chars from record reader depending on condition
+template <typename TTagSpec, // specialization of character comparison
+          typename TRecordReader, // record reader
+          typename TBuffer> // usually charstring, but maybe DnaString or so
+inline int
+_readHelper(TBuffer & buffer,
+            TRecordReader & reader,
+            Tag<TTagSpec> const & tag,
+            bool const desiredOutcomeOfComparison) 
+/*   desired behaviour of loop -> "readUntil()" or "readwhile()"  */
+{
+    typedef typename And<HasTokenizeBuffer_<TRecordReader>, HasTokenizeCharSet_<Tag<TTagSpec> > >::Type TTokenizeBuffer;
+    return _readHelper(buffer, reader, tag, desiredOutcomeOfComparison, TTokenizeBuffer());
+}
+
 template <typename TSpec, // specialization of character comparison
           typename TRecordReader, // record reader
           typename TBuffer> // usually charstring, but maybe DnaString or so
@@ -399,7 +726,8 @@ _readHelper(TBuffer & buffer,
             TRecordReader & reader,
             Tag<TTagSpec> const & compTag,
             Tag<TTagSpec2> const & skipTag,
-            bool const desiredOutcomeOfComparison)
+            bool const desiredOutcomeOfComparison,
+            False const & /*tokenizeBuffer*/)
 {
     typedef char TChar;
 
@@ -420,6 +748,62 @@ _readHelper(TBuffer & buffer,
 }
 
 
+template <typename TTagSpec,
+          typename TTagSpec2, // specialization of character class to be ignored
+          typename TRecordReader,
+          typename TBuffer>
+inline int
+_readHelper(TBuffer & buffer,
+            TRecordReader & reader,
+            Tag<TTagSpec> const & compTag,
+            Tag<TTagSpec2> const & skipTag,
+            bool const desiredOutcomeOfComparison)
+{
+    return _readHelper(buffer, reader, compTag, skipTag, desiredOutcomeOfComparison, False());
+}
+
+// reading alphanumeric characters ignoring whitespace, e.g. sequences in FASTA files, vectorized scan of the buffer
+template <typename TRecordReader, typename TBuffer>
+inline int
+_readAlphaNumsIgnoringWhitespace(TBuffer & buffer, TRecordReader & reader, True const & /*tokenizeBuffer*/)
+{
+    while (!atEnd(reader))
+    {
+        char const * it = reader._current;
+        char const * hit = _tokenizeFindNonAlnum(it, reader._end);
+        _appendCharSpan(buffer, it, hit);
+        reader._current += hit - it;
+        if (hit == reader._end)
+            continue;
+        if (!_charCompare(*hit, Whitespace_()))
+            return 0;
+        goNext(reader);
+        if (resultCode(reader) != 0)
+            return resultCode(reader);
+    }
+    return EOF_BEFORE_SUCCESS;
+}
+
+template <typename TRecordReader, typename TBuffer>
+inline int
+_readAlphaNumsIgnoringWhitespace(TBuffer & buffer, TRecordReader & reader, False const & /*tokenizeBuffer*/)
+{
+    return _readHelper(buffer, reader, AlphaNum_(), Whitespace_(), false, False());
+}
+
+template <typename TRecordReader, typename TBuffer>
+inline int
+_readHelper(TBuffer & buffer,
+            TRecordReader & reader,
+            AlphaNum_ const & compTag,
+            Whitespace_ const & skipTag,
+            bool const desiredOutcomeOfComparison)
+{
+    if (!desiredOutcomeOfComparison)
+        return _readAlphaNumsIgnoringWhitespace(buffer, reader, typename HasTokenizeBuffer_<TRecordReader>::Type());
+    return _readHelper(buffer, reader, compTag, skipTag, desiredOutcomeOfComparison, False());
+}
+
 template <typename TTagSpec,
           typename TTagSpec2, // specialization of character class to be ignored
           typename TRecordReader,
@@ -445,7 +829,19 @@ template <typename TTagSpec, typename TRecordReader>
 inline int
 _skipHelper(TRecordReader & reader,
             Tag<TTagSpec> const & tag,
-            bool const desiredOutcomeOfComparison)
+            bool const desiredOutcomeOfComparison,
+            True const & /*tokenizeBuffer*/)
+{
+    Nothing nothing;
+    return _tokenizeScan(nothing, reader, _tokenizeCharSet(tag, desiredOutcomeOfComparison));
+}
+
+template <typename TTagSpec, typename TRecordReader>
+inline int
+_skipHelper(TRecordReader & reader,
+            Tag<TTagSpec> const & tag,
+            bool const desiredOutcomeOfComparison,
+            False const & /*tokenizeBuffer*/)
 {
     typedef char TChar;
 
@@ -461,6 +857,16 @@ _skipHelper(TRecordReader & reader,
     return EOF_BEFORE_SUCCESS;
 }
 
+template <typename TTagSpec, typename TRecordReader>
+inline int
+_skipHelper(TRecordReader & reader,
+            Tag<TTagSpec> const & tag,
+            bool const desiredOutcomeOfComparison)
+{
+    typedef typename And<HasTokenizeBuffer_<TRecordReader>, HasTokenizeCharSet_<Tag<TTagSpec> > >::Type TTokenizeBuffer;
+    return _skipHelper(reader, tag, desiredOutcomeOfComparison, TTokenizeBuffer());
+}
+
 
 template <typename TTagSpec, typename TRecordReader>
 inline int
@@ -634,85 +1040,54 @@ template <typename TBuffer, typename TStream, typename TPass>
 inline int
 readUntilOneOf(TBuffer & buffer, RecordReader<TStream, TPass> & reader, char c1)
 {
-    while (!atEnd(reader))
-    {
-        char c = value(reader);
-        if (c == c1)
-            return 0;
-        appendValue(buffer, c, Generous());
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    return _readUntilCharSet(buffer, reader, TokenizeCharSet_(c1), TTokenizeBuffer());
 }
 
 template <typename TBuffer, typename TStream, typename TPass>
 inline int
 readUntilOneOf(TBuffer & buffer, RecordReader<TStream, TPass> & reader, char c1, char c2)
 {
-    while (!atEnd(reader))
-    {
-        char c = value(reader);
-        if (c == c1 || c == c2)
-            return 0;
-        appendValue(buffer, c, Generous());
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    TokenizeCharSet_ set(c1);
+    _addChar(set, c2);
+    return _readUntilCharSet(buffer, reader, set, TTokenizeBuffer());
 }
 
 template <typename TBuffer, typename TStream, typename TPass>
 inline int
 readUntilOneOf(TBuffer & buffer, RecordReader<TStream, TPass> & reader, char c1, char c2, char c3)
 {
-    while (!atEnd(reader))
-    {
-        char c = value(reader);
-        if (c == c1 || c == c2 || c == c3)
-            return 0;
-        appendValue(buffer, c, Generous());
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    TokenizeCharSet_ set(c1);
+    _addChar(set, c2);
+    _addChar(set, c3);
+    return _readUntilCharSet(buffer, reader, set, TTokenizeBuffer());
 }
 
 template <typename TBuffer, typename TStream, typename TPass>
 inline int
 readUntilOneOf(TBuffer & buffer, RecordReader<TStream, TPass> & reader, char c1, char c2, char c3, char c4)
 {
-    while (!atEnd(reader))
-    {
-        char c = value(reader);
-        if (c == c1 || c == c2 || c == c3 || c == c4)
-            return 0;
-        appendValue(buffer, c, Generous());
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    TokenizeCharSet_ set(c1);
+    _addChar(set, c2);
+    _addChar(set, c3);
+    _addChar(set, c4);
+    return _readUntilCharSet(buffer, reader, set, TTokenizeBuffer());
 }
 
 template <typename TBuffer, typename TStream, typename TPass>
 inline int
 readUntilOneOf(TBuffer & buffer, RecordReader<TStream, TPass> & reader, char c1, char c2, char c3, char c4, char c5)
 {
-    while (!atEnd(reader))
-    {
-        char c = value(reader);
-        if (c == c1 || c == c2 || c == c3 || c == c4 || c == c5)
-            return 0;
-        appendValue(buffer, c, Generous());
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    TokenizeCharSet_ set(c1);
+    _addChar(set, c2);
+    _addChar(set, c3);
+    _addChar(set, c4);
+    _addChar(set, c5);
+    return _readUntilCharSet(buffer, reader, set, TTokenizeBuffer());
 }
 
 /*!
@@ -875,19 +1250,8 @@ readUntilChar(TBuffer & buffer,
               TCharX const & x)
 {
     SEQAN_CHECKPOINT
-    typedef char TChar;
-
-    while (!atEnd(reader))
-    {
-        TChar c = value(reader);
-        if (c == x)
-            return 0;
-        appendValue(buffer, c, Generous());
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    return _readUntilCharSet(buffer, reader, TokenizeCharSet_(x), TTokenizeBuffer());
 }
 
 /*!
@@ -1335,18 +1699,9 @@ skipUntilChar(RecordReader<TStream, TPass> & reader,
               TCharX const & x)
 {
     SEQAN_CHECKPOINT
-    typedef char TChar;
-
-    while (!atEnd(reader))
-    {
-        TChar c = value(reader);
-        if (c == x)
-            return 0;
-        goNext(reader);
-        if (resultCode(reader) != 0)
-            return resultCode(reader);
-    }
-    return EOF_BEFORE_SUCCESS;
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
+    Nothing nothing;
+    return _readUntilCharSet(nothing, reader, TokenizeCharSet_(x), TTokenizeBuffer());
 }
 
 /*!
@@ -2008,44 +2363,35 @@ template <typename TStream, typename TPass, typename TBuffer>
 inline int
 readLine(TBuffer & buffer, RecordReader<TStream, TPass> & reader)
 {
-    int r = 0;
-
-    // Loop over characters from stream, taking early exits on line breaks and errors.
-    while (!atEnd(reader))
-    {
-        char c = value(reader);
+    typedef typename HasTokenizeBuffer_<RecordReader<TStream, TPass> >::Type TTokenizeBuffer;
 
-        // Unix EOL is the simplest case.
-        if (c == '\n')
-        {
-            if (!atEnd(reader))
-                goNext(reader);
-            return resultCode(reader);
-        }
-
-        // If the current character is '\r' then this can be an ANSI or a Mac line ending.
-        if (c == '\r')
-        {
-            goNext(reader);
-            if ((r = resultCode(reader)) != 0)
-                return r;
-            if (atEnd(reader))
-                return 0;  // Assume Mac EOL at end of file.
-            if (value(reader) == '\n')
-            {
-                // Assume Windows EOL.
-                if (!atEnd(reader))
-                    goNext(reader);
-                return resultCode(reader);
-            }
-            return 0;  // Was Mac EOL, not at end of file.
-        }
+    // Read up to the first line break, taking early exits on errors.
+    TokenizeCharSet_ eolSet('\n');
+    _addChar(eolSet, '\r');
+    int r = _readUntilCharSet(buffer, reader, eolSet, TTokenizeBuffer());
+    if (r != 0)
+        return r;
 
-        appendValue(buffer, c);
+    // Unix EOL is the simplest case.
+    if (value(reader) == '\n')
+    {
         goNext(reader);
+        return resultCode(reader);
     }
 
-    return EOF_BEFORE_SUCCESS;
+    // The current character is '\r', this can be an ANSI or a Mac line ending.
+    goNext(reader);
+    if ((r = resultCode(reader)) != 0)
+        return r;
+    if (atEnd(reader))
+        return 0;  // Assume Mac EOL at end of file.
+    if (value(reader) == '\n')
+    {
+        // Assume Windows EOL.
+        goNext(reader);
+        return resultCode(reader);
+    }
+    return 0;  // Was Mac EOL, not at end of file.
 }
 
 /*!
@@ -58,11 +58,12 @@ namespace SEQAN_NAMESPACE_MAIN
         DWORD  hThreadID;
         Worker worker;
 
-        Thread() {}
+        Thread():
+            hThread(NULL) {}
 
         template <typename TArg>
         Thread(TArg &arg):
-            worker(arg) {}
+            hThread(NULL), worker(arg) {}
 
         ~Thread() {
             if (*this) {
@@ -92,7 +93,11 @@ namespace SEQAN_NAMESPACE_MAIN
         }
 
         inline bool wait(DWORD timeoutMilliSec = INFINITE) {
-            return WaitForSingleObject(hThread, timeoutMilliSec) != WAIT_TIMEOUT;
+            if (WaitForSingleObject(hThread, timeoutMilliSec) == WAIT_TIMEOUT)
+                return false;
+            CloseHandle(hThread);
+            hThread = NULL;
+            return true;
         }
 
         inline operator bool() const {
@@ -107,7 +112,7 @@ namespace SEQAN_NAMESPACE_MAIN
         }
 
         static DWORD WINAPI _start(LPVOID _this) {
-            reinterpret_cast<Thread*>(_this)->worker.run(&reinterpret_cast<Thread*>(_this));
+            reinterpret_cast<Thread*>(_this)->worker.run(reinterpret_cast<Thread*>(_this));
 			return 0;	// return value should indicate success/failure
         }
     };
@@ -123,11 +128,12 @@ namespace SEQAN_NAMESPACE_MAIN
         pthread_t data, *hThread;
         Worker worker;
 
-        Thread() {}
+        Thread():
+            hThread(NULL) {}
 
         template <typename TArg>
         Thread(TArg &arg):
-            worker(arg) {}
+            hThread(NULL), worker(arg) {}
 
         ~Thread() {
             if (*this) {
@@ -145,7 +151,7 @@ namespace SEQAN_NAMESPACE_MAIN
         }
 
         inline bool close() {
-            return cancel() && wait() && !(hThread == NULL);
+            return cancel() && wait();
         }
 
         inline bool cancel() {
@@ -153,11 +159,17 @@ namespace SEQAN_NAMESPACE_MAIN
         }
 
         inline bool wait() {
-            return !(pthread_join(data, NULL));
+            if (pthread_join(data, NULL))
+                return false;
+            hThread = NULL;
+            return true;
         }
 
         inline bool wait(void* &retVal) {
-            return !(pthread_join(data, &retVal));
+            if (pthread_join(data, &retVal))
+                return false;
+            hThread = NULL;
+            return true;
         }
 
         inline bool detach() {
@@ -176,7 +188,7 @@ namespace SEQAN_NAMESPACE_MAIN
         }
 
         static void* _start(void* _this) {
-            reinterpret_cast<Thread*>(_this)->worker.run(&reinterpret_cast<Thread*>(_this));
+            reinterpret_cast<Thread*>(_this)->worker.run(reinterpret_cast<Thread*>(_this));
 			return 0;
         }
     };
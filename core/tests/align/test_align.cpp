@@ -598,6 +598,12 @@ SEQAN_BEGIN_TESTSUITE(test_align)
     SEQAN_CALL_TEST(test_align_global_alignment_score_myers_hirschberg);
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_single_character);
 
+    SEQAN_CALL_TEST(test_align_global_alignment_tiled_wavefront_align);
+    SEQAN_CALL_TEST(test_align_global_alignment_tiled_wavefront_gaps);
+    SEQAN_CALL_TEST(test_align_global_alignment_tiled_wavefront_free_end_gaps);
+    SEQAN_CALL_TEST(test_align_global_alignment_tiled_wavefront_empty);
+    SEQAN_CALL_TEST(test_align_global_alignment_score_tiled_wavefront);
+
     // -----------------------------------------------------------------------
     // Test Operations On Align Objects
     // -----------------------------------------------------------------------
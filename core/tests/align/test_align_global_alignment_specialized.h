@@ -315,4 +315,150 @@ SEQAN_DEFINE_TEST(test_align_global_alignment_score_myers_hirschberg)
     SEQAN_ASSERT_EQ(res, -8);
 }
 
+SEQAN_DEFINE_TEST(test_align_global_alignment_tiled_wavefront_align)
+{
+    using namespace seqan;
+
+    Dna5String strH = "AAAAAATTTTTTTTGACGTACGTTAGCAGGATTACAGATTACCAGATTACGATTTACAGATTAC";
+    Dna5String strV = "AATTTTTTTTTTGGGGGACGTCGTTAGCAGATTAGATTACCAGATTTTACGATTTACAGATAC";
+
+    // Linear gap costs, compared against Needleman-Wunsch for different tile sizes.
+    {
+        Score<int, Simple> scoringScheme(2, -1, -1);
+
+        Align<Dna5String> expected;
+        resize(rows(expected), 2);
+        assignSource(row(expected, 0), strH);
+        assignSource(row(expected, 1), strV);
+        int expectedScore = globalAlignment(expected, scoringScheme, NeedlemanWunsch());
+
+        for (unsigned tileSize = 1; tileSize <= 70; tileSize += 3)
+        {
+            Align<Dna5String> align;
+            resize(rows(align), 2);
+            assignSource(row(align, 0), strH);
+            assignSource(row(align, 1), strV);
+
+            int score = globalAlignment(align, scoringScheme, TiledWavefront(tileSize));
+
+            SEQAN_ASSERT_EQ(score, expectedScore);
+            SEQAN_ASSERT_EQ(computeAlignmentStats(align, scoringScheme), expectedScore);
+        }
+    }
+
+    // Affine gap costs, compared against Gotoh.
+    {
+        Score<int, Simple> scoringScheme(2, -1, -1, -3);
+
+        Align<Dna5String> expected;
+        resize(rows(expected), 2);
+        assignSource(row(expected, 0), strH);
+        assignSource(row(expected, 1), strV);
+        int expectedScore = globalAlignment(expected, scoringScheme, Gotoh());
+
+        for (unsigned tileSize = 1; tileSize <= 70; tileSize += 3)
+        {
+            Align<Dna5String> align;
+            resize(rows(align), 2);
+            assignSource(row(align, 0), strH);
+            assignSource(row(align, 1), strV);
+
+            int score = globalAlignment(align, scoringScheme, TiledWavefront(tileSize));
+
+            SEQAN_ASSERT_EQ(score, expectedScore);
+            SEQAN_ASSERT_EQ(computeAlignmentStats(align, scoringScheme), expectedScore);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_tiled_wavefront_gaps)
+{
+    using namespace seqan;
+
+    Dna5String strH = "AAAAAATTTTTTTTG";
+    DnaString strV = "AATTTTTTTTTTGGGGG";
+
+    Gaps<Dna5String, ArrayGaps> gapsH(strH);
+    Gaps<DnaString, ArrayGaps> gapsV(strV);
+
+    Score<int, Simple> scoringScheme(2, -1, -1);
+
+    int score = globalAlignment(gapsH, gapsV, scoringScheme, TiledWavefront(4));
+
+    SEQAN_ASSERT_EQ(score, 14);
+    SEQAN_ASSERT_EQ(length(gapsH), length(gapsV));
+    SEQAN_ASSERT_EQ(length(gapsH), 19u);
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_tiled_wavefront_free_end_gaps)
+{
+    using namespace seqan;
+
+    Dna5String strH = "CCCCCCACGTTAGCAGGATTACAGGGGGGG";
+    Dna5String strV = "ACGTTAGCAGGATTACA";
+
+    Score<int, Simple> scoringScheme(2, -1, -2, -4);
+
+    AlignConfig<true, false, false, true> alignConfig;
+    int expectedScore = globalAlignmentScore(strH, strV, scoringScheme, alignConfig, Gotoh());
+
+    for (unsigned tileSize = 1; tileSize <= 32; tileSize *= 2)
+    {
+        SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, alignConfig, TiledWavefront(tileSize)),
+                        expectedScore);
+
+        Align<Dna5String> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), strH);
+        assignSource(row(align, 1), strV);
+        SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, alignConfig, TiledWavefront(tileSize)), expectedScore);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_tiled_wavefront_empty)
+{
+    using namespace seqan;
+
+    Dna5String strH = "ACGTTAGCAGG";
+    Dna5String strV;
+
+    Score<int, Simple> scoringScheme(2, -1, -1, -3);
+
+    // Like the other DP algorithms, empty sequences yield the minimal score.
+    SEQAN_ASSERT_EQ(globalAlignmentScore(strH, strV, scoringScheme, TiledWavefront(4)), MinValue<int>::VALUE);
+    SEQAN_ASSERT_EQ(globalAlignmentScore(strV, strH, scoringScheme, TiledWavefront(4)), MinValue<int>::VALUE);
+    SEQAN_ASSERT_EQ(globalAlignmentScore(strV, strV, scoringScheme, TiledWavefront(4)), MinValue<int>::VALUE);
+
+    Align<Dna5String> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), strH);
+    assignSource(row(align, 1), strV);
+    SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, TiledWavefront(4)), MinValue<int>::VALUE);
+}
+
+SEQAN_DEFINE_TEST(test_align_global_alignment_score_tiled_wavefront)
+{
+    using namespace seqan;
+
+    Dna5String strH = "ATGT";
+    DnaString strV = "ATAGAT";
+
+    StringSet<Dna5String> strings;
+    appendValue(strings, strH);
+    appendValue(strings, strV);
+
+    Score<int, Simple> scoringScheme(2, -1, -1);
+
+    int res = 0;
+
+    res = globalAlignmentScore(strH, strV, scoringScheme, TiledWavefront(2));
+    SEQAN_ASSERT_EQ(res, 6);
+
+    res = globalAlignmentScore(strings, scoringScheme, TiledWavefront(3));
+    SEQAN_ASSERT_EQ(res, 6);
+
+    res = globalAlignmentScore(strH, strV, scoringScheme, TiledWavefront());
+    SEQAN_ASSERT_EQ(res, 6);
+}
+
 #endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGN_GLOBAL_ALIGNMENT_SPECIALIZED_H_
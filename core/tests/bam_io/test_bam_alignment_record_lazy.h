@@ -0,0 +1,228 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for the BamLazyAlignmentRecord.
+// ==========================================================================
+
+#ifndef CORE_TESTS_BAM_IO_TEST_BAM_ALIGNMENT_RECORD_LAZY_H_
+#define CORE_TESTS_BAM_IO_TEST_BAM_ALIGNMENT_RECORD_LAZY_H_
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+
+#include <seqan/bam_io.h>
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_lazy_read_alignment)
+{
+    using namespace seqan;
+
+    CharString bamFilename;
+    append(bamFilename, SEQAN_PATH_TO_ROOT());
+    append(bamFilename, "/core/tests/bam_io/small.bam");
+
+    Stream<Bgzf> stream;
+    SEQAN_ASSERT(open(stream, toCString(bamFilename), "r"));
+
+    StringSet<CharString> referenceNameStore;
+    NameStoreCache<StringSet<CharString> > referenceNameStoreCache(referenceNameStore);
+    BamIOContext<StringSet<CharString> > bamIOContext(referenceNameStore, referenceNameStoreCache);
+
+    BamHeader header;
+    SEQAN_ASSERT_EQ(readRecord(header, bamIOContext, stream, Bam()), 0);
+
+    BamLazyAlignmentRecord record;
+    SEQAN_ASSERT_EQ(readRecord(record, bamIOContext, stream, Bam()), 0);
+
+    // Only the fixed-size fields are decoded by reading.
+    SEQAN_ASSERT_EQ(record._decoded, 0u);
+    SEQAN_ASSERT_EQ(record.flag, 2);
+    SEQAN_ASSERT_EQ(record.rID, 0);
+    SEQAN_ASSERT_EQ(record.beginPos, 0);
+    SEQAN_ASSERT_EQ(record.mapQ, 8);
+    SEQAN_ASSERT_EQ(record.rNextId, 0);
+    SEQAN_ASSERT_EQ(record.pNext, 30);
+    SEQAN_ASSERT_EQ(record.tLen, 40);
+
+    SEQAN_ASSERT_EQ(getQName(record), "READ0");
+    SEQAN_ASSERT_EQ(record._decoded, static_cast<unsigned>(BamLazyAlignmentRecord::DECODED_QNAME));
+
+    String<CigarElement<> > const & cigar = getCigar(record);
+    SEQAN_ASSERT_EQ(length(cigar), 3u);
+    SEQAN_ASSERT_EQ(cigar[0].count, 5u);
+    SEQAN_ASSERT_EQ(cigar[0].operation, 'M');
+    SEQAN_ASSERT_EQ(cigar[1].count, 1u);
+    SEQAN_ASSERT_EQ(cigar[1].operation, 'I');
+    SEQAN_ASSERT_EQ(cigar[2].count, 4u);
+    SEQAN_ASSERT_EQ(cigar[2].operation, 'M');
+    SEQAN_ASSERT_EQ(getSeq(record), "AAAAAAAAAA");
+    SEQAN_ASSERT_EQ(getQual(record), "!!!!!!!!!!");
+    SEQAN_ASSERT_EQ(length(getTags(record)), 0u);
+
+    // Reading the next record resets the decoded fields.
+    SEQAN_ASSERT_EQ(readRecord(record, bamIOContext, stream, Bam()), 0);
+    SEQAN_ASSERT_EQ(record._decoded, 0u);
+    SEQAN_ASSERT_EQ(record.flag, 1);
+    SEQAN_ASSERT_EQ(record.beginPos, 1);
+    SEQAN_ASSERT_EQ(getQName(record), "READ0");
+}
+
+// Compare lazy and eager decoding on a file with tags and unmapped reads.
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_lazy_compare_ex1)
+{
+    using namespace seqan;
+
+    CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/bam_io/ex1.bam");
+
+    BamStream bamIO(toCString(filePath));
+    BamStream bamIOLazy(toCString(filePath));
+    SEQAN_ASSERT(isGood(bamIO));
+    SEQAN_ASSERT(isGood(bamIOLazy));
+
+    BamAlignmentRecord record;
+    BamLazyAlignmentRecord lazyRecord;
+    BamAlignmentRecord converted;
+    unsigned count = 0;
+    while (!atEnd(bamIO))
+    {
+        SEQAN_ASSERT_NOT(atEnd(bamIOLazy));
+        SEQAN_ASSERT_EQ(readRecord(record, bamIO), 0);
+        SEQAN_ASSERT_EQ(readRecord(lazyRecord, bamIOLazy), 0);
+
+        assignRecord(converted, lazyRecord);
+        SEQAN_ASSERT_EQ(converted.qName, record.qName);
+        SEQAN_ASSERT_EQ(converted.flag, record.flag);
+        SEQAN_ASSERT_EQ(converted.rID, record.rID);
+        SEQAN_ASSERT_EQ(converted.beginPos, record.beginPos);
+        SEQAN_ASSERT_EQ(converted.mapQ, record.mapQ);
+        SEQAN_ASSERT_EQ(converted.bin, record.bin);
+        SEQAN_ASSERT(converted.cigar == record.cigar);
+        SEQAN_ASSERT_EQ(converted.rNextId, record.rNextId);
+        SEQAN_ASSERT_EQ(converted.pNext, record.pNext);
+        SEQAN_ASSERT_EQ(converted.tLen, record.tLen);
+        SEQAN_ASSERT_EQ(converted.seq, record.seq);
+        SEQAN_ASSERT_EQ(converted.qual, record.qual);
+        SEQAN_ASSERT_EQ(converted.tags, record.tags);
+        ++count;
+    }
+    SEQAN_ASSERT(atEnd(bamIOLazy));
+    SEQAN_ASSERT_EQ(count, 3307u);
+}
+
+// Copy records from the input to the output through BamStream.
+
+void testBamIOBamLazyPassThrough(char const * pathFragmentIn, char const * pathFragmentExpected)
+{
+    seqan::CharString inPath = SEQAN_PATH_TO_ROOT();
+    append(inPath, pathFragmentIn);
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, pathFragmentExpected);
+
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    if (seqan::endsWith(pathFragmentExpected, ".bam"))
+        append(tmpPath, ".bam");
+    else
+        append(tmpPath, ".sam");
+
+    seqan::BamStream bamIn(toCString(inPath));
+    SEQAN_ASSERT(isGood(bamIn));
+    seqan::BamStream bamOut(toCString(tmpPath), seqan::BamStream::WRITE);
+    bamOut.header = bamIn.header;
+
+    seqan::BamLazyAlignmentRecord record;
+    while (!atEnd(bamIn))
+    {
+        SEQAN_ASSERT_EQ(readRecord(record, bamIn), 0);
+        SEQAN_ASSERT_EQ(writeRecord(bamOut, record), 0);
+    }
+    close(bamOut);
+
+    if (seqan::endsWith(pathFragmentExpected, ".bam"))
+        SEQAN_ASSERT(seqan::_compareBinaryFiles(toCString(tmpPath), toCString(filePath)));
+    else
+        SEQAN_ASSERT(seqan::_compareTextFiles(toCString(tmpPath), toCString(filePath)));
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_lazy_pass_through_bam)
+{
+    testBamIOBamLazyPassThrough("/core/tests/bam_io/small.bam", "/core/tests/bam_io/small.bam");
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_lazy_pass_through_sam)
+{
+    testBamIOBamLazyPassThrough("/core/tests/bam_io/small.sam", "/core/tests/bam_io/small.bam");
+    testBamIOBamLazyPassThrough("/core/tests/bam_io/small.bam", "/core/tests/bam_io/small.sam");
+}
+
+// Changing the position must update the bin when writing.
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_lazy_write_moved)
+{
+    using namespace seqan;
+
+    StringSet<CharString> contigNameStore;
+    appendValue(contigNameStore, "REF");
+    NameStoreCache<StringSet<CharString> > contigNameStoreCache(contigNameStore);
+    BamIOContext<StringSet<CharString> > bamIOContext(contigNameStore, contigNameStoreCache);
+
+    BamAlignmentRecord record;
+    record.qName = "READNAME";
+    record.flag = BAM_FLAG_ALL_PROPER | BAM_FLAG_RC;
+    record.rID = 0;
+    record.beginPos = 30;
+    record.mapQ = 8;
+    appendValue(record.cigar, CigarElement<>('M', 10));
+    record.seq = "CGATCGATAA";
+    record.qual = "IIIIIIIIII";
+    record.tags = "NMC\x01";
+
+    BamLazyAlignmentRecord lazyRecord;
+    assignRecord(lazyRecord, record);
+    SEQAN_ASSERT_EQ(lazyRecord.tLen, 2147483647);
+
+    record.beginPos = 100000;
+    lazyRecord.beginPos = 100000;
+
+    char buffer[1000];
+    char expected[1000];
+    Stream<CharArray<char *> > stream(buffer, buffer + 1000);
+    Stream<CharArray<char *> > expectedStream(expected, expected + 1000);
+    SEQAN_ASSERT_EQ(write2(stream, lazyRecord, bamIOContext, Bam()), 0);
+    SEQAN_ASSERT_EQ(write2(expectedStream, record, bamIOContext, Bam()), 0);
+    SEQAN_ASSERT_EQ(streamTell(stream), streamTell(expectedStream));
+    SEQAN_ASSERT_EQ(memcmp(&buffer[0], &expected[0], streamTell(stream)), 0);
+}
+
+#endif  // CORE_TESTS_BAM_IO_TEST_BAM_ALIGNMENT_RECORD_LAZY_H_
@@ -46,8 +46,12 @@
 #include "test_read_bam.h"
 #include "test_write_bam.h"
 #include "test_bam_index.h"
+#include "test_bam_alignment_record_lazy.h"
 #endif  // #if SEQAN_HAS_ZLIB
 #include "test_bam_stream.h"
+#if SEQAN_HAS_ZLIB
+#include "test_bam_sorter.h"
+#endif  // #if SEQAN_HAS_ZLIB
 
 SEQAN_BEGIN_TESTSUITE(test_bam_io)
 {
@@ -156,6 +160,13 @@ SEQAN_BEGIN_TESTSUITE(test_bam_io)
 
     // Test BAM indices.
     SEQAN_CALL_TEST(test_bam_io_bam_index_bai);
+
+    // Test lazy BAM records.
+    SEQAN_CALL_TEST(test_bam_io_bam_lazy_read_alignment);
+    SEQAN_CALL_TEST(test_bam_io_bam_lazy_compare_ex1);
+    SEQAN_CALL_TEST(test_bam_io_bam_lazy_pass_through_bam);
+    SEQAN_CALL_TEST(test_bam_io_bam_lazy_pass_through_sam);
+    SEQAN_CALL_TEST(test_bam_io_bam_lazy_write_moved);
 #endif  // #if SEQAN_HAS_ZLIB
 
     // Test BamStream class.
@@ -170,5 +181,16 @@ SEQAN_BEGIN_TESTSUITE(test_bam_io)
     SEQAN_CALL_TEST(test_bam_io_bam_stream_bam_read_ex1);
     SEQAN_CALL_TEST(test_bam_io_bam_stream_bam_write_header);
     SEQAN_CALL_TEST(test_bam_io_bam_stream_bam_write_records);
+#if SEQAN_HAS_ZLIB
+    SEQAN_CALL_TEST(test_bam_io_bam_stream_sam_parallel_roundtrip);
+#endif  // #if SEQAN_HAS_ZLIB
+    SEQAN_CALL_TEST(test_bam_io_bam_stream_sam_parallel_new_references);
+
+    // Test BamSorter class.
+#if SEQAN_HAS_ZLIB
+    SEQAN_CALL_TEST(test_bam_io_bam_sorter_coordinate_in_memory);
+    SEQAN_CALL_TEST(test_bam_io_bam_sorter_coordinate_external);
+    SEQAN_CALL_TEST(test_bam_io_bam_sorter_queryname);
+#endif  // #if SEQAN_HAS_ZLIB
 }
 SEQAN_END_TESTSUITE
@@ -0,0 +1,120 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for the external-memory BamSorter.
+// ==========================================================================
+
+#ifndef CORE_TESTS_BAM_IO_TEST_BAM_SORTER_H_
+#define CORE_TESTS_BAM_IO_TEST_BAM_SORTER_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+
+#include <seqan/bam_io.h>
+
+// Push the records of ex1.bam in reverse order into a sorter with the given configuration, write them to a SAM file
+// and compare the result against std::stable_sort().
+
+inline void testBamSorter(seqan::BamSortOrder order, __uint64 memoryLimit, unsigned maxMergeRuns,
+                          unsigned numThreads)
+{
+    using namespace seqan;
+
+    CharString bamFilename;
+    append(bamFilename, SEQAN_PATH_TO_ROOT());
+    append(bamFilename, "/core/tests/bam_io/ex1.bam");
+
+    BamStream bamIn(toCString(bamFilename));
+    SEQAN_ASSERT(isGood(bamIn));
+    std::vector<BamAlignmentRecord> records;
+    BamAlignmentRecord record;
+    while (!atEnd(bamIn))
+    {
+        SEQAN_ASSERT_EQ(readRecord(record, bamIn), 0);
+        records.push_back(record);
+    }
+    std::reverse(records.begin(), records.end());
+    SEQAN_ASSERT_EQ(records.size(), 3307u);
+
+    BamSorter sorter(order, memoryLimit);
+    sorter.maxMergeRuns = maxMergeRuns;
+    sorter.numThreads = numThreads;
+    for (unsigned i = 0; i < records.size(); ++i)
+        SEQAN_ASSERT_EQ(push(sorter, records[i]), 0);
+
+    CharString tmpPath = SEQAN_TEMP_FILENAME();
+    {
+        BamStream bamOut(toCString(tmpPath), BamStream::WRITE, BamStream::SAM);
+        bamOut.header = bamIn.header;
+        SEQAN_ASSERT_EQ(writeRecords(bamOut, sorter), 0);
+    }
+
+    std::stable_sort(records.begin(), records.end(), BamSorterLess_(order));
+
+    BamStream bamSorted(toCString(tmpPath), BamStream::READ, BamStream::SAM);
+    for (unsigned i = 0; i < records.size(); ++i)
+    {
+        SEQAN_ASSERT_NOT(atEnd(bamSorted));
+        SEQAN_ASSERT_EQ(readRecord(record, bamSorted), 0);
+        SEQAN_ASSERT_EQ(record.qName, records[i].qName);
+        SEQAN_ASSERT_EQ(record.flag, records[i].flag);
+        SEQAN_ASSERT_EQ(record.rID, records[i].rID);
+        SEQAN_ASSERT_EQ(record.beginPos, records[i].beginPos);
+        SEQAN_ASSERT_EQ(record.seq, records[i].seq);
+    }
+    SEQAN_ASSERT(atEnd(bamSorted));
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sorter_coordinate_in_memory)
+{
+    testBamSorter(seqan::BAM_SORT_COORDINATE, 512 * 1024 * 1024, 64, 3);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sorter_coordinate_external)
+{
+    // Small runs and a merge fan-in of 3 force several merge passes.
+    testBamSorter(seqan::BAM_SORT_COORDINATE, 32 * 1024, 3, 3);
+    testBamSorter(seqan::BAM_SORT_COORDINATE, 32 * 1024, 64, 1);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_sorter_queryname)
+{
+    testBamSorter(seqan::BAM_SORT_QUERYNAME, 512 * 1024 * 1024, 64, 2);
+    testBamSorter(seqan::BAM_SORT_QUERYNAME, 64 * 1024, 4, 2);
+}
+
+#endif  // #ifndef CORE_TESTS_BAM_IO_TEST_BAM_SORTER_H_
@@ -409,4 +409,129 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_stream_bam_file_size)
     SEQAN_ASSERT_EQ(positionInFile(bamStream), 0u);  // Is block position.
 }
 
+// ---------------------------------------------------------------------------
+// Parallel SAM I/O
+// ---------------------------------------------------------------------------
+
+// Convert ex1.bam to SAM with the sequential and the parallel writer and read the result back with the sequential and
+// the parallel reader.
+
+#if SEQAN_HAS_ZLIB
+SEQAN_DEFINE_TEST(test_bam_io_bam_stream_sam_parallel_roundtrip)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/bam_io/ex1.bam");
+
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".sam");
+    seqan::CharString tmpPathParallel = SEQAN_TEMP_FILENAME();
+    append(tmpPathParallel, ".sam");
+
+    {
+        seqan::BamStream bamIn(toCString(filePath));
+        SEQAN_ASSERT(isGood(bamIn));
+        seqan::BamStream samOut(toCString(tmpPath), seqan::BamStream::WRITE);
+        seqan::BamStream samOutParallel(toCString(tmpPathParallel), seqan::BamStream::WRITE_PARALLEL);
+        setParallelThreads(samOutParallel, 3);
+        setParallelChunkSize(samOutParallel, 2000);
+        samOut.header = bamIn.header;
+        samOutParallel.header = bamIn.header;
+
+        seqan::BamAlignmentRecord record;
+        while (!atEnd(bamIn))
+        {
+            SEQAN_ASSERT_EQ(readRecord(record, bamIn), 0);
+            SEQAN_ASSERT_EQ(writeRecord(samOut, record), 0);
+            SEQAN_ASSERT_EQ(writeRecord(samOutParallel, record), 0);
+        }
+        SEQAN_ASSERT_EQ(close(samOut), 0);
+        SEQAN_ASSERT_EQ(close(samOutParallel), 0);
+    }
+    SEQAN_ASSERT(seqan::_compareTextFiles(toCString(tmpPath), toCString(tmpPathParallel)));
+
+    seqan::BamStream samIn(toCString(tmpPath));
+    seqan::BamStream samInParallel(toCString(tmpPath), seqan::BamStream::READ_PARALLEL);
+    SEQAN_ASSERT(isGood(samIn));
+    SEQAN_ASSERT(isGood(samInParallel));
+    setParallelThreads(samInParallel, 3);
+    setParallelChunkSize(samInParallel, 2000);
+
+    seqan::BamAlignmentRecord record;
+    seqan::BamAlignmentRecord recordParallel;
+    unsigned count = 0;
+    while (!atEnd(samIn))
+    {
+        SEQAN_ASSERT_NOT(atEnd(samInParallel));
+        SEQAN_ASSERT_EQ(readRecord(record, samIn), 0);
+        SEQAN_ASSERT_EQ(readRecord(recordParallel, samInParallel), 0);
+        SEQAN_ASSERT_EQ(record.qName, recordParallel.qName);
+        SEQAN_ASSERT_EQ(record.flag, recordParallel.flag);
+        SEQAN_ASSERT_EQ(record.rID, recordParallel.rID);
+        SEQAN_ASSERT_EQ(record.beginPos, recordParallel.beginPos);
+        SEQAN_ASSERT_EQ(record.mapQ, recordParallel.mapQ);
+        SEQAN_ASSERT(record.cigar == recordParallel.cigar);
+        SEQAN_ASSERT_EQ(record.rNextId, recordParallel.rNextId);
+        SEQAN_ASSERT_EQ(record.pNext, recordParallel.pNext);
+        SEQAN_ASSERT_EQ(record.tLen, recordParallel.tLen);
+        SEQAN_ASSERT_EQ(record.seq, recordParallel.seq);
+        SEQAN_ASSERT_EQ(record.qual, recordParallel.qual);
+        SEQAN_ASSERT_EQ(record.tags, recordParallel.tags);
+        ++count;
+    }
+    SEQAN_ASSERT(atEnd(samInParallel));
+    SEQAN_ASSERT_EQ(count, 3307u);
+}
+#endif  // #if SEQAN_HAS_ZLIB
+
+// Reference names that are not in the header are numbered in file order, also if they first appear in different
+// chunks.
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_stream_sam_parallel_new_references)
+{
+    seqan::CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".sam");
+    {
+        std::ofstream out(toCString(tmpPath), std::ios::binary | std::ios::out);
+        out << "@SQ\tSN:chr2\tLN:100\n"
+            << "r0\t0\tchr1\t1\t8\t4M\t*\t0\t0\tACGT\t*\n"
+            << "r1\t0\tchr2\t2\t8\t4M\tchr3\t5\t0\tACGT\tIIII\n"
+            << "r2\t0\tchr3\t3\t8\t4M\t=\t7\t0\tACGT\tIIII\tNM:i:1\n"
+            << "r3\t0\tchr1\t4\t8\t4M\tchr4\t9\t0\tACGT\tIIII\n"
+            << "r4\t0\tchr4\t5\t8\t4M\t*\t0\t0\tACGT\tIIII";  // No trailing line break.
+    }
+
+    seqan::BamStream samIn(toCString(tmpPath), seqan::BamStream::READ_PARALLEL);
+    SEQAN_ASSERT(isGood(samIn));
+    setParallelThreads(samIn, 2);
+    setParallelChunkSize(samIn, 30);
+
+    seqan::String<seqan::BamAlignmentRecord> records;
+    while (!atEnd(samIn))
+    {
+        resize(records, length(records) + 1);
+        SEQAN_ASSERT_EQ(readRecord(back(records), samIn), 0);
+    }
+
+    SEQAN_ASSERT_EQ(length(records), 5u);
+    SEQAN_ASSERT_EQ(length(nameStore(samIn.bamIOContext)), 4u);
+    SEQAN_ASSERT_EQ(nameStore(samIn.bamIOContext)[0], "chr2");
+    SEQAN_ASSERT_EQ(nameStore(samIn.bamIOContext)[1], "chr1");
+    SEQAN_ASSERT_EQ(nameStore(samIn.bamIOContext)[2], "chr3");
+    SEQAN_ASSERT_EQ(nameStore(samIn.bamIOContext)[3], "chr4");
+
+    SEQAN_ASSERT_EQ(records[0].qName, "r0");
+    SEQAN_ASSERT_EQ(records[0].rID, 1);
+    SEQAN_ASSERT_EQ(records[1].rID, 0);
+    SEQAN_ASSERT_EQ(records[1].rNextId, 2);
+    SEQAN_ASSERT_EQ(records[2].rID, 2);
+    SEQAN_ASSERT_EQ(records[2].rNextId, 2);
+    SEQAN_ASSERT_EQ(length(records[2].tags), 7u);
+    SEQAN_ASSERT_EQ(records[3].rID, 1);
+    SEQAN_ASSERT_EQ(records[3].rNextId, 3);
+    SEQAN_ASSERT_EQ(records[4].qName, "r4");
+    SEQAN_ASSERT_EQ(records[4].rID, 3);
+    SEQAN_ASSERT_EQ(records[4].beginPos, 4);
+    SEQAN_ASSERT_EQ(records[4].qual, "IIII");
+}
+
 #endif  // #ifndef CORE_TESTS_BAM_IO_TEST_EASY_BAM_IO_H_
@@ -38,6 +38,9 @@
 SEQAN_BEGIN_TESTSUITE(test_consensus)
 {
     SEQAN_CALL_TEST(test_consensus_realign_one_contig_small);
+    SEQAN_CALL_TEST(test_consensus_realign_one_contig_small_incremental);
+    SEQAN_CALL_TEST(test_consensus_realign_incremental_same_result);
+    SEQAN_CALL_TEST(test_consensus_realign_incremental_clamped_band);
 #if 0
     SEQAN_CALL_TEST(test_consensus_consensus_score_sequence_entry_consensus_score);
     SEQAN_CALL_TEST(test_consensus_consensus_score_sequence_entry_fractional_score);
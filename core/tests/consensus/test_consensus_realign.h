@@ -94,4 +94,180 @@ SEQAN_DEFINE_TEST(test_consensus_realign_one_contig_small)
     // SEQAN_ASSERT_EQ(store.alignedReadStore[3].endPos, 146);
 }
 
+SEQAN_DEFINE_TEST(test_consensus_realign_one_contig_small_incremental)
+{
+    seqan::FragmentStore<> store;
+    seqan::CharString samPath = SEQAN_PATH_TO_ROOT();
+    append(samPath, "/core/tests/consensus/small_example.sam");
+    std::fstream samIn(toCString(samPath), std::ios::binary | std::ios::in);
+    SEQAN_ASSERT(samIn.good());
+    read(samIn, store, seqan::Sam());
+
+    seqan::Score<int, seqan::WeightedConsensusScore<
+                          seqan::Score<int, seqan::FractionalScore>,
+                          seqan::Score<int, seqan::ConsensusScore> > > combinedScore;
+    reAlign(store, combinedScore, 0, 1, 30, false, true);
+
+    seqan::AlignedReadLayout layout;
+    layoutAlignment(layout, store);
+    std::stringstream ss;
+    printAlignment(ss, seqan::Raw(), layout, store, 0, 0, 160, 0, 1000);
+
+    // Same result as in test_consensus_realign_one_contig_small.
+    char const * expected =
+            "TTCTATCTCCTATAGTCTGATATTACTGTAGGTACAGTAGCTTTTCTTCATTAATGTTTGCATAATATAGCTTCTTCCATGCTTTTACTTCCAATTATTTTGGTATGTGTGTGTGTGTGTGTGTGTGTGTGTGTGTATATATATATA-------------\n"
+            "TTCTATCTCCTATAGTCTGATATTACTGTAGGTACAGTAGCTTTTCTTCATTAATGTTTGCATAATATAGCTTCTTCCATGCTTTTACTTCCAATTATTTT\n"
+            "  CTATCTCCTATAGTCTGATATTACTGTAGGTACAGTAGCTTTTCTTCATTAATGTTTGCATAATATAGCTTCTTCCATGCTTTTACTTCCAATTATTTTGG\n"
+            "                                   AGTAGCTTTTCTTCATTAATGTTTGCATAATATAGCTTCTTCCATGCTTTTACTTCCAATTATTTTGGTA--TGTGTGTGTGTGTGTGTGTGTGTGTGTGTAT\n"
+            "                                              TTCATTAATGTTTGCATAATATAGCTTCTTCCATGCTTTTACTTCCAATTATTTTGGTATGTGTGTGTGTGTGTGTGTGTGTGTGTGTGTATATATATATA\n";
+
+    SEQAN_ASSERT_EQ(ss.str(), expected);
+}
+
+// Build a contig with reads that carry indels but are placed without gaps, realign it once in the normal and once
+// in the incremental mode and compare the results.
+
+inline void
+_buildRealignTestStore(seqan::FragmentStore<> & store, unsigned seed)
+{
+    typedef seqan::FragmentStore<>::TContigStore TContigStore;
+    typedef seqan::Value<TContigStore>::Type TContig;
+
+    seqan::Rng<seqan::MersenneTwister> rng(seed);
+    seqan::Dna5String ref;
+    for (unsigned i = 0; i < 600; ++i)
+        appendValue(ref, seqan::Dna(pickRandomNumber(rng) % 4));
+
+    TContig contig;
+    contig.seq = ref;
+    appendValue(store.contigStore, contig);
+    appendValue(store.contigNameStore, "contig");
+
+    for (unsigned i = 0; i < 80; ++i)
+    {
+        unsigned beginPos = pickRandomNumber(rng) % (length(ref) - 70);
+        seqan::Dna5String readSeq = infix(ref, beginPos, beginPos + 60);
+        unsigned indelPos = 5 + pickRandomNumber(rng) % 50;
+        switch (pickRandomNumber(rng) % 3)
+        {
+        case 0:
+            erase(readSeq, indelPos);
+            break;
+        case 1:
+            insertValue(readSeq, indelPos, seqan::Dna(pickRandomNumber(rng) % 4));
+            break;
+        default:
+            readSeq[indelPos] = seqan::Dna(pickRandomNumber(rng) % 4);
+        }
+        unsigned readId = appendRead(store, readSeq);
+        std::stringstream name;
+        name << "read" << i;
+        appendValue(store.readNameStore, name.str());
+        appendAlignedRead(store, readId, 0u, beginPos, beginPos + (unsigned)length(readSeq));
+    }
+}
+
+inline void
+_compareRealignTestStores(seqan::FragmentStore<> const & store1, seqan::FragmentStore<> const & store2)
+{
+    SEQAN_ASSERT(store1.contigStore[0].seq == store2.contigStore[0].seq);
+    SEQAN_ASSERT_EQ(length(store1.alignedReadStore), length(store2.alignedReadStore));
+    for (unsigned i = 0; i < length(store1.alignedReadStore); ++i)
+    {
+        SEQAN_ASSERT_EQ(store1.alignedReadStore[i].readId, store2.alignedReadStore[i].readId);
+        SEQAN_ASSERT_EQ(store1.alignedReadStore[i].beginPos, store2.alignedReadStore[i].beginPos);
+        SEQAN_ASSERT_EQ(store1.alignedReadStore[i].endPos, store2.alignedReadStore[i].endPos);
+        SEQAN_ASSERT(store1.alignedReadStore[i].gaps == store2.alignedReadStore[i].gaps);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_consensus_realign_incremental_same_result)
+{
+    seqan::Score<int, seqan::WeightedConsensusScore<
+                          seqan::Score<int, seqan::FractionalScore>,
+                          seqan::Score<int, seqan::ConsensusScore> > > combinedScore;
+
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        seqan::FragmentStore<> store1, store2;
+        _buildRealignTestStore(store1, seed);
+        _buildRealignTestStore(store2, seed);
+
+        reAlign(store1, combinedScore, 0, 1, 10, false);
+        reAlign(store2, combinedScore, 0, 1, 10, false, true);
+
+        _compareRealignTestStores(store1, store2);
+    }
+}
+
+// Reads that start within the bandwidth of column 0 have a band that is clamped to column 0 and reaches further to
+// the right.  The indels of the other reads lie behind endPos + bandwidth of these reads but within their band.
+
+inline void
+_buildRealignClampedTestStore(seqan::FragmentStore<> & store, unsigned seed)
+{
+    typedef seqan::FragmentStore<>::TContigStore TContigStore;
+    typedef seqan::Value<TContigStore>::Type TContig;
+
+    unsigned const bandwidth = 10;
+
+    seqan::Rng<seqan::MersenneTwister> rng(seed);
+    seqan::Dna5String ref;
+    for (unsigned i = 0; i < 200; ++i)
+        appendValue(ref, seqan::Dna(pickRandomNumber(rng) % 4));
+
+    TContig contig;
+    contig.seq = ref;
+    appendValue(store.contigStore, contig);
+    appendValue(store.contigNameStore, "contig");
+
+    for (unsigned i = 0; i < 24; ++i)
+    {
+        unsigned beginPos = 0;
+        seqan::Dna5String readSeq;
+        if (i % 2 == 0u)
+        {
+            // Starts at column 0 or 2, ends at 40 or 42.
+            beginPos = 2 * (i % 4 == 0u);
+            readSeq = infix(ref, beginPos, beginPos + 40);
+            readSeq[20 + i % 5] = seqan::Dna(pickRandomNumber(rng) % 4);
+        }
+        else
+        {
+            // Carries an indel behind column 42 + bandwidth but before 2 + 2 * bandwidth + 40.
+            beginPos = 30 + i % 3;
+            readSeq = infix(ref, beginPos, beginPos + 60);
+            unsigned indelPos = 42 + bandwidth + 2 + pickRandomNumber(rng) % 6 - beginPos;
+            if (i % 4 == 1u)
+                erase(readSeq, indelPos);
+            else
+                insertValue(readSeq, indelPos, seqan::Dna(pickRandomNumber(rng) % 4));
+        }
+        unsigned readId = appendRead(store, readSeq);
+        std::stringstream name;
+        name << "read" << i;
+        appendValue(store.readNameStore, name.str());
+        appendAlignedRead(store, readId, 0u, beginPos, beginPos + (unsigned)length(readSeq));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_consensus_realign_incremental_clamped_band)
+{
+    seqan::Score<int, seqan::WeightedConsensusScore<
+                          seqan::Score<int, seqan::FractionalScore>,
+                          seqan::Score<int, seqan::ConsensusScore> > > combinedScore;
+
+    for (unsigned seed = 1; seed <= 5; ++seed)
+    {
+        seqan::FragmentStore<> store1, store2;
+        _buildRealignClampedTestStore(store1, seed);
+        _buildRealignClampedTestStore(store2, seed);
+
+        reAlign(store1, combinedScore, 0, 1, 10, false);
+        reAlign(store2, combinedScore, 0, 1, 10, false, true);
+
+        _compareRealignTestStores(store1, store2);
+    }
+}
+
 #endif  // #ifndef CORE_TESTS_CONSENSUS_TEST_CONSENSUS_REALIGN_H_
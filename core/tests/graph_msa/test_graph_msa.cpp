@@ -63,6 +63,7 @@ SEQAN_BEGIN_TESTSUITE(test_graph_msa)
 
     SEQAN_CALL_TEST(test_distances);
 	SEQAN_CALL_TEST(test_libraries);
+	SEQAN_CALL_TEST(test_global_library_score_matrix);
 	SEQAN_CALL_TEST(test_external_libraries);
 	SEQAN_CALL_TEST(test_triplet_extension);
 	SEQAN_CALL_TEST(test_sop);
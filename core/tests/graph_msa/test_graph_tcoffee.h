@@ -154,6 +154,53 @@ void Test_Libraries() {
 	testquickAlign__(g);
 }
 
+void Test_GlobalLibraryScoreMatrix() {
+	typedef String<AminoAcid> TString;
+	typedef StringSet<TString, Dependent<> > TStringSet;
+	typedef Fragment<> TFragment;
+	
+	TString str1 = "GARFIELDTHELASTFATCAT";
+	TString str2 = "GARFIELDTHEFASTCAT";
+	TString str3 = "GARFIELDTHEVERYFASTCAT";
+	TString str4 = "THEFATCAT";
+	TStringSet strSet;
+	appendValue(strSet, str1);
+	appendValue(strSet, str2);
+	appendValue(strSet, str3);
+	appendValue(strSet, str4);
+	String<unsigned int> pList;
+	selectPairs(strSet, pList);
+	Blosum62 score_type(-1,-11);
+	AlignConfig<false,false,false,false> ac;
+
+	// Score matrices are used through a query profile, the result must be the same as with the matrix itself
+	String<TFragment> matches;
+	String<int> scores;
+	String<double> distanceMatrix;
+	appendSegmentMatches(strSet, pList, score_type, matches, scores, distanceMatrix, ac, GlobalPairwiseLibrary() );
+
+	String<TFragment> expectedMatches;
+	String<int> expectedScores;
+	for(unsigned int i = 0; i < length(pList); i += 2) {
+		TStringSet pairSet;
+		assignValueById(pairSet, strSet, positionToId(strSet, pList[i]));
+		assignValueById(pairSet, strSet, positionToId(strSet, pList[i + 1]));
+		int myScore = globalAlignment(expectedMatches, pairSet, score_type, ac, Gotoh() );
+		resize(expectedScores, length(expectedMatches), myScore);
+	}
+
+	SEQAN_ASSERT_EQ(length(matches), length(expectedMatches));
+	SEQAN_ASSERT_EQ(length(scores), length(expectedScores));
+	for(unsigned int i = 0; i < length(matches); ++i) {
+		SEQAN_ASSERT_EQ(sequenceId(matches[i], 0), sequenceId(expectedMatches[i], 0));
+		SEQAN_ASSERT_EQ(sequenceId(matches[i], 1), sequenceId(expectedMatches[i], 1));
+		SEQAN_ASSERT_EQ(fragmentBegin(matches[i], sequenceId(matches[i], 0)), fragmentBegin(expectedMatches[i], sequenceId(expectedMatches[i], 0)));
+		SEQAN_ASSERT_EQ(fragmentBegin(matches[i], sequenceId(matches[i], 1)), fragmentBegin(expectedMatches[i], sequenceId(expectedMatches[i], 1)));
+		SEQAN_ASSERT_EQ(fragmentLength(matches[i]), fragmentLength(expectedMatches[i]));
+		SEQAN_ASSERT_EQ(scores[i], expectedScores[i]);
+	}
+}
+
 void Test_ExternalLibraries() {
 	typedef String<char> TName;
 	typedef StringSet<TName, Owner<> > TNameSet;
@@ -476,6 +523,10 @@ SEQAN_DEFINE_TEST(test_libraries)
 {
 	Test_Libraries();	
 }
+SEQAN_DEFINE_TEST(test_global_library_score_matrix)
+{
+	Test_GlobalLibraryScoreMatrix();
+}
 SEQAN_DEFINE_TEST(test_external_libraries)
 {
 	Test_ExternalLibraries();	
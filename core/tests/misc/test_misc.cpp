@@ -57,6 +57,8 @@
 #include "test_misc_accumulators.h"
 #include "test_misc_edit_environment.h"
 #include "test_misc_bit_twiddling.h"
+#include "test_misc_name_store_cache.h"
+#include "test_misc_implicit_interval_tree.h"
 
 using namespace std;
 using namespace seqan;
@@ -117,6 +119,11 @@ SEQAN_BEGIN_TESTSUITE(test_misc) {
     SEQAN_CALL_TEST(Interval_Tree__IntervalTreeTest_GraphMap__int_ComputeCenter_StoreIntervals);
     SEQAN_CALL_TEST(Interval_Tree__IntervalTreeTest_FindIntervalsIntervals__int_ComputeCenter);
 
+    // Test ImplicitIntervalTree class
+    SEQAN_CALL_TEST(test_misc_implicit_interval_tree_fixed);
+    SEQAN_CALL_TEST(test_misc_implicit_interval_tree_random_int);
+    SEQAN_CALL_TEST(test_misc_implicit_interval_tree_random_double);
+
     SEQAN_CALL_TEST(test_misc_accumulators_average_accumulator_int_average);
     SEQAN_CALL_TEST(test_misc_accumulators_average_accumulator_int_count);
     SEQAN_CALL_TEST(test_misc_accumulators_average_accumulator_int_sum);
@@ -131,6 +138,10 @@ SEQAN_BEGIN_TESTSUITE(test_misc) {
     SEQAN_CALL_TEST(test_misc_edit_environment_string_enumerator_iterator_hamming);
     SEQAN_CALL_TEST(test_misc_edit_environment_string_enumerator_edit);
     SEQAN_CALL_TEST(test_misc_edit_environment_string_enumerator_iterator_edit);
+
+    SEQAN_CALL_TEST(test_misc_name_store_cache_get_id_by_name);
+    SEQAN_CALL_TEST(test_misc_name_store_cache_append_name);
+    SEQAN_CALL_TEST(test_misc_name_store_cache_concurrent_lookup);
 }
 SEQAN_END_TESTSUITE
 
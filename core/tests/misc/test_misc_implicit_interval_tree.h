@@ -0,0 +1,180 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for the ImplicitIntervalTree.
+// ==========================================================================
+
+#ifndef SEQAN_TESTS_MISC_TEST_MISC_IMPLICIT_INTERVAL_TREE_H_
+#define SEQAN_TESTS_MISC_TEST_MISC_IMPLICIT_INTERVAL_TREE_H_
+
+#include <cstdlib>
+#include <algorithm>
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/misc/misc_implicit_interval_tree.h>
+
+using namespace seqan;
+
+// Compare point, interval and batch queries of trees of different sizes with a naive scan.
+template <typename TValue>
+void testImplicitIntervalTreeRandom(unsigned numIntervals, TValue maxPos)
+{
+    typedef IntervalAndCargo<TValue, unsigned> TInterval;
+
+    String<TInterval> intervals;
+    for (unsigned i = 0; i < numIntervals; ++i)
+    {
+        TInterval interval;
+        interval.i1 = (TValue)(rand() % (int)maxPos);
+        interval.i2 = interval.i1 + (TValue)(rand() % ((int)maxPos / 10 + 1));
+        interval.cargo = i;
+        appendValue(intervals, interval);
+    }
+
+    ImplicitIntervalTree<TValue, unsigned> tree(intervals);
+    SEQAN_ASSERT_EQ(length(tree), numIntervals);
+
+    String<TValue> queryBegins;
+    String<TValue> queryEnds;
+    for (unsigned i = 0; i < 200; ++i)
+        appendValue(queryBegins, (TValue)(rand() % ((int)maxPos + 10)));
+    std::sort(begin(queryBegins, Standard()), end(queryBegins, Standard()));
+    for (unsigned i = 0; i < length(queryBegins); ++i)
+        appendValue(queryEnds, queryBegins[i] + (TValue)(rand() % 50));
+
+    StringSet<String<unsigned>, Owner<ConcatDirect<> > > pointResults;
+    StringSet<String<unsigned>, Owner<ConcatDirect<> > > intervalResults;
+    findIntervals(tree, queryBegins, pointResults);
+    findIntervals(tree, queryBegins, queryEnds, intervalResults);
+    SEQAN_ASSERT_EQ(length(pointResults), length(queryBegins));
+    SEQAN_ASSERT_EQ(length(intervalResults), length(queryBegins));
+
+    for (unsigned q = 0; q < length(queryBegins); ++q)
+    {
+        String<unsigned> naivePoint, naiveInterval;
+        for (unsigned j = 0; j < numIntervals; ++j)
+        {
+            if (intervals[j].i1 <= queryBegins[q] && queryBegins[q] < intervals[j].i2)
+                appendValue(naivePoint, j);
+            if (intervals[j].i1 < queryEnds[q] && queryBegins[q] < intervals[j].i2)
+                appendValue(naiveInterval, j);
+        }
+
+        String<unsigned> result;
+        findIntervals(tree, queryBegins[q], result);
+        std::sort(begin(result, Standard()), end(result, Standard()));
+        SEQAN_ASSERT(result == naivePoint);
+
+        findIntervals(tree, queryBegins[q], queryEnds[q], result);
+        std::sort(begin(result, Standard()), end(result, Standard()));
+        SEQAN_ASSERT(result == naiveInterval);
+
+        result = pointResults[q];
+        std::sort(begin(result, Standard()), end(result, Standard()));
+        SEQAN_ASSERT(result == naivePoint);
+
+        result = intervalResults[q];
+        std::sort(begin(result, Standard()), end(result, Standard()));
+        SEQAN_ASSERT(result == naiveInterval);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_misc_implicit_interval_tree_fixed)
+{
+    typedef IntervalAndCargo<int, unsigned> TInterval;
+
+    String<TInterval> intervals;
+    appendValue(intervals, TInterval(100, 1000, 0));    // gene
+    appendValue(intervals, TInterval(100, 300, 1));     // exon1
+    appendValue(intervals, TInterval(500, 700, 2));     // exon2
+    appendValue(intervals, TInterval(900, 1000, 3));    // exon3
+    appendValue(intervals, TInterval(550, 650, 4));     // coding2
+
+    ImplicitIntervalTree<int, unsigned> tree(intervals);
+
+    String<unsigned> result;
+    findIntervals(tree, 550, 900, result);
+    SEQAN_ASSERT_EQ(length(result), 3u);
+    SEQAN_ASSERT_EQ(result[0], 0u);
+    SEQAN_ASSERT_EQ(result[1], 2u);
+    SEQAN_ASSERT_EQ(result[2], 4u);
+
+    // Right boundaries are exclusive.
+    findIntervals(tree, 300, result);
+    SEQAN_ASSERT_EQ(length(result), 1u);
+    SEQAN_ASSERT_EQ(result[0], 0u);
+    findIntervals(tree, 1000, result);
+    SEQAN_ASSERT(empty(result));
+    findIntervals(tree, 100, result);
+    SEQAN_ASSERT_EQ(length(result), 2u);
+
+    String<int> queries;
+    appendValue(queries, 50);
+    appendValue(queries, 150);
+    appendValue(queries, 600);
+    appendValue(queries, 600);
+    appendValue(queries, 950);
+    StringSet<String<unsigned>, Owner<ConcatDirect<> > > results;
+    findIntervals(tree, queries, results);
+    SEQAN_ASSERT_EQ(length(results), 5u);
+    SEQAN_ASSERT_EQ(length(results[0]), 0u);
+    SEQAN_ASSERT_EQ(length(results[1]), 2u);
+    SEQAN_ASSERT_EQ(length(results[2]), 3u);
+    SEQAN_ASSERT_EQ(length(results[3]), 3u);
+    SEQAN_ASSERT_EQ(length(results[4]), 2u);
+
+    ImplicitIntervalTree<int, unsigned> emptyTree;
+    findIntervals(emptyTree, 10, result);
+    SEQAN_ASSERT(empty(result));
+    findIntervals(emptyTree, queries, results);
+    SEQAN_ASSERT_EQ(length(results), 5u);
+    SEQAN_ASSERT_EQ(length(concat(results)), 0u);
+}
+
+SEQAN_DEFINE_TEST(test_misc_implicit_interval_tree_random_int)
+{
+    srand(42);
+    for (unsigned n = 1; n < 40; ++n)
+        testImplicitIntervalTreeRandom<int>(n, 100);
+    testImplicitIntervalTreeRandom<int>(1000, 10000);
+    testImplicitIntervalTreeRandom<int>(4097, 100000);
+}
+
+SEQAN_DEFINE_TEST(test_misc_implicit_interval_tree_random_double)
+{
+    srand(42);
+    testImplicitIntervalTreeRandom<double>(1000, 10000.0);
+}
+
+#endif  // SEQAN_TESTS_MISC_TEST_MISC_IMPLICIT_INTERVAL_TREE_H_
@@ -697,6 +697,98 @@ SEQAN_DEFINE_TEST(test_score_sequence_entry_for_score)
     testScoreSequenceEntryForScore<ScoreMatrix<AminoAcid, Blosum62_> >();
 }
 
+SEQAN_DEFINE_TEST(test_score_query_profile)
+{
+    typedef Score<int, QueryProfile<Blosum62, Peptide> > TProfileScore;
+    typedef SequenceEntryForScore<TProfileScore, Peptide>::Type TEntry;
+
+    Blosum62 blosum(-1, -11);
+    Peptide query = "ARNDCQEGHILKMFPSTWYVBZX";
+    Peptide subject = "XZBVYWTSPFMKLIHGEQCDNRA";
+    TProfileScore profileScore(blosum, query);
+
+    SEQAN_ASSERT_EQ(length(profileScore.rows), length(query) * (unsigned)ValueSize<AminoAcid>::VALUE);
+    SEQAN_ASSERT_EQ(scoreGapExtend(profileScore), -1);
+    SEQAN_ASSERT_EQ(scoreGapOpen(profileScore), -11);
+
+    for (unsigned i = 0; i < length(query); ++i)
+    {
+        TEntry entryH = sequenceEntryForScore(profileScore, query, i);
+        for (unsigned j = 0; j < length(subject); ++j)
+        {
+            TEntry entryV = sequenceEntryForScore(profileScore, subject, j);
+            SEQAN_ASSERT_EQ(score(profileScore, entryH, entryV), score(blosum, query[i], subject[j]));
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_score_query_profile_alignment)
+{
+    typedef Score<int, QueryProfile<Blosum62, Peptide> > TProfileScore;
+
+    Peptide query = "MKVLAAGIVGLLLAQPAMAAEHSTQ";
+    Peptide subject = "MKKLLLAGVAVLLSLPAMAAQEHHQ";
+
+    // Linear gap costs.
+    Blosum62 linear(-2, -2);
+    TProfileScore linearProfile(linear, query);
+    SEQAN_ASSERT_EQ(globalAlignmentScore(query, subject, linearProfile),
+                    globalAlignmentScore(query, subject, linear));
+
+    // Affine gap costs, reuse the profile object for the same query.
+    Blosum62 affine(-1, -11);
+    assignQuery(linearProfile, affine, query);
+    SEQAN_ASSERT_EQ(globalAlignmentScore(query, subject, linearProfile),
+                    globalAlignmentScore(query, subject, affine));
+
+    // The alignment itself must be the same, too.
+    Align<Peptide> align1;
+    resize(rows(align1), 2);
+    assignSource(row(align1, 0), query);
+    assignSource(row(align1, 1), subject);
+    Align<Peptide> align2(align1);
+    int score1 = globalAlignment(align1, linearProfile);
+    int score2 = globalAlignment(align2, affine);
+    SEQAN_ASSERT_EQ(score1, score2);
+    SEQAN_ASSERT(row(align1, 0) == row(align2, 0));
+    SEQAN_ASSERT(row(align1, 1) == row(align2, 1));
+
+    SEQAN_ASSERT_EQ(localAlignment(align1, linearProfile), localAlignment(align2, affine));
+    SEQAN_ASSERT(row(align1, 0) == row(align2, 0));
+    SEQAN_ASSERT(row(align1, 1) == row(align2, 1));
+}
+SEQAN_DEFINE_TEST(test_score_query_profile_banded_enumeration)
+{
+    typedef Score<int, QueryProfile<Blosum62, Peptide> > TProfileScore;
+
+    Peptide query = "MKVLAAGIVGLLLAQPAMAAEHSTQWKVLAAGIVG";
+    Peptide subject = "MKKLLLAGVAVLLSLPAMAAQEHHQWKKLLLAGVA";
+
+    Blosum62 blosum(-1, -11);
+    TProfileScore profileScore(blosum, query);
+
+    // The banded Waterman-Eggert enumerator must give the same alignments in the same order.
+    Align<Peptide> align1;
+    resize(rows(align1), 2);
+    assignSource(row(align1, 0), query);
+    assignSource(row(align1, 1), subject);
+    Align<Peptide> align2(align1);
+
+    LocalAlignmentEnumerator<TProfileScore, Banded> enumerator1(profileScore, -5, 5, 5);
+    LocalAlignmentEnumerator<Blosum62, Banded> enumerator2(blosum, -5, 5, 5);
+
+    unsigned count = 0;
+    while (nextLocalAlignment(align1, enumerator1))
+    {
+        SEQAN_ASSERT(nextLocalAlignment(align2, enumerator2));
+        SEQAN_ASSERT_EQ(getScore(enumerator1), getScore(enumerator2));
+        SEQAN_ASSERT(row(align1, 0) == row(align2, 0));
+        SEQAN_ASSERT(row(align1, 1) == row(align2, 1));
+        ++count;
+    }
+    SEQAN_ASSERT_NOT(nextLocalAlignment(align2, enumerator2));
+    SEQAN_ASSERT_GT(count, 1u);
+}
 
 SEQAN_BEGIN_TESTSUITE(test_score) {
     // Call the tests for this module.
@@ -708,5 +800,8 @@ SEQAN_BEGIN_TESTSUITE(test_score) {
     SEQAN_CALL_TEST(test_score_matrix_sprintf_value);
     SEQAN_CALL_TEST(test_score_matrix_data);
     SEQAN_CALL_TEST(test_score_sequence_entry_for_score);
+    SEQAN_CALL_TEST(test_score_query_profile);
+    SEQAN_CALL_TEST(test_score_query_profile_alignment);
+    SEQAN_CALL_TEST(test_score_query_profile_banded_enumeration);
 }
 SEQAN_END_TESTSUITE
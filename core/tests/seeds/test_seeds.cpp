@@ -169,6 +169,9 @@ SEQAN_BEGIN_TESTSUITE(test_seeds)
 
     // Test global chaining of seeds.
     SEQAN_CALL_TEST(test_seeds_global_chaining_sparse_length);
+    SEQAN_CALL_TEST(test_seeds_global_chaining_range_max_length);
+    SEQAN_CALL_TEST(test_seeds_global_chaining_gap_cost);
+    SEQAN_CALL_TEST(test_seeds_global_chaining_parallel);
 
     // Disabled the test for now.  Extension function contains a
     // force-failure assertion and instruction show to implement this.
@@ -43,6 +43,39 @@
 #include <seqan/seeds.h>  // Include module under test.
 
 
+// Weight of the best chain computed with a quadratic DP over the seeds sorted by begin position.
+template <typename TSeedString>
+unsigned
+_globalChainingWeightQuadratic(TSeedString const & seeds)
+{
+    using namespace seqan;
+
+    typedef typename Value<TSeedString>::Type TSeed;
+
+    String<Pair<unsigned, unsigned> > order;
+    for (unsigned i = 0; i < length(seeds); ++i)
+        appendValue(order, Pair<unsigned, unsigned>(beginPositionH(seeds[i]), i));
+    std::sort(begin(order, Standard()), end(order, Standard()));
+
+    String<unsigned> bestWeight;
+    resize(bestWeight, length(seeds));
+    unsigned result = 0;
+    for (unsigned a = 0; a < length(order); ++a)
+    {
+        TSeed const & seedI = seeds[order[a].i2];
+        unsigned & weightI = bestWeight[order[a].i2];
+        weightI = seedSize(seedI);
+        for (unsigned b = 0; b < a; ++b)
+        {
+            TSeed const & seedJ = seeds[order[b].i2];
+            if (endPositionH(seedJ) <= beginPositionH(seedI) && endPositionV(seedJ) <= beginPositionV(seedI))
+                weightI = _max(weightI, bestWeight[order[b].i2] + (unsigned)seedSize(seedI));
+        }
+        result = _max(result, weightI);
+    }
+    return result;
+}
+
 // Test global chaining weighting the seeds by their length only.
 SEQAN_DEFINE_TEST(test_seeds_global_chaining_sparse_length)
 {
@@ -119,6 +152,231 @@ SEQAN_DEFINE_TEST(test_seeds_global_chaining_sparse_length)
         SEQAN_ASSERT_EQ(1u, length(result));
         SEQAN_ASSERT_EQ(TSeed(0, 93, 281, 342), result[0]);
     }
+    // A seed ending in the same column a later seed starts in can precede it.
+    {
+        TSeedSet seedSet;
+        addSeed(seedSet, TSeed(0, 0, 5), Single());
+        addSeed(seedSet, TSeed(5, 5, 5), Single());
+        addSeed(seedSet, TSeed(1, 6, 3), Single());
+
+        TSeedChain result;
+        chainSeedsGlobally(result, seedSet, SparseChaining());
+
+        SEQAN_ASSERT_EQ(2u, length(result));
+        SEQAN_ASSERT_EQ(TSeed(0, 0, 5), result[0]);
+        SEQAN_ASSERT_EQ(TSeed(5, 5, 5), result[1]);
+    }
+    // Compare the chain weights with a quadratic DP on pseudo-random seeds.
+    {
+        unsigned state = 42;
+        for (unsigned round = 0; round < 20; ++round)
+        {
+            TSeedChain seeds;
+            TSeedSet seedSet;
+            for (unsigned i = 0; i < 100; ++i)
+            {
+                state = state * 1103515245u + 12345u;
+                unsigned beginH = (state >> 8) % 1000;
+                state = state * 1103515245u + 12345u;
+                unsigned beginV = (state >> 8) % 1000;
+                appendValue(seeds, TSeed(beginH, beginV, 1 + (state >> 20) % 20));
+                addSeed(seedSet, back(seeds), Single());
+            }
+
+            TSeedChain result;
+            chainSeedsGlobally(result, seedSet, SparseChaining());
+
+            unsigned weight = 0;
+            for (unsigned i = 0; i < length(result); ++i)
+            {
+                weight += seedSize(result[i]);
+                if (i > 0u)
+                {
+                    SEQAN_ASSERT_LEQ(endPositionH(result[i - 1]), beginPositionH(result[i]));
+                    SEQAN_ASSERT_LEQ(endPositionV(result[i - 1]), beginPositionV(result[i]));
+                }
+            }
+            SEQAN_ASSERT_EQ(_globalChainingWeightQuadratic(seeds), weight);
+        }
+    }
+}
+
+// Test global chaining with the range maximum tree, must give the same chains as sparse chaining.
+SEQAN_DEFINE_TEST(test_seeds_global_chaining_range_max_length)
+{
+    using namespace seqan;
+
+    typedef SeedSet<Simple, Unordered> TSeedSet;
+    typedef Value<TSeedSet>::Type TSeed;
+    typedef String<TSeed> TSeedChain;
+
+    // Test with no seed.
+    {
+        TSeedSet seedSet;
+
+        TSeedChain result;
+        chainSeedsGlobally(result, seedSet, RangeMaxChaining());
+
+        SEQAN_ASSERT_EQ(0u, length(result));
+    }
+    // A bit larger example.
+    {
+        TSeedSet seedSet;
+        addSeed(seedSet, TSeed(0, 0, 2), Single());
+        addSeed(seedSet, TSeed(3, 5, 2), Single());
+        addSeed(seedSet, TSeed(4, 2, 3), Single());
+        addSeed(seedSet, TSeed(9, 9, 2), Single());
+
+        TSeedChain result;
+        chainSeedsGlobally(result, seedSet, RangeMaxChaining());
+
+        SEQAN_ASSERT_EQ(3u, length(result));
+        SEQAN_ASSERT_EQ(TSeed(0, 0, 2), result[0]);
+        SEQAN_ASSERT_EQ(TSeed(4, 2, 3), result[1]);
+        SEQAN_ASSERT_EQ(TSeed(9, 9, 2), result[2]);
+    }
+    // The seeds are all overlapping here.
+    {
+        TSeedChain seeds;
+        appendValue(seeds, TSeed(0, 93, 281, 342));
+        appendValue(seeds, TSeed(3, 237, 127, 364));
+        appendValue(seeds, TSeed(3, 284, 86, 368));
+        appendValue(seeds, TSeed(5, 146, 239, 374));
+
+        TSeedChain result;
+        chainSeedsGlobally(result, seeds, RangeMaxChaining());
+
+        SEQAN_ASSERT_EQ(1u, length(result));
+        SEQAN_ASSERT_EQ(TSeed(0, 93, 281, 342), result[0]);
+    }
+    // Compare the chain weights with sparse chaining on pseudo-random seeds.
+    {
+        unsigned state = 42;
+        for (unsigned round = 0; round < 20; ++round)
+        {
+            TSeedChain seeds;
+            TSeedSet seedSet;
+            for (unsigned i = 0; i < 100; ++i)
+            {
+                state = state * 1103515245u + 12345u;
+                unsigned beginH = (state >> 8) % 1000;
+                state = state * 1103515245u + 12345u;
+                unsigned beginV = (state >> 8) % 1000;
+                appendValue(seeds, TSeed(beginH, beginV, 1 + (state >> 20) % 20));
+                addSeed(seedSet, back(seeds), Single());
+            }
+
+            TSeedChain expected;
+            chainSeedsGlobally(expected, seedSet, SparseChaining());
+            unsigned expectedWeight = 0;
+            for (unsigned i = 0; i < length(expected); ++i)
+                expectedWeight += seedSize(expected[i]);
+
+            TSeedChain result;
+            chainSeedsGlobally(result, seeds, RangeMaxChaining());
+
+            unsigned weight = 0;
+            for (unsigned i = 0; i < length(result); ++i)
+            {
+                weight += seedSize(result[i]);
+                if (i > 0u)
+                {
+                    SEQAN_ASSERT_LEQ(endPositionH(result[i - 1]), beginPositionH(result[i]));
+                    SEQAN_ASSERT_LEQ(endPositionV(result[i - 1]), beginPositionV(result[i]));
+                }
+            }
+            SEQAN_ASSERT_EQ(expectedWeight, weight);
+        }
+    }
+}
+
+// Test global chaining with gap costs and bounded look-back.
+SEQAN_DEFINE_TEST(test_seeds_global_chaining_gap_cost)
+{
+    using namespace seqan;
+
+    typedef Seed<Simple> TSeed;
+    typedef String<TSeed> TSeedChain;
+
+    Score<int, Simple> scoringScheme(1, -1, -1, -2);
+
+    TSeedChain seeds;
+    appendValue(seeds, TSeed(40, 40, 10));
+    appendValue(seeds, TSeed(12, 12, 10));
+    appendValue(seeds, TSeed(24, 30, 5));
+    appendValue(seeds, TSeed(0, 0, 10));
+
+    // The seed off the main diagonal is skipped.
+    {
+        TSeedChain result;
+        int score = chainSeedsGlobally(result, seeds, scoringScheme, GapCostChaining());
+
+        SEQAN_ASSERT_EQ(30, score);
+        SEQAN_ASSERT_EQ(3u, length(result));
+        SEQAN_ASSERT_EQ(TSeed(0, 0, 10), result[0]);
+        SEQAN_ASSERT_EQ(TSeed(12, 12, 10), result[1]);
+        SEQAN_ASSERT_EQ(TSeed(40, 40, 10), result[2]);
+    }
+    // The distance to the last seed is too large.
+    {
+        TSeedChain result;
+        int score = chainSeedsGlobally(result, seeds, scoringScheme, GapCostChaining(10, 50));
+
+        SEQAN_ASSERT_EQ(20, score);
+        SEQAN_ASSERT_EQ(2u, length(result));
+        SEQAN_ASSERT_EQ(TSeed(0, 0, 10), result[0]);
+        SEQAN_ASSERT_EQ(TSeed(12, 12, 10), result[1]);
+    }
+    // Only the closest predecessor is considered.
+    {
+        TSeedChain result;
+        int score = chainSeedsGlobally(result, seeds, scoringScheme, GapCostChaining(5000, 1));
+
+        SEQAN_ASSERT_EQ(21, score);
+        SEQAN_ASSERT_EQ(4u, length(result));
+        SEQAN_ASSERT_EQ(TSeed(24, 30, 5), result[2]);
+    }
+}
+
+// Test chaining independent seed sets in parallel.
+SEQAN_DEFINE_TEST(test_seeds_global_chaining_parallel)
+{
+    using namespace seqan;
+
+    typedef SeedSet<Simple, Unordered> TSeedSet;
+    typedef Value<TSeedSet>::Type TSeed;
+    typedef String<TSeed> TSeedChain;
+
+    String<TSeedSet> seedSets;
+    resize(seedSets, 10);
+    for (unsigned i = 0; i < length(seedSets); ++i)
+        for (unsigned j = 0; j <= i; ++j)
+        {
+            addSeed(seedSets[i], TSeed(10 * j, 10 * j, 5), Single());
+            addSeed(seedSets[i], TSeed(10 * j + 2, 10 * j + 1, 3), Single());
+        }
+
+    String<TSeedChain> results;
+    chainSeedsGlobally(results, seedSets, RangeMaxChaining(), Parallel());
+    SEQAN_ASSERT_EQ(length(seedSets), length(results));
+    for (unsigned i = 0; i < length(seedSets); ++i)
+    {
+        TSeedChain expected;
+        chainSeedsGlobally(expected, seedSets[i], SparseChaining());
+        SEQAN_ASSERT_EQ(length(expected), length(results[i]));
+        for (unsigned j = 0; j < length(expected); ++j)
+            SEQAN_ASSERT_EQ(expected[j], results[i][j]);
+    }
+
+    Score<int, Simple> scoringScheme(1, -1, -1, -2);
+    chainSeedsGlobally(results, seedSets, scoringScheme, GapCostChaining(), Parallel());
+    SEQAN_ASSERT_EQ(length(seedSets), length(results));
+    for (unsigned i = 0; i < length(seedSets); ++i)
+    {
+        SEQAN_ASSERT_EQ(i + 1, length(results[i]));
+        for (unsigned j = 0; j <= i; ++j)
+            SEQAN_ASSERT_EQ(TSeed(10 * j, 10 * j, 5), results[i][j]);
+    }
 }
 
 #endif  // TEST_SEEDS_TEST_SEEDS_GLOBAL_CHAINING_H_
@@ -35,6 +35,7 @@
 #ifndef CORE_TESTS_SEQ_IO_TEST_FAI_INDEX_H_
 #define CORE_TESTS_SEQ_IO_TEST_FAI_INDEX_H_
 
+#include <seqan/random.h>
 #include <seqan/seq_io.h>
 
 SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_build)
@@ -139,4 +140,128 @@ SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_read_region)
     }
 }
 
+SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_read_region_view)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/seq_io/adeno_genome.fa");
+
+    seqan::FaiIndex faiIndex;
+    SEQAN_ASSERT_EQ(read(faiIndex, toCString(filePath)), 0);
+
+    seqan::Dna5String seq;
+    SEQAN_ASSERT_EQ(readSequence(seq, faiIndex, 0), 0);
+
+    // Regions within a line, across line breaks and over the end of the sequence.
+    unsigned const regions[][2] = {{100, 110}, {65, 75}, {0, 4718}, {4708, 10000}, {300, 300}, {5000, 6000}};
+    for (unsigned i = 0; i < 6u; ++i)
+    {
+        seqan::FaiRegionView view;
+        SEQAN_ASSERT_EQ(readRegion(view, faiIndex, 0, regions[i][0], regions[i][1]), 0);
+        unsigned beginPos = std::min(regions[i][0], 4718u);
+        unsigned endPos = std::min(regions[i][1], 4718u);
+        SEQAN_ASSERT_EQ(length(view), endPos - beginPos);
+
+        seqan::Dna5String str;
+        typedef seqan::Iterator<seqan::FaiRegionView const, seqan::Standard>::Type TIter;
+        for (TIter it = begin(view, seqan::Standard()); it != end(view, seqan::Standard()); ++it)
+            appendValue(str, *it);
+        SEQAN_ASSERT_EQ(str, infix(seq, beginPos, endPos));
+
+        // Random access and going backwards.
+        for (unsigned j = 0; j < length(view); j += 37)
+        {
+            SEQAN_ASSERT_EQ(seqan::Dna5(value(view, j)), seq[beginPos + j]);
+            SEQAN_ASSERT_EQ(seqan::Dna5(*(begin(view, seqan::Standard()) + j)), seq[beginPos + j]);
+        }
+        if (!empty(view))
+        {
+            TIter it = end(view, seqan::Standard());
+            --it;
+            SEQAN_ASSERT_EQ(seqan::Dna5(*it), seq[endPos - 1]);
+            SEQAN_ASSERT_EQ(end(view, seqan::Standard()) - begin(view, seqan::Standard()), (__int64)length(view));
+        }
+    }
+
+    seqan::FaiRegionView view;
+    SEQAN_ASSERT_EQ(readRegion(view, faiIndex, 2, 0, 10), 1);
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_region_cache)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/seq_io/adeno_genome.fa");
+
+    seqan::FaiIndex faiIndex;
+    SEQAN_ASSERT_EQ(read(faiIndex, toCString(filePath)), 0);
+
+    // A small cache with small windows, so windows are evicted and decoded again.
+    seqan::FaiRegionCache<seqan::Dna5String> cache(faiIndex, 3, 100);
+    seqan::Rng<seqan::MersenneTwister> rng(42);
+    for (unsigned i = 0; i < 500; ++i)
+    {
+        unsigned refId = (i % 10 == 0u);
+        unsigned seqLen = sequenceLength(faiIndex, refId);
+        unsigned beginPos = pickRandomNumber(rng) % (seqLen + 10);
+        unsigned endPos = beginPos + pickRandomNumber(rng) % 250;
+
+        seqan::Dna5String expected, str;
+        SEQAN_ASSERT_EQ(readRegion(expected, faiIndex, refId, beginPos, endPos), 0);
+        SEQAN_ASSERT_EQ(readRegion(str, cache, refId, beginPos, endPos), 0);
+        SEQAN_ASSERT_EQ(str, expected);
+        SEQAN_ASSERT_LEQ(length(cache._windows), 3u);
+    }
+
+    clear(cache);
+    seqan::Dna5String str;
+    SEQAN_ASSERT_EQ(readRegion(str, cache, 0, 100, 110), 0);
+    SEQAN_ASSERT_EQ(str, "GAGCGCGCAG");
+    SEQAN_ASSERT_EQ(readRegion(str, cache, 2, 100, 110), 1);
+}
+
+#if SEQAN_HAS_ZLIB
+SEQAN_DEFINE_TEST(test_seq_io_genomic_fai_index_read_region_bgzf)
+{
+    // The compressed file has blocks of 1000 uncompressed bytes, so regions span several blocks.
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/seq_io/adeno_genome.fa");
+    seqan::CharString gzPath = filePath;
+    append(gzPath, ".gz");
+
+    seqan::FaiIndex faiIndex, gzFaiIndex;
+    SEQAN_ASSERT_EQ(read(faiIndex, toCString(filePath)), 0);
+    SEQAN_ASSERT_EQ(read(gzFaiIndex, toCString(gzPath)), 0);
+    SEQAN_ASSERT_EQ(numSeqs(gzFaiIndex), 2u);
+
+    seqan::Dna5String str;
+    SEQAN_ASSERT_EQ(readRegion(str, gzFaiIndex, 0, 100, 110), 0);
+    SEQAN_ASSERT_EQ(str, "GAGCGCGCAG");
+    SEQAN_ASSERT_EQ(readRegion(str, gzFaiIndex, 0, 4708, 10000), 0);
+    SEQAN_ASSERT_EQ(str, "GAGTGGGCAA");
+    SEQAN_ASSERT_EQ(readSequence(str, gzFaiIndex, 1), 0);
+    SEQAN_ASSERT_EQ(length(str), 8u);
+
+    seqan::Rng<seqan::MersenneTwister> rng(7);
+    for (unsigned i = 0; i < 300; ++i)
+    {
+        unsigned refId = (i % 10 == 0u);
+        unsigned beginPos = pickRandomNumber(rng) % (sequenceLength(faiIndex, refId) + 10);
+        unsigned endPos = beginPos + pickRandomNumber(rng) % 2500;
+
+        seqan::Dna5String expected;
+        SEQAN_ASSERT_EQ(readRegion(expected, faiIndex, refId, beginPos, endPos), 0);
+        SEQAN_ASSERT_EQ(readRegion(str, gzFaiIndex, refId, beginPos, endPos), 0);
+        SEQAN_ASSERT_EQ(str, expected);
+    }
+
+    // Views need the uncompressed file, the cache works on both.
+    seqan::FaiRegionView view;
+    SEQAN_ASSERT_EQ(readRegion(view, gzFaiIndex, 0, 100, 110), 1);
+    seqan::FaiRegionCache<seqan::Dna5String> cache(gzFaiIndex, 2, 500);
+    SEQAN_ASSERT_EQ(readRegion(str, cache, 0, 990, 2010), 0);
+    seqan::Dna5String expected;
+    SEQAN_ASSERT_EQ(readRegion(expected, faiIndex, 0, 990, 2010), 0);
+    SEQAN_ASSERT_EQ(str, expected);
+}
+#endif  // #if SEQAN_HAS_ZLIB
+
 #endif  // #ifndef CORE_TESTS_SEQ_IO_TEST_FAI_INDEX_H_
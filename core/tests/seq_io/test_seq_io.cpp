@@ -66,6 +66,10 @@ SEQAN_BEGIN_TESTSUITE(test_seq_io)
     SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_record_text_fasta);
     SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_batch_text_fasta);
     SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_all_text_fasta);
+    SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_batch_parallel_text_fasta);
+    SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_batch_parallel_equal);
+    SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_record_parallel);
+    SEQAN_CALL_TEST(test_seq_io_sequence_stream_read_all_parallel_fastq_at_quals);
 
     // Test writing with different interfaces.
     SEQAN_CALL_TEST(test_seq_io_sequence_stream_write_record_text_fasta);
@@ -89,6 +93,11 @@ SEQAN_BEGIN_TESTSUITE(test_seq_io)
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read);
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_sequence);
     SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_region);
+    SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_region_view);
+    SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_region_cache);
+#if SEQAN_HAS_ZLIB
+    SEQAN_CALL_TEST(test_seq_io_genomic_fai_index_read_region_bgzf);
+#endif  // #if SEQAN_HAS_ZLIB
 
     // -------------- File format specific code ------------------
 
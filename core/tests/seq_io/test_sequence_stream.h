@@ -206,6 +206,162 @@ SEQAN_DEFINE_TEST(test_seq_io_sequence_stream_read_batch_text_fasta)
     SEQAN_ASSERT(isGood(seqIO));
 }
 
+SEQAN_DEFINE_TEST(test_seq_io_sequence_stream_read_batch_parallel_text_fasta)
+{
+    // Build path to file.
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/seq_io/test_dna.fa");
+
+    // Create SequenceStream object.
+    seqan::SequenceStream seqIO(toCString(filePath), seqan::SequenceStream::READ_PARALLEL);
+    SEQAN_ASSERT(isGood(seqIO));
+
+    seqan::StringSet<seqan::CharString> ids;
+    seqan::StringSet<seqan::Dna5String> seqs;
+
+    SEQAN_ASSERT_EQ(0, readBatch(ids, seqs, seqIO, 2));
+    SEQAN_ASSERT_EQ(length(seqs), 2u);
+    SEQAN_ASSERT_EQ(ids[0], "seq1");
+    SEQAN_ASSERT_EQ(seqs[0], "CGATCGATAAT");
+    SEQAN_ASSERT_EQ(ids[1], "seq2");
+    SEQAN_ASSERT_EQ(seqs[1], "CCTCTCTCTCCCT");
+
+    SEQAN_ASSERT_EQ(0, readBatch(ids, seqs, seqIO, 2));
+    SEQAN_ASSERT_EQ(length(seqs), 1u);
+    SEQAN_ASSERT_EQ(ids[0], "seq3");
+    SEQAN_ASSERT_EQ(seqs[0], "CCCCCCCC");
+
+    SEQAN_ASSERT(atEnd(seqIO));
+    SEQAN_ASSERT(isGood(seqIO));
+}
+
+// Read a file in normal and in parallel mode with small chunks and compare the records.
+
+inline void
+_testSequenceStreamParallelEqual(char const * filePath, unsigned chunkSize, unsigned numThreads, unsigned batchSize)
+{
+    seqan::SequenceStream seqIO(filePath);
+    seqan::SequenceStream seqIOPar(filePath, seqan::SequenceStream::READ_PARALLEL);
+    SEQAN_ASSERT(isGood(seqIO));
+    SEQAN_ASSERT(isGood(seqIOPar));
+    setParallelChunkSize(seqIOPar, chunkSize);
+    setParallelThreads(seqIOPar, numThreads);
+
+    seqan::StringSet<seqan::CharString> ids, idsPar, quals, qualsPar;
+    seqan::StringSet<seqan::Dna5String> seqs, seqsPar;
+    unsigned numRecords = 0;
+    while (!atEnd(seqIO))
+    {
+        SEQAN_ASSERT_NOT(atEnd(seqIOPar));
+        SEQAN_ASSERT_EQ(0, readBatch(ids, seqs, quals, seqIO, batchSize));
+        SEQAN_ASSERT_EQ(0, readBatch(idsPar, seqsPar, qualsPar, seqIOPar, batchSize));
+        SEQAN_ASSERT_EQ(length(ids), length(idsPar));
+        for (unsigned i = 0; i < length(ids); ++i)
+        {
+            SEQAN_ASSERT_EQ(ids[i], idsPar[i]);
+            SEQAN_ASSERT_EQ(seqs[i], seqsPar[i]);
+            SEQAN_ASSERT_EQ(quals[i], qualsPar[i]);
+        }
+        numRecords += length(ids);
+    }
+    SEQAN_ASSERT_GT(numRecords, 0u);
+    SEQAN_ASSERT(atEnd(seqIOPar));
+    SEQAN_ASSERT(isGood(seqIOPar));
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_sequence_stream_read_batch_parallel_equal)
+{
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/seq_io/SRR067601_1.1k.fasta");
+    _testSequenceStreamParallelEqual(toCString(filePath), 1000, 3, 37);
+    _testSequenceStreamParallelEqual(toCString(filePath), 100000, 1, 1000);
+
+#if SEQAN_HAS_ZLIB
+    append(filePath, ".gz");
+    _testSequenceStreamParallelEqual(toCString(filePath), 1000, 3, 37);
+#endif  // #if SEQAN_HAS_ZLIB
+
+    seqan::CharString fqPath = SEQAN_PATH_TO_ROOT();
+    append(fqPath, "/core/tests/seq_io/test_dna.fq");
+    _testSequenceStreamParallelEqual(toCString(fqPath), 10, 2, 1);
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_sequence_stream_read_record_parallel)
+{
+    // Single records are served from the records parsed for the previous calls.
+    seqan::CharString filePath = SEQAN_PATH_TO_ROOT();
+    append(filePath, "/core/tests/seq_io/test_dna.fq");
+
+    seqan::SequenceStream seqIO(toCString(filePath));
+    seqan::SequenceStream seqIOPar(toCString(filePath), seqan::SequenceStream::READ_PARALLEL);
+    SEQAN_ASSERT(isGood(seqIOPar));
+    setParallelChunkSize(seqIOPar, 20);
+    setParallelThreads(seqIOPar, 4);
+
+    seqan::CharString id, idPar, qual, qualPar;
+    seqan::String<seqan::Dna5Q> seq, seqPar;
+    unsigned numRecords = 0;
+    while (!atEnd(seqIO))
+    {
+        SEQAN_ASSERT_NOT(atEnd(seqIOPar));
+        SEQAN_ASSERT_EQ(0, readRecord(id, seq, seqIO));
+        SEQAN_ASSERT_EQ(0, readRecord(idPar, seqPar, seqIOPar));
+        SEQAN_ASSERT_EQ(id, idPar);
+        SEQAN_ASSERT_EQ(length(seq), length(seqPar));
+        for (unsigned i = 0; i < length(seq); ++i)
+        {
+            SEQAN_ASSERT_EQ(seq[i], seqPar[i]);
+            SEQAN_ASSERT_EQ(getQualityValue(seq[i]), getQualityValue(seqPar[i]));
+        }
+        ++numRecords;
+    }
+    SEQAN_ASSERT_EQ(numRecords, 3u);
+    SEQAN_ASSERT(atEnd(seqIOPar));
+    SEQAN_ASSERT(isGood(seqIOPar));
+    SEQAN_ASSERT_NEQ(0, readRecord(idPar, seqPar, seqIOPar));
+}
+
+SEQAN_DEFINE_TEST(test_seq_io_sequence_stream_read_all_parallel_fastq_at_quals)
+{
+    // Quality lines that start with '@' and '+' must not be taken for record boundaries.
+    seqan::CharString filePath = SEQAN_TEMP_FILENAME();
+    append(filePath, ".fq");
+    {
+        std::ofstream out(toCString(filePath), std::ios::binary | std::ios::out);
+        for (unsigned i = 0; i < 200; ++i)
+        {
+            unsigned len = 5 + i % 7;
+            out << "@r" << i << "\n" << std::string(len, "ACGT"[i % 4]) << "\n" << ((i % 2) ? "+\n" : "+r");
+            if (i % 2 == 0)
+                out << i << "\n";
+            out << ((i % 3) ? "@" : "+") << std::string(len - 1, (i % 5) ? '@' : 'I') << "\n";
+        }
+    }
+
+    seqan::SequenceStream seqIO(toCString(filePath));
+    seqan::StringSet<seqan::CharString> ids, quals;
+    seqan::StringSet<seqan::Dna5String> seqs;
+    SEQAN_ASSERT_EQ(0, readAll(ids, seqs, quals, seqIO));
+    SEQAN_ASSERT_EQ(length(ids), 200u);
+
+    for (unsigned chunkSize = 8; chunkSize < 200; chunkSize += 37)
+    {
+        seqan::SequenceStream seqIOPar(toCString(filePath), seqan::SequenceStream::READ_PARALLEL);
+        setParallelChunkSize(seqIOPar, chunkSize);
+        seqan::StringSet<seqan::CharString> idsPar, qualsPar;
+        seqan::StringSet<seqan::Dna5String> seqsPar;
+        SEQAN_ASSERT_EQ(0, readAll(idsPar, seqsPar, qualsPar, seqIOPar));
+        SEQAN_ASSERT_EQ(length(idsPar), 200u);
+        for (unsigned i = 0; i < length(ids); ++i)
+        {
+            SEQAN_ASSERT_EQ(ids[i], idsPar[i]);
+            SEQAN_ASSERT_EQ(seqs[i], seqsPar[i]);
+            SEQAN_ASSERT_EQ(quals[i], qualsPar[i]);
+        }
+        SEQAN_ASSERT(atEnd(seqIOPar));
+    }
+}
+
 SEQAN_DEFINE_TEST(test_seq_io_sequence_stream_read_all_text_fasta)
 {
     // Build path to file.
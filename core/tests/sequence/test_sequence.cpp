@@ -103,6 +103,7 @@ SEQAN_BEGIN_TESTSUITE(Sequence tests)
     SEQAN_CALL_TEST(test_find_motif_memory_leak_ticket_364);
     SEQAN_CALL_TEST(ticket901);
     SEQAN_CALL_TEST(ticket1108);
+    SEQAN_CALL_TEST(test_sequence_append_char_span);
 
     // -----------------------------------------------------------------------
     // Checkpoint Verification
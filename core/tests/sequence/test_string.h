@@ -1327,3 +1327,50 @@ SEQAN_DEFINE_TEST(ticket1108)
         }
     }
 }
+
+// Compare bulk appending of characters to appending them one by one.
+template <typename TString>
+void testAppendCharSpan()
+{
+    using namespace seqan;
+
+    char const * CHARS = "ACGTUNacgtunRYKMSWBDHVX-*.7 >";
+    CharString text;
+    for (unsigned i = 0; i < 200; ++i)
+        appendValue(text, CHARS[(i * 7 + i / 13) % 29]);
+
+    for (unsigned prefixLen = 0; prefixLen < 40; prefixLen += 3)
+    {
+        for (unsigned spanLen = 0; spanLen < 150; spanLen += 17)
+        {
+            char const * it = toCString(text) + prefixLen;
+            TString str, expected;
+            for (unsigned i = 0; i < prefixLen; ++i)
+                appendValue(expected, text[i]);
+            str = expected;
+            for (unsigned i = 0; i < spanLen; ++i)
+                appendValue(expected, it[i]);
+            _appendCharSpan(str, it, it + spanLen);
+            SEQAN_ASSERT_EQ(length(str), length(expected));
+            SEQAN_ASSERT(str == expected);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_sequence_append_char_span)
+{
+    using namespace seqan;
+
+    testAppendCharSpan<CharString>();
+    testAppendCharSpan<DnaString>();
+    testAppendCharSpan<Dna5String>();
+    testAppendCharSpan<RnaString>();
+    testAppendCharSpan<Rna5String>();
+    testAppendCharSpan<IupacString>();
+    testAppendCharSpan<Peptide>();
+    testAppendCharSpan<String<Dna, Packed<> > >();
+    testAppendCharSpan<String<Dna5, Packed<> > >();
+    testAppendCharSpan<String<Rna5, Packed<> > >();
+    testAppendCharSpan<String<Iupac, Packed<> > >();
+    testAppendCharSpan<String<Dna5, Block<> > >();
+}
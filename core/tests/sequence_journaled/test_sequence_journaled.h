@@ -1361,4 +1361,240 @@ SEQAN_DEFINE_TEST(test_sequence_journaled_sorted_array_flatten)
     testJournalStringFlatten(SortedArray());
 }
 
+// Tag: BalancedTree()
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_assign) {
+    testJournaledStringAssign(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_set) {
+    testJournaledStringSet(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_host) {
+    testJournaledStringHost(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_clear) {
+    testJournaledStringClear(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_erase_position) {
+    testJournaledStringErasePosition(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_erase_begin_end) {
+    testJournaledStringEraseBeginEnd(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_insert) {
+    testJournaledStringInsert(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_insert_value) {
+    testJournaledStringInsertValue(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_assign_value) {
+    testJournaledStringAssignValue(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_subscript_operator) {
+    testJournaledStringSubscriptOperator(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_assign_infix) {
+    testJournaledStringAssignInfix(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_length) {
+    testJournaledStringLength(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_virtual_to_host_position) {
+    testJournaledStringVirtualToHostPosition<BalancedTree>();
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_host_to_virtual_position)
+{
+    testJournaledStringHostToVirtualPosition<BalancedTree>();
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_reset)
+{
+    testJournaledStringReset(seqan::BalancedTree());
+}
+
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_copy_constructor) {
+    testJournaledStringCopyConstructor(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_begin_end_iterator) {
+    testJournaledStringBeginEndIteratorStandard(BalancedTree());
+    testJournaledStringBeginEndIteratorRooted(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_begin_end_const_iterator) {
+    testJournaledStringBeginEndConstIterator(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_subscript_operator_randomized) {
+    testJournaledStringSubscriptOperatorRandomized(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_fuzzying) {
+    testJournaledStringFuzzying(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_segments_read_only) {
+    testJournaledStringSegmentsReadOnly(BalancedTree());
+}
+
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_segments_read_write) {
+    testJournaledStringReplace(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_flatten)
+{
+    testJournalStringFlatten(BalancedTree());
+}
+
+
+// Compare the balanced tree with the sorted array on an insertion heavy workload.
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_insertion_heavy)
+{
+    typedef String<char, Journaled<Alloc<>, SortedArray> > TSortedArrayString;
+    typedef String<char, Journaled<Alloc<>, BalancedTree> > TBalancedTreeString;
+
+    CharString hostStr;
+    for (unsigned i = 0; i < 1000; ++i)
+        appendValue(hostStr, 'A' + i % 4);
+    TSortedArrayString expected(hostStr);
+    TBalancedTreeString actual(hostStr);
+
+    Rng<> rng(42);
+    for (unsigned i = 0; i < 2000; ++i)
+    {
+        unsigned pos = pickRandomNumber(rng) % (length(expected) + 1);
+        CharString ins = "xyz";
+        resize(ins, 1 + pickRandomNumber(rng) % 3);
+        insert(expected, pos, ins);
+        insert(actual, pos, ins);
+    }
+
+    SEQAN_ASSERT_EQ(length(expected), length(actual));
+    SEQAN_ASSERT_EQ(length(expected._journalEntries._journalNodes), length(actual._journalEntries));
+    for (unsigned i = 0; i < length(expected); i += 7)
+    {
+        SEQAN_ASSERT_EQ(getValue(expected, i), getValue(actual, i));
+        SEQAN_ASSERT_EQ(virtualToHostPosition(expected, i), virtualToHostPosition(actual, i));
+        SEQAN_ASSERT_EQ(isGapInHost(expected, i), isGapInHost(actual, i));
+    }
+    // The entries are the same, including the origin positions.
+    typedef Iterator<TBalancedTreeString::TJournalEntries const, Standard>::Type TIterator;
+    unsigned k = 0;
+    for (TIterator it = begin(actual._journalEntries, Standard()); !atEnd(it); ++it, ++k)
+    {
+        SEQAN_ASSERT_EQ(value(it).segmentSource, expected._journalEntries._journalNodes[k].segmentSource);
+        SEQAN_ASSERT_EQ(value(it).virtualPosition, expected._journalEntries._journalNodes[k].virtualPosition);
+        SEQAN_ASSERT_EQ(value(it).physicalPosition, expected._journalEntries._journalNodes[k].physicalPosition);
+        SEQAN_ASSERT_EQ(value(it).physicalOriginPosition,
+                        expected._journalEntries._journalNodes[k].physicalOriginPosition);
+        SEQAN_ASSERT_EQ(value(it).length, expected._journalEntries._journalNodes[k].length);
+    }
+
+    for (unsigned i = 0; i < length(hostStr); ++i)
+        SEQAN_ASSERT_EQ(hostToVirtualPosition(expected, i), hostToVirtualPosition(actual, i));
+
+    // Mix in erasures spanning several entries and compare with a plain string.
+    std::string plain(toCString(hostStr));
+    TBalancedTreeString mixed(hostStr);
+    for (unsigned i = 0; i < 3000; ++i)
+    {
+        unsigned pos = pickRandomNumber(rng) % (plain.size() + 1);
+        if (pickRandomNumber(rng) % 3 == 0 && pos < plain.size())
+        {
+            unsigned posEnd = _min(pos + 1 + pickRandomNumber(rng) % 10, (unsigned)plain.size());
+            plain.erase(pos, posEnd - pos);
+            erase(mixed, pos, posEnd);
+        }
+        else
+        {
+            std::string ins = std::string("xyz").substr(0, 1 + pickRandomNumber(rng) % 3);
+            plain.insert(pos, ins);
+            insert(mixed, pos, ins);
+        }
+    }
+    std::stringstream ssMixed;
+    ssMixed << mixed;
+    SEQAN_ASSERT_EQ(ssMixed.str(), plain);
+    for (unsigned i = 0; i < plain.size(); i += 3)
+        SEQAN_ASSERT_EQ(getValue(mixed, i), plain[i]);
+
+    // Erase everything and start over.
+    erase(mixed, 0, length(mixed));
+    SEQAN_ASSERT_EQ(length(mixed._journalEntries), 0u);
+    insert(mixed, 0, "ACGT");
+    std::stringstream ssEmpty;
+    ssEmpty << mixed;
+    SEQAN_ASSERT_EQ(ssEmpty.str(), "ACGT");
+}
+
+// Bulk loading sorted entries gives the same string as recording the edits.
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_bulk_load)
+{
+    typedef String<char, Journaled<Alloc<>, BalancedTree> > TJournaledString;
+    typedef TJournaledString::TJournalEntry TEntry;
+
+    CharString hostStr = "ACGTACGTACGT";
+    TJournaledString expected(hostStr);
+    insert(expected, 10, "xx");
+    erase(expected, 4, 6);
+    insert(expected, 0, "y");
+
+    // "y" "ACGT" "ACGT" "xx" "GT"
+    String<TEntry> entries;
+    appendValue(entries, TEntry(SOURCE_PATCH, 2, 0, 0, 1));
+    appendValue(entries, TEntry(SOURCE_ORIGINAL, 0, 1, 0, 4));
+    appendValue(entries, TEntry(SOURCE_ORIGINAL, 6, 5, 6, 4));
+    appendValue(entries, TEntry(SOURCE_PATCH, 0, 9, 6, 2));
+    appendValue(entries, TEntry(SOURCE_ORIGINAL, 10, 11, 10, 2));
+
+    TJournaledString actual(hostStr);
+    _bulkLoadJournalEntries(actual._journalEntries, entries);
+    actual._insertionBuffer = "xxy";
+    actual._length = 13;
+
+    SEQAN_ASSERT_EQ(length(actual._journalEntries), 5u);
+    std::stringstream ssExpected, ssActual;
+    ssExpected << expected;
+    ssActual << actual;
+    SEQAN_ASSERT_EQ(ssExpected.str(), "yACGTGTACxxGT");
+    SEQAN_ASSERT_EQ(ssExpected.str(), ssActual.str());
+    for (unsigned i = 0; i < length(actual); ++i)
+        SEQAN_ASSERT_EQ(getValue(expected, i), getValue(actual, i));
+    for (unsigned i = 0; i < length(hostStr); ++i)
+        SEQAN_ASSERT_EQ(hostToVirtualPosition(expected, i), hostToVirtualPosition(actual, i));
+}
+
 #endif  // TEST_SEQUENCE_JOURNALED_TEST_SEQUENCE_JOURNALED_H_
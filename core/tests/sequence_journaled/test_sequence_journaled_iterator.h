@@ -607,4 +607,61 @@ SEQAN_DEFINE_TEST(test_sequence_journaled_sorted_array_iterator_rooted_container
     testJournaledStringIteratorContainer(SortedArray());
 }
 
+// Tag: BalancedTree()
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_difference)
+{
+    testJournaledStringIteratorDifference(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_sum)
+{
+    testJournaledStringIteratorSum(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_relations)
+{
+    testJournaledStringIteratorRelations(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_decrement)
+{
+    testJournaledStringIteratorDecrement(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_set_position)
+{
+    testJournaledStringIteratorSetPosition(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_position)
+{
+    testJournaledStringIteratorPosition(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_rooted_at_begin)
+{
+    testJournaledStringIteratorAtBegin(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_rooted_at_end)
+{
+    testJournaledStringIteratorAtEnd(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_rooted_go_begin)
+{
+    testJournaledStringIteratorGoBegin(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_rooted_go_end)
+{
+    testJournaledStringIteratorGoEnd(BalancedTree());
+}
+
+SEQAN_DEFINE_TEST(test_sequence_journaled_balanced_tree_iterator_rooted_container)
+{
+    testJournaledStringIteratorContainer(BalancedTree());
+}
+
 #endif  // TEST_SEQUENCE_JOURNALED_TEST_SEQUENCE_JOURNALED_ITERATOR_H_
@@ -38,6 +38,10 @@
 
 #include <seqan/basic.h>
 #include "test_store_io.h"
+#include "test_store_intervaltree.h"
+#include "test_store_io_snapshot.h"
+#include "test_store_io_bam_region.h"
+#include "test_store_align.h"
 
 SEQAN_BEGIN_TESTSUITE(test_store)
 {
@@ -61,6 +65,22 @@ SEQAN_BEGIN_TESTSUITE(test_store)
     SEQAN_CALL_TEST(test_store_io_sam);
 #if SEQAN_HAS_ZLIB
     SEQAN_CALL_TEST(test_store_io_read_bam);
+
+    // Loading genomic windows from an indexed BAM file.
+    SEQAN_CALL_TEST(test_store_io_bam_region_load);
+    SEQAN_CALL_TEST(test_store_io_bam_region_whole_reference);
 #endif  // #if SEQAN_HAS_ZLIB
+
+    // Overlap join of aligned reads and annotations.
+    SEQAN_CALL_TEST(test_store_intervaltree_find_annotation_overlaps);
+    SEQAN_CALL_TEST(test_store_intervaltree_count_annotation_overlaps);
+
+    // Binary snapshots.
+    SEQAN_CALL_TEST(test_store_io_snapshot_round_trip);
+    SEQAN_CALL_TEST(test_store_io_snapshot_reject);
+
+    // Sorting aligned reads.
+    SEQAN_CALL_TEST(test_store_align_sort_parallel);
+    SEQAN_CALL_TEST(test_store_align_permute);
 }
 SEQAN_END_TESTSUITE
@@ -0,0 +1,150 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for sorting the aligned read store.
+// ==========================================================================
+
+#ifndef SEQAN_TESTS_STORE_TEST_STORE_ALIGN_H_
+#define SEQAN_TESTS_STORE_TEST_STORE_ALIGN_H_
+
+#include <seqan/basic.h>
+#include <seqan/random.h>
+#include <seqan/store.h>
+
+using namespace seqan;
+
+// Fill the store with enough alignments for several slices and many equal keys.
+template <typename TAlignedReadStore>
+void testStoreAlignFill(TAlignedReadStore & alignStore, unsigned count)
+{
+    typedef typename Value<TAlignedReadStore>::Type TAlignedRead;
+
+    Rng<MersenneTwister> rng(42);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        TAlignedRead el;
+        el.id = i;
+        el.readId = pickRandomNumber(rng) % 1000;
+        el.contigId = pickRandomNumber(rng) % 5;
+        el.pairMatchId = pickRandomNumber(rng) % 100;
+        el.beginPos = pickRandomNumber(rng) % 500;
+        el.endPos = pickRandomNumber(rng) % 500;
+        appendValue(el.gaps, typename TAlignedRead::TGapAnchor(i % 7, i % 11));
+        appendValue(alignStore, el);
+    }
+}
+
+template <typename TAlignedReadStore>
+void testStoreAlignEqual(TAlignedReadStore const & a, TAlignedReadStore const & b)
+{
+    SEQAN_ASSERT_EQ(length(a), length(b));
+    for (unsigned i = 0; i < length(a); ++i)
+    {
+        SEQAN_ASSERT_EQ(a[i].id, b[i].id);
+        SEQAN_ASSERT_EQ(length(a[i].gaps), length(b[i].gaps));
+        SEQAN_ASSERT(a[i].gaps == b[i].gaps);
+    }
+}
+
+template <typename TSortTag>
+void testStoreAlignSortParallel(TSortTag const & tag)
+{
+    typedef FragmentStore<>::TAlignedReadStore TAlignedReadStore;
+
+    TAlignedReadStore expected;
+    testStoreAlignFill(expected, 100000);
+    TAlignedReadStore actual = expected;
+
+    sortAlignedReads(expected, tag);
+    sortAlignedReads(actual, tag, Parallel());
+    testStoreAlignEqual(expected, actual);
+}
+
+SEQAN_DEFINE_TEST(test_store_align_sort_parallel)
+{
+    testStoreAlignSortParallel(SortId());
+    testStoreAlignSortParallel(SortContigId());
+    testStoreAlignSortParallel(SortBeginPos());
+    testStoreAlignSortParallel(SortEndPos());
+    testStoreAlignSortParallel(SortPairMatchId());
+    testStoreAlignSortParallel(SortReadId());
+
+    // The two-key order used by the store functions.
+    typedef FragmentStore<>::TAlignedReadStore TAlignedReadStore;
+
+    TAlignedReadStore expected;
+    testStoreAlignFill(expected, 1000);
+    TAlignedReadStore actual = expected;
+
+    sortAlignedReads(expected, SortBeginPos());
+    sortAlignedReads(expected, SortContigId());
+    sortAlignedReads(actual, SortBeginPos(), Parallel());
+    sortAlignedReads(actual, SortContigId(), Parallel());
+    testStoreAlignEqual(expected, actual);
+
+    // Empty stores.
+    TAlignedReadStore emptyStore;
+    sortAlignedReads(emptyStore, SortBeginPos(), Parallel());
+    SEQAN_ASSERT(empty(emptyStore));
+}
+
+SEQAN_DEFINE_TEST(test_store_align_permute)
+{
+    typedef FragmentStore<>::TAlignedReadStore TAlignedReadStore;
+
+    TAlignedReadStore alignStore;
+    testStoreAlignFill(alignStore, 1000);
+
+    // A column with the same order as the store.
+    String<unsigned> column;
+    for (unsigned i = 0; i < length(alignStore); ++i)
+        appendValue(column, alignStore[i].id * 3);
+
+    String<unsigned> perm;
+    orderAlignedReads(perm, alignStore, SortContigId(), Parallel());
+    SEQAN_ASSERT_EQ(length(perm), length(alignStore));
+
+    permuteAlignedReads(alignStore, perm, Parallel());
+    permuteAlignedReads(column, perm, Parallel());
+    for (unsigned i = 0; i < length(alignStore); ++i)
+    {
+        SEQAN_ASSERT_EQ(alignStore[i].id, perm[i]);
+        SEQAN_ASSERT_EQ(column[i], alignStore[i].id * 3);
+        if (i > 0)
+            SEQAN_ASSERT(alignStore[i - 1].contigId < alignStore[i].contigId ||
+                         (alignStore[i - 1].contigId == alignStore[i].contigId &&
+                          alignStore[i - 1].id < alignStore[i].id));
+    }
+}
+
+#endif  // SEQAN_TESTS_STORE_TEST_STORE_ALIGN_H_
@@ -0,0 +1,166 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for the overlap join of aligned reads and annotations.
+// ==========================================================================
+
+#ifndef SEQAN_TESTS_STORE_TEST_STORE_INTERVALTREE_H_
+#define SEQAN_TESTS_STORE_TEST_STORE_INTERVALTREE_H_
+
+#include <cstdlib>
+#include <algorithm>
+
+#include <seqan/basic.h>
+#include <seqan/store.h>
+
+using namespace seqan;
+
+template <typename TStore>
+void testStoreAnnotationOverlapsFill(TStore & store, unsigned numContigs, unsigned numAnnos, unsigned numAligns)
+{
+    typedef typename TStore::TAnnotationStoreElement TAnnotation;
+    typedef typename Value<typename TStore::TAlignedReadStore>::Type TAlignedRead;
+
+    resize(store.contigStore, numContigs);
+    for (unsigned i = 0; i < numAnnos; ++i)
+    {
+        TAnnotation anno;
+        // Leave some annotations without contig or position.
+        if (i % 17 != 3)
+            anno.contigId = rand() % numContigs;
+        if (i % 23 != 5)
+        {
+            anno.beginPos = rand() % 100000;
+            anno.endPos = anno.beginPos + rand() % 2000;
+            if (rand() % 2)
+                std::swap(anno.beginPos, anno.endPos);
+        }
+        appendValue(store.annotationStore, anno);
+    }
+    for (unsigned i = 0; i < numAligns; ++i)
+    {
+        unsigned contigId = (i % 31 == 7) ? TAlignedRead::INVALID_ID : rand() % numContigs;
+        int beginPos = rand() % 100000;
+        int endPos = beginPos + rand() % 200;
+        if (rand() % 2)
+            std::swap(beginPos, endPos);
+        appendValue(store.alignedReadStore, TAlignedRead(i, i, contigId, beginPos, endPos));
+    }
+}
+
+template <typename TStore, typename TPairs>
+void testStoreAnnotationOverlapsNaive(TPairs & pairs, TStore const & store)
+{
+    typedef typename TStore::TAnnotationStoreElement TAnnotation;
+
+    clear(pairs);
+    for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+        for (unsigned j = 0; j < length(store.annotationStore); ++j)
+        {
+            TAnnotation const & anno = store.annotationStore[j];
+            if (anno.contigId == TAnnotation::INVALID_ID || anno.beginPos == TAnnotation::INVALID_POS ||
+                anno.contigId != store.alignedReadStore[i].contigId)
+                continue;
+            if (std::min(anno.beginPos, anno.endPos) < std::max(store.alignedReadStore[i].beginPos,
+                                                                store.alignedReadStore[i].endPos) &&
+                std::min(store.alignedReadStore[i].beginPos, store.alignedReadStore[i].endPos) <
+                std::max(anno.beginPos, anno.endPos))
+                appendValue(pairs, typename Value<TPairs>::Type(i, j));
+        }
+}
+
+SEQAN_DEFINE_TEST(test_store_intervaltree_find_annotation_overlaps)
+{
+    FragmentStore<> store;
+    srand(42);
+    testStoreAnnotationOverlapsFill(store, 3, 500, 20000);
+
+    String<Pair<unsigned, unsigned> > pairs, naivePairs;
+    findAnnotationOverlaps(pairs, store);
+    testStoreAnnotationOverlapsNaive(naivePairs, store);
+    SEQAN_ASSERT_GT(length(naivePairs), 0u);
+
+    // The pairs are ordered by the alignment positions.
+    for (unsigned i = 1; i < length(pairs); ++i)
+    {
+        unsigned a = pairs[i - 1].i1, b = pairs[i].i1;
+        SEQAN_ASSERT_LEQ(store.alignedReadStore[a].contigId, store.alignedReadStore[b].contigId);
+        if (store.alignedReadStore[a].contigId == store.alignedReadStore[b].contigId)
+            SEQAN_ASSERT_LEQ(std::min(store.alignedReadStore[a].beginPos, store.alignedReadStore[a].endPos),
+                             std::min(store.alignedReadStore[b].beginPos, store.alignedReadStore[b].endPos));
+    }
+
+    std::sort(begin(pairs, Standard()), end(pairs, Standard()));
+    std::sort(begin(naivePairs, Standard()), end(naivePairs, Standard()));
+    SEQAN_ASSERT(pairs == naivePairs);
+
+    // Again with a sorted store.
+    sortAlignedReads(store.alignedReadStore, SortBeginPos());
+    sortAlignedReads(store.alignedReadStore, SortContigId());
+    findAnnotationOverlaps(pairs, store);
+    testStoreAnnotationOverlapsNaive(naivePairs, store);
+    std::sort(begin(pairs, Standard()), end(pairs, Standard()));
+    std::sort(begin(naivePairs, Standard()), end(naivePairs, Standard()));
+    SEQAN_ASSERT(pairs == naivePairs);
+}
+
+SEQAN_DEFINE_TEST(test_store_intervaltree_count_annotation_overlaps)
+{
+    FragmentStore<> store;
+    srand(7);
+    testStoreAnnotationOverlapsFill(store, 2, 300, 10000);
+
+    String<unsigned> counts;
+    countAnnotationOverlaps(counts, store);
+    SEQAN_ASSERT_EQ(length(counts), length(store.annotationStore));
+
+    String<Pair<unsigned, unsigned> > naivePairs;
+    testStoreAnnotationOverlapsNaive(naivePairs, store);
+    String<unsigned> naiveCounts;
+    resize(naiveCounts, length(store.annotationStore), 0);
+    for (unsigned i = 0; i < length(naivePairs); ++i)
+        ++naiveCounts[naivePairs[i].i2];
+    SEQAN_ASSERT(counts == naiveCounts);
+
+    // Stores without alignments, only the annotation root exists.
+    FragmentStore<> emptyStore;
+    countAnnotationOverlaps(counts, emptyStore);
+    SEQAN_ASSERT_EQ(length(counts), length(emptyStore.annotationStore));
+    for (unsigned i = 0; i < length(counts); ++i)
+        SEQAN_ASSERT_EQ(counts[i], 0u);
+    String<Pair<unsigned, unsigned> > pairs;
+    findAnnotationOverlaps(pairs, emptyStore);
+    SEQAN_ASSERT(empty(pairs));
+}
+
+#endif  // SEQAN_TESTS_STORE_TEST_STORE_INTERVALTREE_H_
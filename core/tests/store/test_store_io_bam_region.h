@@ -0,0 +1,217 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for loading genomic windows from an indexed BAM file.
+// ==========================================================================
+
+#ifndef SEQAN_TESTS_STORE_TEST_STORE_IO_BAM_REGION_H_
+#define SEQAN_TESTS_STORE_TEST_STORE_IO_BAM_REGION_H_
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <seqan/basic.h>
+#include <seqan/store.h>
+
+using namespace seqan;
+
+#if SEQAN_HAS_ZLIB
+
+template <typename TStore, typename TId>
+std::string testStoreBamRegionName(TStore & store, TId readId)
+{
+    return std::string(begin(store.readNameStore[readId], Standard()), end(store.readNameStore[readId], Standard()));
+}
+
+// Returns the sorted names and begin positions of the alignments in the store.
+template <typename TStore>
+std::vector<std::pair<std::string, int> > testStoreBamRegionAlignments(TStore & store)
+{
+    typedef typename Value<typename TStore::TContigStore>::Type TContig;
+    typedef Gaps<Nothing, AnchorGaps<typename TContig::TGapAnchors> > TContigGaps;
+
+    std::vector<std::pair<std::string, int> > result;
+    for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        TContigGaps contigGaps(store.contigStore[store.alignedReadStore[i].contigId].gaps);
+        int beginPos = positionGapToSeq(contigGaps, _min(store.alignedReadStore[i].beginPos,
+                                                         store.alignedReadStore[i].endPos));
+        result.push_back(std::make_pair(testStoreBamRegionName(store, store.alignedReadStore[i].readId), beginPos));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+template <typename TStore>
+void testStoreBamRegionCheck(TStore & store, String<BamAlignmentRecord> const & records,
+                             __int32 rID, __int32 beginPos, __int32 endPos)
+{
+    typedef typename Value<typename TStore::TAlignedReadStore>::Type TAlignedRead;
+
+    std::vector<std::pair<std::string, int> > expected;
+    for (unsigned i = 0; i < length(records); ++i)
+    {
+        BamAlignmentRecord const & record = records[i];
+        __int32 recordEnd = record.beginPos + _max((__int32)getAlignmentLengthInRef(record), (__int32)1);
+        if (record.rID == rID && !empty(record.cigar) && record.beginPos < endPos && recordEnd > beginPos)
+            expected.push_back(std::make_pair(toCString(record.qName), record.beginPos));
+    }
+    std::sort(expected.begin(), expected.end());
+    SEQAN_ASSERT(!expected.empty());
+    SEQAN_ASSERT(testStoreBamRegionAlignments(store) == expected);
+
+    // Only the reads and mate-pairs of the window are in the store.
+    String<bool> usedReads;
+    resize(usedReads, length(store.readStore), false);
+    for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        TAlignedRead const & align = store.alignedReadStore[i];
+        SEQAN_ASSERT_LT(align.readId, length(store.readStore));
+        SEQAN_ASSERT_NOT(empty(store.readSeqStore[align.readId]));
+        usedReads[align.readId] = true;
+
+        // Linked mates belong to the same mate-pair.
+        if (align.pairMatchId != TAlignedRead::INVALID_ID)
+            for (unsigned j = 0; j < length(store.alignedReadStore); ++j)
+                if (j != i && store.alignedReadStore[j].pairMatchId == align.pairMatchId)
+                    SEQAN_ASSERT_EQ(store.readStore[store.alignedReadStore[j].readId].matePairId,
+                                    store.readStore[align.readId].matePairId);
+    }
+    for (unsigned i = 0; i < length(usedReads); ++i)
+        SEQAN_ASSERT(usedReads[i]);
+    SEQAN_ASSERT_EQ(length(store.alignQualityStore), length(store.alignedReadStore));
+    SEQAN_ASSERT_EQ(length(store.alignedReadTagStore), length(store.alignedReadStore));
+    SEQAN_ASSERT_EQ(length(store.readSeqStore), length(store.readStore));
+    SEQAN_ASSERT_EQ(length(store.readNameStore), length(store.readStore));
+    SEQAN_ASSERT_LEQ(length(store.matePairStore), length(store.readStore));
+}
+
+SEQAN_DEFINE_TEST(test_store_io_bam_region_load)
+{
+    CharString fastaFileName = SEQAN_PATH_TO_ROOT();
+    append(fastaFileName, "/core/tests/store/ex1.fa");
+    CharString bamFileName = SEQAN_PATH_TO_ROOT();
+    append(bamFileName, "/core/tests/store/ex1.bam");
+    CharString baiFileName = bamFileName;
+    append(baiFileName, ".bai");
+
+    // All records of the BAM file for comparison.
+    String<BamAlignmentRecord> records;
+    {
+        BamStream bamIO(toCString(bamFileName));
+        SEQAN_ASSERT(isGood(bamIO));
+        BamAlignmentRecord record;
+        while (!atEnd(bamIO))
+        {
+            SEQAN_ASSERT_EQ(readRecord(record, bamIO), 0);
+            appendValue(records, record);
+        }
+    }
+
+    FragmentStore<> store;
+    SEQAN_ASSERT(loadContigs(store, toCString(fastaFileName)));
+    BamStream bamIO(toCString(bamFileName));
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT_EQ(read(baiIndex, toCString(baiFileName)), 0);
+
+    FragStoreRegionLoader<FragmentStore<> > loader(store, bamIO, baiIndex);
+
+    // Overlapping windows moving forward on both references.
+    unsigned maxAligns = 0;
+    for (__int32 rID = 0; rID < 2; ++rID)
+        for (__int32 pos = 0; pos < 1500; pos += 200)
+        {
+            SEQAN_ASSERT(loadRegion(loader, rID, pos, pos + 300));
+            testStoreBamRegionCheck(store, records, rID, pos, pos + 300);
+            maxAligns = _max(maxAligns, (unsigned)length(store.alignedReadStore));
+        }
+    SEQAN_ASSERT_LT(maxAligns, length(records) / 4);
+
+    // Jumping back refills the store.
+    SEQAN_ASSERT(loadRegion(loader, 0, 100, 400));
+    testStoreBamRegionCheck(store, records, 0, 100, 400);
+
+    // Invalid windows fail.
+    SEQAN_ASSERT_NOT(loadRegion(loader, 2, 0, 100));
+    SEQAN_ASSERT_NOT(loadRegion(loader, 0, 100, 100));
+}
+
+SEQAN_DEFINE_TEST(test_store_io_bam_region_whole_reference)
+{
+    CharString fastaFileName = SEQAN_PATH_TO_ROOT();
+    append(fastaFileName, "/core/tests/store/ex1.fa");
+    CharString bamFileName = SEQAN_PATH_TO_ROOT();
+    append(bamFileName, "/core/tests/store/ex1.bam");
+    CharString baiFileName = bamFileName;
+    append(baiFileName, ".bai");
+
+    // The multiple alignment of a window covering a whole reference is the one of the full import.
+    FragmentStore<> fullStore;
+    SEQAN_ASSERT(loadContigs(fullStore, toCString(fastaFileName)));
+    {
+        Stream<Bgzf> bgzfStream;
+        SEQAN_ASSERT(open(bgzfStream, toCString(bamFileName), "r"));
+        read(bgzfStream, fullStore, Bam());
+    }
+
+    FragmentStore<> store;
+    SEQAN_ASSERT(loadContigs(store, toCString(fastaFileName)));
+    BamStream bamIO(toCString(bamFileName));
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT_EQ(read(baiIndex, toCString(baiFileName)), 0);
+    FragStoreRegionLoader<FragmentStore<> > loader(store, bamIO, baiIndex);
+
+    for (__int32 rID = 0; rID < 2; ++rID)
+    {
+        SEQAN_ASSERT(loadRegion(loader, rID, 0, length(store.contigStore[rID].seq)));
+        SEQAN_ASSERT(store.contigStore[rID].gaps == fullStore.contigStore[rID].gaps);
+
+        std::vector<std::pair<std::string, int> > expected, loaded;
+        for (unsigned i = 0; i < length(fullStore.alignedReadStore); ++i)
+            if (fullStore.alignedReadStore[i].contigId == (unsigned)rID)
+                expected.push_back(std::make_pair(
+                        testStoreBamRegionName(fullStore, fullStore.alignedReadStore[i].readId),
+                        (int)fullStore.alignedReadStore[i].beginPos));
+        for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+            loaded.push_back(std::make_pair(testStoreBamRegionName(store, store.alignedReadStore[i].readId),
+                                            (int)store.alignedReadStore[i].beginPos));
+        std::sort(expected.begin(), expected.end());
+        std::sort(loaded.begin(), loaded.end());
+        SEQAN_ASSERT(loaded == expected);
+    }
+}
+
+#endif  // #if SEQAN_HAS_ZLIB
+
+#endif  // SEQAN_TESTS_STORE_TEST_STORE_IO_BAM_REGION_H_
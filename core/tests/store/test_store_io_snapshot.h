@@ -0,0 +1,189 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Tests for the binary FragmentStore snapshots.
+// ==========================================================================
+
+#ifndef SEQAN_TESTS_STORE_TEST_STORE_IO_SNAPSHOT_H_
+#define SEQAN_TESTS_STORE_TEST_STORE_IO_SNAPSHOT_H_
+
+#include <sstream>
+
+#include <seqan/basic.h>
+#include <seqan/store.h>
+
+using namespace seqan;
+
+template <typename TStore>
+void testStoreSnapshotFill(TStore & store)
+{
+    CharString fileName = SEQAN_PATH_TO_ROOT();
+    append(fileName, "/core/tests/store/ex1.fa");
+    SEQAN_ASSERT(loadContigs(store, toCString(fileName)));
+
+    fileName = SEQAN_PATH_TO_ROOT();
+    append(fileName, "/core/tests/store/ex1.sam.copy");
+    std::fstream samFile(toCString(fileName), std::ios::binary | std::ios::in);
+    SEQAN_ASSERT(samFile.good());
+    read(samFile, store, Sam());
+
+    fileName = SEQAN_PATH_TO_ROOT();
+    append(fileName, "/core/tests/store/example_gff.tsv");
+    std::fstream gffFile(toCString(fileName), std::ios::binary | std::ios::in);
+    SEQAN_ASSERT(gffFile.good());
+    read(gffFile, store, Gff());
+}
+
+template <typename TStringSet1, typename TStringSet2>
+bool testStoreSnapshotEqual(TStringSet1 const & set1, TStringSet2 const & set2)
+{
+    if (length(set1) != length(set2))
+        return false;
+    for (unsigned i = 0; i < length(set1); ++i)
+        if (set1[i] != set2[i])
+            return false;
+    return true;
+}
+
+SEQAN_DEFINE_TEST(test_store_io_snapshot_round_trip)
+{
+    typedef FragmentStore<>::TAnnotationStoreElement TAnnotation;
+
+    FragmentStore<> store;
+    testStoreSnapshotFill(store);
+    appendValue(store.libraryStore, LibraryStoreElement<>());
+    store.libraryStore[0].mean = 200.5;
+    appendValue(store.libraryNameStore, "lib");
+
+    CharString prefix = SEQAN_TEMP_FILENAME();
+    SEQAN_ASSERT(save(store, toCString(prefix)));
+
+    FragmentStore<> loaded;
+    SEQAN_ASSERT(open(loaded, toCString(prefix)));
+
+    // Reads, libraries and contigs.
+    SEQAN_ASSERT_EQ(length(loaded.readStore), length(store.readStore));
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.readSeqStore, store.readSeqStore));
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.readNameStore, store.readNameStore));
+    SEQAN_ASSERT_EQ(length(loaded.libraryStore), 1u);
+    SEQAN_ASSERT_EQ(loaded.libraryStore[0].mean, 200.5);
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.libraryNameStore, store.libraryNameStore));
+    SEQAN_ASSERT_EQ(length(loaded.contigStore), length(store.contigStore));
+    for (unsigned i = 0; i < length(store.contigStore); ++i)
+    {
+        SEQAN_ASSERT(loaded.contigStore[i].seq == store.contigStore[i].seq);
+        SEQAN_ASSERT(loaded.contigStore[i].gaps == store.contigStore[i].gaps);
+        SEQAN_ASSERT_EQ(loaded.contigStore[i].fileId, store.contigStore[i].fileId);
+        SEQAN_ASSERT_EQ(loaded.contigStore[i].fileBeginPos, store.contigStore[i].fileBeginPos);
+    }
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.contigNameStore, store.contigNameStore));
+    SEQAN_ASSERT_EQ(length(loaded.contigFileStore), length(store.contigFileStore));
+    SEQAN_ASSERT_EQ(loaded.contigFileStore[0].fileName, store.contigFileStore[0].fileName);
+    SEQAN_ASSERT_EQ(loaded.contigFileStore[0].format.tagId, store.contigFileStore[0].format.tagId);
+
+    // Alignments.
+    SEQAN_ASSERT_EQ(length(loaded.alignedReadStore), length(store.alignedReadStore));
+    for (unsigned i = 0; i < length(store.alignedReadStore); ++i)
+    {
+        SEQAN_ASSERT_EQ(loaded.alignedReadStore[i].readId, store.alignedReadStore[i].readId);
+        SEQAN_ASSERT_EQ(loaded.alignedReadStore[i].contigId, store.alignedReadStore[i].contigId);
+        SEQAN_ASSERT_EQ(loaded.alignedReadStore[i].pairMatchId, store.alignedReadStore[i].pairMatchId);
+        SEQAN_ASSERT_EQ(loaded.alignedReadStore[i].beginPos, store.alignedReadStore[i].beginPos);
+        SEQAN_ASSERT_EQ(loaded.alignedReadStore[i].endPos, store.alignedReadStore[i].endPos);
+        SEQAN_ASSERT(loaded.alignedReadStore[i].gaps == store.alignedReadStore[i].gaps);
+        SEQAN_ASSERT_EQ(loaded.alignQualityStore[i].score, store.alignQualityStore[i].score);
+    }
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.alignedReadTagStore, store.alignedReadTagStore));
+
+    // Annotations.
+    SEQAN_ASSERT_EQ(length(loaded.annotationStore), length(store.annotationStore));
+    for (unsigned i = 0; i < length(store.annotationStore); ++i)
+    {
+        TAnnotation const & expected = store.annotationStore[i];
+        TAnnotation const & anno = loaded.annotationStore[i];
+        SEQAN_ASSERT_EQ(anno.parentId, expected.parentId);
+        SEQAN_ASSERT_EQ(anno.contigId, expected.contigId);
+        SEQAN_ASSERT_EQ(anno.typeId, expected.typeId);
+        SEQAN_ASSERT_EQ(anno.beginPos, expected.beginPos);
+        SEQAN_ASSERT_EQ(anno.endPos, expected.endPos);
+        SEQAN_ASSERT_EQ(anno.lastChildId, expected.lastChildId);
+        SEQAN_ASSERT_EQ(anno.nextSiblingId, expected.nextSiblingId);
+        SEQAN_ASSERT(testStoreSnapshotEqual(anno.values, expected.values));
+    }
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.annotationNameStore, store.annotationNameStore));
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.annotationTypeStore, store.annotationTypeStore));
+    SEQAN_ASSERT(testStoreSnapshotEqual(loaded.annotationKeyStore, store.annotationKeyStore));
+
+    // The name caches are usable after loading.
+    unsigned id = 0;
+    SEQAN_ASSERT(getIdByName(loaded.contigNameStore, store.contigNameStore[1], id, loaded.contigNameStoreCache));
+    SEQAN_ASSERT_EQ(id, 1u);
+    SEQAN_ASSERT(getIdByName(loaded.readNameStore, store.readNameStore[7], id, loaded.readNameStoreCache));
+    SEQAN_ASSERT_EQ(loaded.readNameStore[id], store.readNameStore[7]);
+    SEQAN_ASSERT(getIdByName(loaded.annotationTypeStore, "exon", id, loaded.annotationTypeStoreCache));
+
+    // The loaded store writes the same SAM file.
+    std::stringstream expectedSam, loadedSam;
+    write(expectedSam, store, Sam());
+    write(loadedSam, loaded, Sam());
+    SEQAN_ASSERT_EQ(expectedSam.str(), loadedSam.str());
+}
+
+SEQAN_DEFINE_TEST(test_store_io_snapshot_reject)
+{
+    FragmentStore<> store;
+    testStoreSnapshotFill(store);
+
+    CharString prefix = SEQAN_TEMP_FILENAME();
+    SEQAN_ASSERT(save(store, toCString(prefix)));
+
+    // A missing snapshot fails.
+    FragmentStore<> loaded;
+    CharString missing = prefix;
+    append(missing, ".missing");
+    SEQAN_ASSERT_NOT(open(loaded, toCString(missing)));
+
+    // A snapshot of another layout version fails.
+    CharString infoFileName = prefix;
+    append(infoFileName, ".info");
+    {
+        String<__uint64, MMap<> > info;
+        SEQAN_ASSERT(open(info, toCString(infoFileName), OPEN_RDWR | OPEN_APPEND));
+        SEQAN_ASSERT_GT(length(info), 1u);
+        info[1] += 1;
+    }
+    SEQAN_ASSERT_NOT(open(loaded, toCString(prefix)));
+    SEQAN_ASSERT(empty(loaded.readStore));
+}
+
+#endif  // SEQAN_TESTS_STORE_TEST_STORE_IO_SNAPSHOT_H_
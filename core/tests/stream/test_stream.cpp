@@ -282,6 +282,7 @@ SEQAN_BEGIN_TESTSUITE(test_stream)
     SEQAN_CALL_TEST(test_stream_tokenizing_read_digits);
     SEQAN_CALL_TEST(test_stream_tokenizing_read_alpha_nums);
     SEQAN_CALL_TEST(test_stream_tokenizing_read_float);
+    SEQAN_CALL_TEST(test_stream_tokenizing_long_lines);
 
     // Tests for lexical_cast
     SEQAN_CALL_TEST(test_stream_lexical_cast_1_stdstring);
@@ -294,6 +295,9 @@ SEQAN_BEGIN_TESTSUITE(test_stream)
     // Tests for RecordReader.
     SEQAN_CALL_TEST(test_stream_record_reader_single_pass_position);
     SEQAN_CALL_TEST(test_stream_record_reader_single_pass_set_position);
+    SEQAN_CALL_TEST(test_stream_record_reader_single_pass_read_ahead_position);
+    SEQAN_CALL_TEST(test_stream_record_reader_single_pass_read_ahead_set_position);
+    SEQAN_CALL_TEST(test_stream_record_reader_single_pass_read_ahead_lines);
     SEQAN_CALL_TEST(test_stream_record_reader_double_pass_position);
     SEQAN_CALL_TEST(test_stream_record_reader_double_pass_set_position);
     SEQAN_CALL_TEST(test_stream_record_reader_single_pass_mmap_position);
@@ -88,6 +88,97 @@ SEQAN_DEFINE_TEST(test_stream_record_reader_single_pass_set_position)
     SEQAN_ASSERT(atEnd(reader));
 }
 
+SEQAN_DEFINE_TEST(test_stream_record_reader_single_pass_read_ahead_position)
+{
+    // Prepare input stream.
+    std::stringstream ss;
+    ss << "1234567890";
+    ss.seekg(0);
+    ss.seekp(0);
+    ss.clear();
+
+    // Create RecordReader object.
+    typedef seqan::RecordReader<std::stringstream, seqan::SinglePass<seqan::ReadAhead> > TRecordReader;
+    TRecordReader reader(ss, /*bufferSize=*/ 3);
+
+    typedef typename seqan::Position<TRecordReader>::Type TPos;
+
+    SEQAN_ASSERT_EQ(position(reader), (TPos)0);
+    SEQAN_ASSERT_NOT(goNext(reader));
+    SEQAN_ASSERT_EQ(position(reader), (TPos)1);
+    SEQAN_ASSERT_EQ(skipNChars(reader, 3), 0);
+    SEQAN_ASSERT_EQ(position(reader), (TPos)4);
+    SEQAN_ASSERT_EQ(skipNChars(reader, 6), 0);
+    SEQAN_ASSERT_EQ(position(reader), (TPos)10);
+    SEQAN_ASSERT(atEnd(reader));
+}
+
+SEQAN_DEFINE_TEST(test_stream_record_reader_single_pass_read_ahead_set_position)
+{
+    // Prepare input stream.
+    std::stringstream ss;
+    ss << "1234567890";
+    ss.seekg(0);
+    ss.seekp(0);
+    ss.clear();
+
+    // Create RecordReader object.
+    typedef seqan::RecordReader<std::stringstream, seqan::SinglePass<seqan::ReadAhead> > TRecordReader;
+    TRecordReader reader(ss, /*bufferSize=*/ 3);
+
+    typedef typename seqan::Position<TRecordReader>::Type TPos;
+
+    SEQAN_ASSERT_EQ(position(reader), (TPos)0);
+    SEQAN_ASSERT_NOT(goNext(reader));
+    SEQAN_ASSERT_EQ(position(reader), (TPos)1);
+    SEQAN_ASSERT_EQ(skipNChars(reader, 3), 0);
+    SEQAN_ASSERT_EQ(setPosition(reader, 1), 0);
+    SEQAN_ASSERT_EQ(position(reader), (TPos)1);
+    SEQAN_ASSERT_EQ(value(reader), '2');
+    SEQAN_ASSERT_EQ(skipNChars(reader, 3), 0);
+    SEQAN_ASSERT_EQ(position(reader), (TPos)4);
+    SEQAN_ASSERT_EQ(value(reader), '5');
+    SEQAN_ASSERT_EQ(setPosition(reader, 10), 0);
+    SEQAN_ASSERT(atEnd(reader));
+}
+
+SEQAN_DEFINE_TEST(test_stream_record_reader_single_pass_read_ahead_lines)
+{
+    // Prepare input stream with lines spanning several buffers.
+    std::stringstream ss;
+    for (unsigned i = 0; i < 1000; ++i)
+        ss << "line" << i << '\t' << std::string(i % 37, 'A' + i % 26) << '\n';
+    ss.seekg(0);
+    ss.seekp(0);
+    ss.clear();
+    std::stringstream ss2(ss.str());
+
+    seqan::RecordReader<std::stringstream, seqan::SinglePass<seqan::ReadAhead> > reader(ss, /*bufferSize=*/ 64);
+    seqan::RecordReader<std::stringstream, seqan::SinglePass<> > reader2(ss2, /*bufferSize=*/ 64);
+
+    seqan::CharString buffer, buffer2;
+    unsigned numLines = 0;
+    while (!atEnd(reader))
+    {
+        SEQAN_ASSERT_NOT(atEnd(reader2));
+        clear(buffer);
+        clear(buffer2);
+        SEQAN_ASSERT_EQ(readUntilChar(buffer, reader, '\t'), 0);
+        SEQAN_ASSERT_EQ(readUntilChar(buffer2, reader2, '\t'), 0);
+        SEQAN_ASSERT_EQ(buffer, buffer2);
+        SEQAN_ASSERT_EQ(position(reader), position(reader2));
+        clear(buffer);
+        clear(buffer2);
+        SEQAN_ASSERT_EQ(readLine(buffer, reader), 0);
+        SEQAN_ASSERT_EQ(readLine(buffer2, reader2), 0);
+        SEQAN_ASSERT_EQ(buffer, buffer2);
+        ++numLines;
+    }
+    SEQAN_ASSERT(atEnd(reader2));
+    SEQAN_ASSERT_EQ(numLines, 1000u);
+    SEQAN_ASSERT_EQ(resultCode(reader), 0);
+}
+
 SEQAN_DEFINE_TEST(test_stream_record_reader_double_pass_position)
 {
     // Prepare input stream.
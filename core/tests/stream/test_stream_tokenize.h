@@ -644,4 +644,60 @@ SEQAN_DEFINE_TEST(test_stream_tokenizing_skipUntilLineBeginsWithOneCharOfStr)
     delete file;
 }
 
+// Vectorized scanning in the buffer of the RecordReader, with lines crossing buffer boundaries.
+SEQAN_DEFINE_TEST(test_stream_tokenizing_long_lines)
+{
+    using namespace seqan;
+
+    CharString contents;
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        for (unsigned j = 0; j < 7 * i + 3; ++j)
+            appendValue(contents, 'A' + (i + j) % 26);
+        appendValue(contents, (i % 3 == 0) ? '\t' : ' ');
+        for (unsigned j = 0; j < 5 * i + 1; ++j)
+            appendValue(contents, 'a' + j % 26);
+        append(contents, (i % 2 == 0) ? "\n" : "\r\n");
+    }
+
+    // Read lines and words from the stream with a small buffer, reads from the string in one chunk.
+    typedef Stream<CharArray<char const *> > TStream;
+    TStream stream(toCString(contents), toCString(contents) + length(contents));
+    RecordReader<TStream, SinglePass<> > reader(stream, 13);
+    RecordReader<CharString, SinglePass<StringReader> > stringReader(contents);
+
+    CharString buf, buf2, expected;
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        clear(expected);
+        for (unsigned j = 0; j < 7 * i + 3; ++j)
+            appendValue(expected, 'A' + (i + j) % 26);
+
+        clear(buf);
+        SEQAN_ASSERT_EQ(readUntilBlank(buf, reader), 0);
+        SEQAN_ASSERT_EQ(buf, expected);
+        clear(buf2);
+        SEQAN_ASSERT_EQ(readUntilWhitespace(buf2, stringReader), 0);
+        SEQAN_ASSERT_EQ(buf2, expected);
+        SEQAN_ASSERT_EQ(value(reader), value(stringReader));
+
+        clear(expected);
+        for (unsigned j = 0; j < 5 * i + 1; ++j)
+            appendValue(expected, 'a' + j % 26);
+
+        SEQAN_ASSERT_EQ(skipBlanks(reader), 0);
+        clear(buf);
+        SEQAN_ASSERT_EQ(readLine(buf, reader), 0);
+        SEQAN_ASSERT_EQ(buf, expected);
+
+        SEQAN_ASSERT_EQ(skipWhitespaces(stringReader), 0);
+        clear(buf2);
+        SEQAN_ASSERT_EQ(readUntilOneOf(buf2, stringReader, '\r', '\n'), 0);
+        SEQAN_ASSERT_EQ(buf2, expected);
+        SEQAN_ASSERT_EQ(skipLine(stringReader), 0);
+    }
+    SEQAN_ASSERT(atEnd(reader));
+    SEQAN_ASSERT(atEnd(stringReader));
+}
+
 #endif // ndef TEST_STREAM_TEST_STREAM_TOKENIZING_H_
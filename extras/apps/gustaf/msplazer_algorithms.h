@@ -303,13 +303,14 @@ void _chainMatches(QueryMatches<StellarMatch<TSequence, TId> > & queryMatches,
                     // Compute breakpoint score
                     // The resulting score is the sum of the scores of both alignments. --> substract old match scores
                     // Note: old match scores are already distances, new score is a negative score bc. we use scoring sceme (0, -1, -1, -1)
-                    score = _splitAlignmentImpl(row(match1, 0), row(match1, 1), row(match2, 0), row(match2, 1),
-                                                minValue<int>(), maxValue<int>(),
-                                                scoreType);
+                    // Only the score and the split position are needed, so we do not compute the alignments.
+                    unsigned bestPrefixLength = 0;
+                    score = splitAlignmentScore(bestPrefixLength, source(row(match1, 0)), source(row(match1, 1)),
+                                                source(row(match2, 0)), source(row(match2, 1)), scoreType);
 
                     SEQAN_ASSERT_NEQ(score, maxValue<int>());
                     score += (static_cast<int>(matchDistanceScores[m1]) + static_cast<int>(matchDistanceScores[m2]));
-                    splitPos = endPosition(row(match1, 0)) + stMatch1.begin2;
+                    splitPos = bestPrefixLength + stMatch1.begin2;
 
                     // Refine cargo by reducing distance by score, score is the number of edit errors avoided by the breakpoint/trimming
                     cargo -= score;
@@ -497,10 +498,10 @@ void _chainMatchesReference(QueryMatches<StellarMatch<TSequence, TId> > & queryM
                         // int lDiag = -10, uDiag = 10;
                         // score = splitAlignment(match1, match2, scoreType, lDiag, uDiag);
                         // score = splitAlignment(match1, match2, scoreType);
-                        score = _splitAlignmentImpl(row(match1, 0), row(match1, 1), row(match2, 0), row(match2, 1),
-                                                    minValue<int>(), maxValue<int>(),
-                                                    scoreType);
-                        SEQAN_ASSERT_EQ(endPosition(row(match1, 0)), beginPosition(row(match2, 0)));
+                        // Only the score and the split position are needed, so we do not compute the alignments.
+                        unsigned bestPrefixLength = 0;
+                        score = splitAlignmentScore(bestPrefixLength, source(row(match1, 0)), source(row(match1, 1)),
+                                                    source(row(match2, 0)), source(row(match2, 1)), scoreType);
 
                         // Compute cargo, reduce distance by score
                         // cargo = static_cast<int>(matchDistanceScores[m2]) - score + diffStrandPen + diffOrderPen;
@@ -511,7 +512,7 @@ void _chainMatchesReference(QueryMatches<StellarMatch<TSequence, TId> > & queryM
                         if (!swap)
                         {
                             // Get view position in stMatch1.row2 of first source character after split
-                            splitPos = endPosition(row(match1, 0)) + (*stMatch1).begin1;
+                            splitPos = bestPrefixLength + (*stMatch1).begin1;
                             readStartPos = toSourcePosition((*stMatch1).row2, toViewPosition((*stMatch1).row1, splitPos)); // endPosition(row(match1, 1));
                             readEndPos = toSourcePosition((*stMatch2).row2, toViewPosition((*stMatch2).row1, splitPos)); // beginPosition(row(match2, 1));
                         }
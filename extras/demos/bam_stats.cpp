@@ -1266,8 +1266,16 @@ int doWork(TStreamOrReader & reader, TStreamOrReader & greader,
     {
         std::ofstream bestMatchFile(toCString(options.bestMatchFile));
         // sort output by read name
-        TNameCache::TSet::iterator it = readNameCache.nameSet.begin();
-        TNameCache::TSet::iterator itEnd = readNameCache.nameSet.end();
+        String<unsigned> readIds;
+        resize(readIds, length(readNames), Exact());
+        for (unsigned i = 0; i < length(readIds); ++i)
+            readIds[i] = i;
+        CharString dummyName;
+        std::sort(begin(readIds, Standard()), end(readIds, Standard()),
+                  NameStoreLess_<StringSet<CharString>, CharString>(readNames, dummyName));
+
+        Iterator<String<unsigned>, Standard>::Type it = begin(readIds, Standard());
+        Iterator<String<unsigned>, Standard>::Type itEnd = end(readIds, Standard());
         for (; it != itEnd; ++it)
         {
             CharString readName = readNames[*it];
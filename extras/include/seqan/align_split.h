@@ -44,6 +44,7 @@
 #include <seqan/align.h>
 #include <seqan/basic.h>
 #include <seqan/sequence.h>
+#include <seqan/parallel.h>
 
 // ===========================================================================
 // Split Alignment Impelmentation.
@@ -51,5 +52,6 @@
 
 #include <seqan/align_split/dp_scout_split.h>
 #include <seqan/align_split/align_split_interface.h>
+#include <seqan/align_split/align_split_score.h>
 
 #endif  // SEQAN_EXTRAS_INCLUDE_SEQAN_ALIGN_SPLIT_H_
@@ -0,0 +1,486 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Author: agent <agent@local>
+// ==========================================================================
+// Score-only split alignment in linear space, for single pairs and batches.
+// ==========================================================================
+
+#ifndef SEQAN_EXTRAS_INCLUDE_SEQAN_ALIGN_SPLIT_ALIGN_SPLIT_SCORE_H_
+#define SEQAN_EXTRAS_INCLUDE_SEQAN_ALIGN_SPLIT_ALIGN_SPLIT_SCORE_H_
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // #if defined(__SSE4_1__)
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// Number of sequence pairs that are aligned together in one block by the batched splitAlignmentScore().  The DP cells
+// of the pairs in one block are interleaved such that the innermost loop runs over independent pairs.  For int scores
+// with a simple scoring scheme this loop uses SSE2, four pairs per instruction.
+
+struct SplitAlignmentBlockSize_
+{
+    enum { VALUE = 8 };
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction SplitAlignmentVectorizable_
+// ----------------------------------------------------------------------------
+
+// True if the cells of the interleaved pairs can be computed with 32 bit integer vector instructions: int scores, a
+// simple scoring scheme and the same alphabet for both sequences, such that the score only depends on the equality of
+// the ordinal values.
+
+template <typename TScoreValue, typename TScoreSpec, typename TValueH, typename TValueV>
+struct SplitAlignmentVectorizable_
+{
+    typedef typename And<IsSameType<TScoreValue, int>,
+                         And<IsSameType<TScoreSpec, Simple>,
+                             IsSameType<TValueH, TValueV> > >::Type Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentRow()
+// ----------------------------------------------------------------------------
+
+// Computes the cells (v, k) of the current column for all count pairs k.  cells holds the cells of row v of the
+// previous column on entry and those of the current column on exit.  The vector variant needs the ordinal values of
+// the characters in ordsV and ordsH, the generic one the characters in valuesV and valuesH.
+
+template <typename TScoreValue, typename TValueV, typename TValueH, typename TScoreSpec>
+inline void
+_splitAlignmentRow(TScoreValue * cells,
+                   TScoreValue const * cellsAbove,
+                   TScoreValue * horizontals,
+                   TScoreValue * vertical,
+                   TScoreValue * diagonal,
+                   TScoreValue * columnMax,
+                   TValueV const * valuesV,
+                   TValueH const * valuesH,
+                   int const * /*ordsV*/,
+                   int const * /*ordsH*/,
+                   int const * lengthsV,
+                   int v,
+                   unsigned count,
+                   Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                   False const & /*vectorizable*/)
+{
+    TScoreValue const gapOpen = scoreGapOpen(scoringScheme);
+    TScoreValue const gapExtend = scoreGapExtend(scoringScheme);
+
+    for (unsigned k = 0; k < count; ++k)
+    {
+        TScoreValue scoreH = _max(cells[k] + gapOpen, horizontals[k] + gapExtend);
+        TScoreValue scoreV = _max(cellsAbove[k] + gapOpen, vertical[k] + gapExtend);
+        TScoreValue scoreD = diagonal[k] + score(scoringScheme, valuesH[k], valuesV[k]);
+        diagonal[k] = cells[k];
+        cells[k] = _max(scoreD, _max(scoreH, scoreV));
+        horizontals[k] = scoreH;
+        vertical[k] = scoreV;
+        columnMax[k] = (v <= lengthsV[k]) ? _max(columnMax[k], cells[k]) : columnMax[k];
+    }
+}
+
+#if defined(__SSE2__)
+inline __m128i
+_splitAlignmentMax(__m128i a, __m128i b)
+{
+#if defined(__SSE4_1__)
+    return _mm_max_epi32(a, b);
+#else
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+#endif  // #if defined(__SSE4_1__)
+}
+#endif  // #if defined(__SSE2__)
+
+template <typename TScoreValue, typename TValueV, typename TValueH, typename TScoreSpec>
+inline void
+_splitAlignmentRow(TScoreValue * cells,
+                   TScoreValue const * cellsAbove,
+                   TScoreValue * horizontals,
+                   TScoreValue * vertical,
+                   TScoreValue * diagonal,
+                   TScoreValue * columnMax,
+                   TValueV const * valuesV,
+                   TValueH const * valuesH,
+                   int const * ordsV,
+                   int const * ordsH,
+                   int const * lengthsV,
+                   int v,
+                   unsigned count,
+                   Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                   True const & /*vectorizable*/)
+{
+    unsigned k = 0;
+#if defined(__SSE2__)
+    __m128i const gapOpen = _mm_set1_epi32(scoreGapOpen(scoringScheme));
+    __m128i const gapExtend = _mm_set1_epi32(scoreGapExtend(scoringScheme));
+    __m128i const mismatch = _mm_set1_epi32(scoreMismatch(scoringScheme));
+    __m128i const matchBonus = _mm_set1_epi32(scoreMatch(scoringScheme) - scoreMismatch(scoringScheme));
+    __m128i const row = _mm_set1_epi32(v - 1);
+
+    for (; k + 4 <= count; k += 4)
+    {
+        __m128i cell = _mm_loadu_si128(reinterpret_cast<__m128i const *>(cells + k));
+        __m128i above = _mm_loadu_si128(reinterpret_cast<__m128i const *>(cellsAbove + k));
+        __m128i diag = _mm_loadu_si128(reinterpret_cast<__m128i const *>(diagonal + k));
+
+        __m128i isMatch = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ordsV + k)),
+                                          _mm_loadu_si128(reinterpret_cast<__m128i const *>(ordsH + k)));
+        __m128i scoreD = _mm_add_epi32(diag, _mm_add_epi32(mismatch, _mm_and_si128(isMatch, matchBonus)));
+        __m128i scoreH = _splitAlignmentMax(
+                _mm_add_epi32(cell, gapOpen),
+                _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(horizontals + k)), gapExtend));
+        __m128i scoreV = _splitAlignmentMax(
+                _mm_add_epi32(above, gapOpen),
+                _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(vertical + k)), gapExtend));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(diagonal + k), cell);
+        cell = _splitAlignmentMax(scoreD, _splitAlignmentMax(scoreH, scoreV));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(cells + k), cell);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(horizontals + k), scoreH);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(vertical + k), scoreV);
+
+        // Only rows within the vertical sequence of the pair contribute to the column maximum.
+        __m128i inside = _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(lengthsV + k)), row);
+        __m128i colMax = _mm_loadu_si128(reinterpret_cast<__m128i const *>(columnMax + k));
+        colMax = _splitAlignmentMax(colMax, _mm_or_si128(_mm_and_si128(inside, cell),
+                                                         _mm_andnot_si128(inside, colMax)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(columnMax + k), colMax);
+    }
+#else
+    (void)ordsV;
+    (void)ordsH;
+#endif  // #if defined(__SSE2__)
+
+    // The remaining pairs and the fallback without SSE2.
+    _splitAlignmentRow(cells + k, cellsAbove + k, horizontals + k, vertical + k, diagonal + k, columnMax + k,
+                       valuesV + k, valuesH + k, ordsV, ordsH, lengthsV + k, v, count - k, scoringScheme, False());
+}
+
+// ----------------------------------------------------------------------------
+// Function _splitAlignmentColumnMaxima()
+// ----------------------------------------------------------------------------
+
+// Computes the best score in each column of the global DP matrix of seqsH[k] and seqsV[k] for k < count, i.e. the
+// scores collected by the SplitAlignmentScout.  Only one column of the matrix is kept.  If reversed is true then the
+// sequences are aligned from the back and the maxima are written such that columnMaxima[k][i] belongs to the suffix
+// of seqsH[k] starting at position i.
+//
+// Linear gap costs are the special case of equal gap open and extension scores.
+
+template <typename TScoreValue, typename TSeqH, typename TSeqV, typename TScoreSpec>
+void _splitAlignmentColumnMaxima(String<TScoreValue> * columnMaxima,
+                                 TSeqH const * const * seqsH,
+                                 TSeqV const * const * seqsV,
+                                 unsigned count,
+                                 bool reversed,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef typename Value<TSeqH>::Type TValueH;
+    typedef typename Value<TSeqV>::Type TValueV;
+    typedef typename SplitAlignmentVectorizable_<TScoreValue, TScoreSpec, TValueH, TValueV>::Type TVectorizable;
+
+    TScoreValue const infimum = minValue<TScoreValue>() / 2;
+    TScoreValue const gapOpen = scoreGapOpen(scoringScheme);
+    TScoreValue const gapExtend = scoreGapExtend(scoringScheme);
+
+    unsigned lengthsH[SplitAlignmentBlockSize_::VALUE];
+    int lengthsV[SplitAlignmentBlockSize_::VALUE];
+    unsigned maxLengthH = 0, maxLengthV = 0;
+    for (unsigned k = 0; k < count; ++k)
+    {
+        lengthsH[k] = length(*seqsH[k]);
+        lengthsV[k] = length(*seqsV[k]);
+        maxLengthH = _max(maxLengthH, lengthsH[k]);
+        maxLengthV = _max(maxLengthV, static_cast<unsigned>(lengthsV[k]));
+        resize(columnMaxima[k], lengthsH[k] + 1, Exact());
+    }
+
+    // Interleave the vertical sequences, cell (v, k) is at position v * count + k.  Pairs with shorter sequences are
+    // padded, the padded cells never contribute to the maxima.
+    // The vectorized variant compares the ordinal values instead.
+    String<TValueV> valuesV;
+    resize(valuesV, maxLengthV * count, TValueV(), Exact());
+    String<int> ordsV;
+    if (TVectorizable::VALUE)
+        resize(ordsV, maxLengthV * count, 0, Exact());
+    for (unsigned k = 0; k < count; ++k)
+        for (int v = 0; v < lengthsV[k]; ++v)
+        {
+            valuesV[v * count + k] = value(*seqsV[k], reversed ? lengthsV[k] - 1 - v : v);
+            if (TVectorizable::VALUE)
+                ordsV[v * count + k] = ordValue(valuesV[v * count + k]);
+        }
+
+    // The score of the best alignment ending in each cell of the current column and the best one ending with a
+    // horizontal gap.
+    String<TScoreValue> column;
+    resize(column, (maxLengthV + 1) * count, Exact());
+    String<TScoreValue> horizontal;
+    resize(horizontal, (maxLengthV + 1) * count, infimum, Exact());
+
+    TScoreValue vertical[SplitAlignmentBlockSize_::VALUE];
+    TScoreValue diagonal[SplitAlignmentBlockSize_::VALUE];
+    TScoreValue columnMax[SplitAlignmentBlockSize_::VALUE];
+    TValueH valueH[SplitAlignmentBlockSize_::VALUE];
+    int ordH[SplitAlignmentBlockSize_::VALUE];
+
+    // Initialize the first column.
+    for (unsigned k = 0; k < count; ++k)
+    {
+        column[k] = 0;
+        columnMax[k] = 0;
+    }
+    for (unsigned v = 1; v <= maxLengthV; ++v)
+        for (unsigned k = 0; k < count; ++k)
+        {
+            column[v * count + k] = gapOpen + static_cast<TScoreValue>(v - 1) * gapExtend;
+            if (static_cast<int>(v) <= lengthsV[k])
+                columnMax[k] = _max(columnMax[k], column[v * count + k]);
+        }
+    for (unsigned k = 0; k < count; ++k)
+        columnMaxima[k][reversed ? lengthsH[k] : 0] = columnMax[k];
+
+    for (unsigned h = 1; h <= maxLengthH; ++h)
+    {
+        // First row.
+        TScoreValue firstRow = gapOpen + static_cast<TScoreValue>(h - 1) * gapExtend;
+        for (unsigned k = 0; k < count; ++k)
+        {
+            valueH[k] = (h <= lengthsH[k]) ? value(*seqsH[k], reversed ? lengthsH[k] - h : h - 1) : TValueH();
+            ordH[k] = ordValue(valueH[k]);
+            diagonal[k] = column[k];
+            column[k] = firstRow;
+            horizontal[k] = firstRow;
+            vertical[k] = infimum;
+            columnMax[k] = firstRow;
+        }
+
+        // All other rows.
+        for (unsigned v = 1; v <= maxLengthV; ++v)
+        {
+            TScoreValue * cells = begin(column, Standard()) + v * count;
+            _splitAlignmentRow(cells, cells - count, begin(horizontal, Standard()) + v * count, vertical, diagonal,
+                               columnMax, begin(valuesV, Standard()) + (v - 1) * count, valueH,
+                               begin(ordsV, Standard()) + (TVectorizable::VALUE ? (v - 1) * count : 0), ordH,
+                               lengthsV, static_cast<int>(v), count, scoringScheme, TVectorizable());
+        }
+
+        for (unsigned k = 0; k < count; ++k)
+            if (h <= lengthsH[k])
+                columnMaxima[k][reversed ? lengthsH[k] - h : h] = columnMax[k];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _bestSplitPosition()
+// ----------------------------------------------------------------------------
+
+// Returns the best sum of the left and right column maxima and sets splitPos to the leftmost position where it is
+// reached, as in _splitAlignmentImpl().
+
+template <typename TPosition, typename TScoreValue>
+inline TScoreValue
+_bestSplitPosition(TPosition & splitPos,
+                   String<TScoreValue> const & columnMaximaL,
+                   String<TScoreValue> const & columnMaximaR)
+{
+    SEQAN_ASSERT_EQ(length(columnMaximaL), length(columnMaximaR));
+
+    TScoreValue bestScore = minValue<TScoreValue>() / 2;
+    splitPos = 0;
+    for (unsigned i = 0; i < length(columnMaximaL); ++i)
+    {
+        TScoreValue s = columnMaximaL[i] + columnMaximaR[i];
+        if (s > bestScore)
+        {
+            bestScore = s;
+            splitPos = i;
+        }
+    }
+    return bestScore;
+}
+
+// ----------------------------------------------------------------------------
+// Function splitAlignmentScore()
+// ----------------------------------------------------------------------------
+
+/*!
+ * @fn splitAlignmentScore
+ * @headerfile <seqan/align_split.h>
+ * @brief Compute the score and the split position of split alignments without building the alignments.
+ *
+ * @signature TScoreValue splitAlignmentScore(splitPos, seqHL, seqVL, seqHR, seqVR, scoringScheme);
+ * @signature void splitAlignmentScore(scores, splitPositions, seqsHL, seqsVL, seqsHR, seqsVR, scoringScheme);
+ *
+ * @param[out] splitPos       The position in the horizontal sequence where the right alignment starts.
+ * @param[in]  seqHL          The horizontal/contig sequence of the left alignment.
+ * @param[in]  seqVL          The vertical/read sequence of the left alignment.
+ * @param[in]  seqHR          The horizontal/contig sequence of the right alignment, must have the length of
+ *                            <tt>seqHL</tt>.
+ * @param[in]  seqVR          The vertical/read sequence of the right alignment.
+ * @param[in]  scoringScheme  The scoring scheme to use for the alignment.
+ * @param[out] scores         A String with the score of each pair.
+ * @param[out] splitPositions A String with the split position of each pair.
+ * @param[in]  seqsHL         A StringSet with the horizontal sequences of the left alignments, the other sets
+ *                            analogously.
+ *
+ * @return TScoreValue The sum of the alignment scores of both alignments as returned by @link splitAlignment @endlink.
+ *
+ * Only the scores are computed, in linear space, and the best split position is the one that
+ * @link splitAlignment @endlink would choose.  The batched variant aligns blocks of pairs at once with interleaved
+ * DP columns and distributes the blocks over threads using OpenMP.
+ */
+
+/**
+.Function.splitAlignmentScore
+..category:Alignment
+..include:seqan/align_split.h
+..summary:Compute the score and the split position of split alignments without building the alignments.
+..signature:TScoreValue splitAlignmentScore(splitPos, seqHL, seqVL, seqHR, seqVR, scoringScheme)
+..signature:splitAlignmentScore(scores, splitPositions, seqsHL, seqsVL, seqsHR, seqsVR, scoringScheme)
+..param.splitPos:The position in the horizontal sequence where the right alignment starts.
+..param.seqHL:The horizontal/contig sequence of the left alignment.
+..param.seqVL:The vertical/read sequence of the left alignment.
+..param.seqHR:The horizontal/contig sequence of the right alignment, must have the length of $seqHL$.
+..param.seqVR:The vertical/read sequence of the right alignment.
+..param.scoringScheme:The scoring scheme to use for the alignment.
+...type:Class.Score
+..param.scores:A @Class.String@ with the score of each pair.
+..param.splitPositions:A @Class.String@ with the split position of each pair.
+..param.seqsHL:A @Class.StringSet@ with the horizontal sequences of the left alignments, the other sets analogously.
+..returns:The sum of the alignment scores of both alignments as returned by @Function.splitAlignment@.
+..remarks:Only the scores are computed, in linear space, and the best split position is the one that @Function.splitAlignment@ would choose.
+The batched variant aligns blocks of pairs at once with interleaved DP columns and distributes the blocks over threads using OpenMP.
+..see:Function.splitAlignment
+*/
+
+template <typename TPosition, typename TSeqHL, typename TSeqVL, typename TSeqHR, typename TSeqVR,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue splitAlignmentScore(TPosition & splitPos,
+                                TSeqHL const & seqHL,
+                                TSeqVL const & seqVL,
+                                TSeqHR const & seqHR,
+                                TSeqVR const & seqVR,
+                                Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    SEQAN_ASSERT_EQ_MSG(length(seqHL), length(seqHR), "Contig must be the same for left and right split alignment.");
+
+    TSeqHL const * ptrHL = &seqHL;
+    TSeqVL const * ptrVL = &seqVL;
+    TSeqHR const * ptrHR = &seqHR;
+    TSeqVR const * ptrVR = &seqVR;
+
+    String<TScoreValue> columnMaximaL, columnMaximaR;
+    _splitAlignmentColumnMaxima(&columnMaximaL, &ptrHL, &ptrVL, 1u, false, scoringScheme);
+    _splitAlignmentColumnMaxima(&columnMaximaR, &ptrHR, &ptrVR, 1u, true, scoringScheme);
+    return _bestSplitPosition(splitPos, columnMaximaL, columnMaximaR);
+}
+
+template <typename TScores, typename TSplitPositions, typename TSeqsHL, typename TSeqsVL, typename TSeqsHR,
+          typename TSeqsVR, typename TScoreValue, typename TScoreSpec>
+void splitAlignmentScore(TScores & scores,
+                         TSplitPositions & splitPositions,
+                         TSeqsHL const & seqsHL,
+                         TSeqsVL const & seqsVL,
+                         TSeqsHR const & seqsHR,
+                         TSeqsVR const & seqsVR,
+                         Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    typedef typename Value<TSeqsHL>::Type TSeqHL;
+    typedef typename Value<TSeqsVL>::Type TSeqVL;
+    typedef typename Value<TSeqsHR>::Type TSeqHR;
+    typedef typename Value<TSeqsVR>::Type TSeqVR;
+
+    SEQAN_ASSERT_EQ(length(seqsHL), length(seqsVL));
+    SEQAN_ASSERT_EQ(length(seqsHL), length(seqsHR));
+    SEQAN_ASSERT_EQ(length(seqsHL), length(seqsVR));
+
+    unsigned const blockSize = SplitAlignmentBlockSize_::VALUE;
+    int pairCount = length(seqsHL);
+    int blockCount = (pairCount + blockSize - 1) / blockSize;
+    resize(scores, pairCount, Exact());
+    resize(splitPositions, pairCount, Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (int block = 0; block < blockCount; ++block)
+    {
+        unsigned first = block * blockSize;
+        unsigned count = _min(blockSize, pairCount - first);
+
+        TSeqHL const * ptrsHL[SplitAlignmentBlockSize_::VALUE];
+        TSeqVL const * ptrsVL[SplitAlignmentBlockSize_::VALUE];
+        TSeqHR const * ptrsHR[SplitAlignmentBlockSize_::VALUE];
+        TSeqVR const * ptrsVR[SplitAlignmentBlockSize_::VALUE];
+        for (unsigned k = 0; k < count; ++k)
+        {
+            SEQAN_ASSERT_EQ_MSG(length(seqsHL[first + k]), length(seqsHR[first + k]),
+                                "Contig must be the same for left and right split alignment.");
+            ptrsHL[k] = &seqsHL[first + k];
+            ptrsVL[k] = &seqsVL[first + k];
+            ptrsHR[k] = &seqsHR[first + k];
+            ptrsVR[k] = &seqsVR[first + k];
+        }
+
+        String<TScoreValue> columnMaximaL[SplitAlignmentBlockSize_::VALUE];
+        String<TScoreValue> columnMaximaR[SplitAlignmentBlockSize_::VALUE];
+        _splitAlignmentColumnMaxima(columnMaximaL, ptrsHL, ptrsVL, count, false, scoringScheme);
+        _splitAlignmentColumnMaxima(columnMaximaR, ptrsHR, ptrsVR, count, true, scoringScheme);
+
+        for (unsigned k = 0; k < count; ++k)
+            scores[first + k] = _bestSplitPosition(splitPositions[first + k], columnMaximaL[k], columnMaximaR[k]);
+    }
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_EXTRAS_INCLUDE_SEQAN_ALIGN_SPLIT_ALIGN_SPLIT_SCORE_H_
@@ -56,36 +56,23 @@ namespace seqan {
 // ============================================================================
 
 // ----------------------------------------------------------------------------
-// Function _adaptTraceSegmentsTo()           [String<Journaled<SortedArray> >]
+// Function _adaptTraceSegmentsToEntries()
 // ----------------------------------------------------------------------------
 
-
-template <typename TValue, typename THostSpec, typename TBuffSpec, typename TReference,
-          typename TSource, typename TPosition, typename TSize, typename TStringSpec>
-inline void
-_adaptTraceSegmentsTo(String<TValue, Journaled<THostSpec, SortedArray, TBuffSpec> > & targetJournal,
-                      TReference const & /*reference*/, //TODO(rmaerker): What if the TSequenceH is a journal string.
-                      TSource const & source,
-                      String<TraceSegment_<TPosition, TSize>, TStringSpec> const & traceSegments)
+// Append the journal entries of the trace, sorted by virtual position, and return the length of the journaled string.
+template <typename TJournalEntry, typename TEntriesSpec, typename TInsertionBuffer, typename TSource, typename TPosition,
+          typename TSize, typename TStringSpec>
+inline typename Position<TSource>::Type
+_adaptTraceSegmentsToEntries(String<TJournalEntry, TEntriesSpec> & journalEntries,
+                             TInsertionBuffer & insertionBuffer,
+                             TSource const & source,
+                             String<TraceSegment_<TPosition, TSize>, TStringSpec> const & traceSegments)
 {
-
-    typedef String<TValue, Journaled<THostSpec, SortedArray, TBuffSpec> > TJournalString;
-    typedef typename JournalType<TJournalString>::Type TJournalEntries;
-    typedef typename Value<TJournalEntries>::Type TJournalEntry;
-
-//    typedef typename Position<TReference>::Type TPhysicalPosition;
     typedef typename Position<TSource>::Type TVirtualPosition;
 
     typedef TraceSegment_<TPosition, TSize> TTraceSegment;
     typedef typename Iterator<String<TTraceSegment, TStringSpec> const>::Type TTraceIterator;
 
-    SEQAN_ASSERT_NOT_MSG(empty(host(targetJournal)), "No reference sequence set!");
-
-    // TODO(rmaerker): Hot-fix for new alignment module.
-    clear(targetJournal._journalEntries._journalNodes);
-    clear(targetJournal._insertionBuffer);
-    targetJournal._journalEntries._originalStringLength = length(host(targetJournal));
-
     TVirtualPosition virtualPos = 0;
 
     TTraceIterator traceSegIter = end(traceSegments, Standard()) - 1;
@@ -97,17 +84,17 @@ _adaptTraceSegmentsTo(String<TValue, Journaled<THostSpec, SortedArray, TBuffSpec
         {
         case TraceBitMap_::DIAGONAL: //matching area
         {
-            appendValue(targetJournal._journalEntries._journalNodes, TJournalEntry(SOURCE_ORIGINAL, value(traceSegIter)._horizontalBeginPos,
-                                                                                   virtualPos, value(traceSegIter)._horizontalBeginPos, value(traceSegIter)._length));
+            appendValue(journalEntries, TJournalEntry(SOURCE_ORIGINAL, value(traceSegIter)._horizontalBeginPos,
+                                                      virtualPos, value(traceSegIter)._horizontalBeginPos, value(traceSegIter)._length));
             virtualPos += value(traceSegIter)._length;
             break;
         }
 
         case TraceBitMap_::VERTICAL: //insertion
         {
-            appendValue(targetJournal._journalEntries._journalNodes, TJournalEntry(SOURCE_PATCH, length(targetJournal._insertionBuffer),
-                                                                                   virtualPos, 0, value(traceSegIter)._length));
-            append(targetJournal._insertionBuffer,
+            appendValue(journalEntries, TJournalEntry(SOURCE_PATCH, length(insertionBuffer),
+                                                      virtualPos, 0, value(traceSegIter)._length));
+            append(insertionBuffer,
                    infix(source, value(traceSegIter)._verticalBeginPos, value(traceSegIter)._verticalBeginPos +
                          value(traceSegIter)._length));
             virtualPos += value(traceSegIter)._length;
@@ -118,7 +105,58 @@ _adaptTraceSegmentsTo(String<TValue, Journaled<THostSpec, SortedArray, TBuffSpec
             break;  // Otherwise we are in a deletion and do nothing.
         }
     }
-    _setLength(targetJournal, virtualPos);
+    return virtualPos;
+}
+
+// ----------------------------------------------------------------------------
+// Function _adaptTraceSegmentsTo()           [String<Journaled<SortedArray> >]
+// ----------------------------------------------------------------------------
+
+
+template <typename TValue, typename THostSpec, typename TBuffSpec, typename TReference,
+          typename TSource, typename TPosition, typename TSize, typename TStringSpec>
+inline void
+_adaptTraceSegmentsTo(String<TValue, Journaled<THostSpec, SortedArray, TBuffSpec> > & targetJournal,
+                      TReference const & /*reference*/, //TODO(rmaerker): What if the TSequenceH is a journal string.
+                      TSource const & source,
+                      String<TraceSegment_<TPosition, TSize>, TStringSpec> const & traceSegments)
+{
+    SEQAN_ASSERT_NOT_MSG(empty(host(targetJournal)), "No reference sequence set!");
+
+    // TODO(rmaerker): Hot-fix for new alignment module.
+    clear(targetJournal._journalEntries._journalNodes);
+    clear(targetJournal._insertionBuffer);
+    targetJournal._journalEntries._originalStringLength = length(host(targetJournal));
+
+    _setLength(targetJournal, _adaptTraceSegmentsToEntries(targetJournal._journalEntries._journalNodes,
+                                                           targetJournal._insertionBuffer, source, traceSegments));
+}
+
+// ----------------------------------------------------------------------------
+// Function _adaptTraceSegmentsTo()          [String<Journaled<BalancedTree> >]
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename THostSpec, typename TBuffSpec, typename TReference,
+          typename TSource, typename TPosition, typename TSize, typename TStringSpec>
+inline void
+_adaptTraceSegmentsTo(String<TValue, Journaled<THostSpec, BalancedTree, TBuffSpec> > & targetJournal,
+                      TReference const & /*reference*/,
+                      TSource const & source,
+                      String<TraceSegment_<TPosition, TSize>, TStringSpec> const & traceSegments)
+{
+    typedef String<TValue, Journaled<THostSpec, BalancedTree, TBuffSpec> > TJournalString;
+    typedef typename JournalType<TJournalString>::Type TJournalEntries;
+    typedef typename Value<TJournalEntries>::Type TJournalEntry;
+
+    SEQAN_ASSERT_NOT_MSG(empty(host(targetJournal)), "No reference sequence set!");
+
+    String<TJournalEntry> journalEntries;
+    clear(targetJournal._insertionBuffer);
+    _setLength(targetJournal, _adaptTraceSegmentsToEntries(journalEntries, targetJournal._insertionBuffer, source,
+                                                           traceSegments));
+    // The entries are sorted, so the tree is built in linear time.
+    _bulkLoadJournalEntries(targetJournal._journalEntries, journalEntries);
+    targetJournal._journalEntries._originalStringLength = length(host(targetJournal));
 }
 
 }  // namespace seqan
@@ -471,6 +471,16 @@ _constructAndSetJournalTree(String<TValue, Journaled<THostSpec, SortedArray, TBu
     assign(journalSeq._insertionBuffer, insertionBuffer);
 }
 
+template <typename TValue, typename THostSpec, typename TBuffSpec, typename TCargo, typename THostSpec2>
+inline void
+_constructAndSetJournalTree(String<TValue, Journaled<THostSpec, BalancedTree, TBuffSpec> > & journalSeq,
+                            String<TCargo, THostSpec2> const & cargoArray,
+                            String<TValue, TBuffSpec> const & insertionBuffer)
+{
+    _bulkLoadJournalEntries(journalSeq._journalEntries, cargoArray);
+    assign(journalSeq._insertionBuffer, insertionBuffer);
+}
+
 template <typename TValue, typename THostSpec, typename TBuffSpec, typename TCargo, typename THostSpec2>
 inline void
 _constructAndSetJournalTree(String<TValue, Journaled<THostSpec, UnbalancedTree, TBuffSpec> > & seq,
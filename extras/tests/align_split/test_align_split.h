@@ -586,4 +586,112 @@ SEQAN_DEFINE_TEST(test_align_split_insertion_in_reference_gaps_banded)
     SEQAN_ASSERT_EQ(clippedEndPosition(gapsVR), 56);
 }
 
+// Fills the sequences of a split alignment problem with pseudo-random DNA.  The read contains a part of the contig
+// before and after an insertion.
+
+inline void _fillRandomSplitProblem(seqan::DnaString & contig, seqan::DnaString & seqL, seqan::DnaString & seqR,
+                                    unsigned & state)
+{
+    clear(contig);
+    clear(seqL);
+    clear(seqR);
+    state = state * 1103515245u + 12345u;
+    unsigned len = 10 + (state >> 16) % 40;
+    for (unsigned i = 0; i < len; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        appendValue(contig, seqan::Dna((state >> 16) % 4));
+    }
+    state = state * 1103515245u + 12345u;
+    unsigned splitPos = 1 + (state >> 16) % (len - 1);
+    for (unsigned i = 0; i < len; ++i)
+    {
+        state = state * 1103515245u + 12345u;
+        seqan::Dna c = ((state >> 16) % 8 == 0u) ? seqan::Dna((state >> 20) % 4) : contig[i];
+        if (i < splitPos)
+            appendValue(seqL, c);
+        else
+            appendValue(seqR, c);
+    }
+    state = state * 1103515245u + 12345u;
+    for (unsigned i = 0; i < (state >> 16) % 5; ++i)
+    {
+        appendValue(seqL, seqan::Dna(i % 4));
+        insertValue(seqR, 0, seqan::Dna((i + 1) % 4));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_split_score_single)
+{
+    seqan::Score<int, seqan::Simple> scoreLinear(0, -1, -1, -1);
+    seqan::Score<int, seqan::Simple> scoreAffine(2, -3, -1, -4);
+
+    // The result must be the same as for splitAlignment().
+    unsigned state = 17;
+    for (unsigned round = 0; round < 100; ++round)
+    {
+        seqan::DnaString contig, seqL, seqR;
+        _fillRandomSplitProblem(contig, seqL, seqR, state);
+
+        for (unsigned i = 0; i < 2; ++i)
+        {
+            seqan::Score<int, seqan::Simple> const & score = (i == 0u) ? scoreLinear : scoreAffine;
+
+            seqan::Align<seqan::DnaString> alignL, alignR;
+            resize(rows(alignL), 2);
+            assignSource(row(alignL, 0), contig);
+            assignSource(row(alignL, 1), seqL);
+            resize(rows(alignR), 2);
+            assignSource(row(alignR, 0), contig);
+            assignSource(row(alignR, 1), seqR);
+            int expected = splitAlignment(alignL, alignR, score);
+
+            unsigned splitPos = 0;
+            int res = splitAlignmentScore(splitPos, contig, seqL, contig, seqR, score);
+            SEQAN_ASSERT_EQ(res, expected);
+            SEQAN_ASSERT_EQ(splitPos, endPosition(row(alignL, 0)));
+            SEQAN_ASSERT_EQ(splitPos, beginPosition(row(alignR, 0)));
+        }
+    }
+
+    // Insertion in the reference, see test_align_split_insertion_in_reference_align_unbanded.
+    seqan::DnaString contig1 = "AGCATTTTAGATAAGATAGCTGTGCTAGTAGGCAGTCAGCGCCTT";
+    seqan::DnaString contig2 = "AGCATGTTAGATAAGATAGCCCCCCCCCCCCTGTGCTAGTAGGCAGTCAGCGCCAT";
+    unsigned splitPos = 0;
+    int res = splitAlignmentScore(splitPos, contig1, contig2, contig1, contig2, scoreLinear);
+    SEQAN_ASSERT_EQ(res, -2);
+    SEQAN_ASSERT_EQ(splitPos, 19u);
+}
+
+SEQAN_DEFINE_TEST(test_align_split_score_batch)
+{
+    seqan::Score<int, seqan::Simple> score(2, -3, -1, -4);
+
+    // Use a number of pairs that is not a multiple of the block size.
+    seqan::StringSet<seqan::DnaString> contigs, seqsL, seqsR;
+    unsigned state = 23;
+    for (unsigned i = 0; i < 21; ++i)
+    {
+        seqan::DnaString contig, seqL, seqR;
+        _fillRandomSplitProblem(contig, seqL, seqR, state);
+        appendValue(contigs, contig);
+        appendValue(seqsL, seqL);
+        appendValue(seqsR, seqR);
+    }
+
+    seqan::String<int> scores;
+    seqan::String<unsigned> splitPositions;
+    splitAlignmentScore(scores, splitPositions, contigs, seqsL, contigs, seqsR, score);
+
+    SEQAN_ASSERT_EQ(length(scores), 21u);
+    SEQAN_ASSERT_EQ(length(splitPositions), 21u);
+    for (unsigned i = 0; i < length(contigs); ++i)
+    {
+        unsigned splitPos = 0;
+        int res = splitAlignmentScore(splitPos, contigs[i], seqsL[i], contigs[i], seqsR[i], score);
+        SEQAN_ASSERT_EQ(scores[i], res);
+        SEQAN_ASSERT_EQ(splitPositions[i], splitPos);
+    }
+}
+
 #endif  // SEQAN_EXTRAS_TESTS_ALIGN_SPLIT_TEST_ALIGN_SPLIT_H_
@@ -273,6 +273,12 @@ if (${CMAKE_SYSTEM_NAME} STREQUAL "Linux")
   set (SEQAN_LIBRARIES ${SEQAN_LIBRARIES} rt)
 endif ()
 
+# libpthread -- implicit, on Linux only; used by the threads in seqan/system.
+
+if (${CMAKE_SYSTEM_NAME} STREQUAL "Linux")
+  set (SEQAN_LIBRARIES ${SEQAN_LIBRARIES} pthread)
+endif ()
+
 # libexecinfo -- implicit
 
 check_include_files(execinfo.h _SEQAN_HAVE_EXECINFO)